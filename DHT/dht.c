@@ -9,6 +9,7 @@
  */
 
 #include "debugging/assert.h"
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <signal.h>
@@ -419,6 +420,11 @@ typedef struct dht {
     dhtValuePolicy  KeyPolicy;      /* Whether we copy keys */
     dhtValuePolicy  DtaPolicy;      /* Whether we copy data */
     Procedures  procs;
+    InternHsElement **FlatDir;      /* buckets of a table created by
+                                     * dhtCreateFlat(); Nil otherwise */
+    uLong       FlatMask;       /* number of buckets of FlatDir - 1 */
+    uChar       *FlatDirty;     /* one bit per block of buckets of FlatDir
+                                 * that may be non-empty */
 } dht;
 #if !defined(HashTable)
 #define HashTable struct dht
@@ -436,6 +442,52 @@ typedef struct dht {
 #define ActualLoadFactor(h) (((h)->KeyCount*100)/(h)->DirTab.count)
 #endif /*OVERFLOW_SAVE*/
 
+/* A table created by dhtCreateFlat() doesn't grow by linear hashing, but
+ * uses a flat power of 2 sized array of buckets provided by the caller, which
+ * is indexed by masking the hash value. Clearing the buckets of a big array
+ * for each new table would take a considerable amount of time; we therefore
+ * remember which blocks of buckets have been used.
+ */
+#define LD2_BUCKETS_PER_BLOCK 6
+#define FLAT_BLOCK(i)   ((i)>>LD2_BUCKETS_PER_BLOCK)
+#define FLAT_BLOCK_SIZE ((uLong)1<<LD2_BUCKETS_PER_BLOCK)
+
+static uLong nrDirtyFlagBytes(uLong nrBuckets)
+{
+  return (FLAT_BLOCK(nrBuckets)+CHAR_BIT-1)/CHAR_BIT;
+}
+
+static boolean isFlatBlockDirty(dht const *ht, uLong block)
+{
+  return (ht->FlatDirty[block/CHAR_BIT] & (1u<<(block%CHAR_BIT)))!=0;
+}
+
+static void markFlatBlockDirty(dht *ht, uLong block)
+{
+  ht->FlatDirty[block/CHAR_BIT] |= (uChar)(1u<<(block%CHAR_BIT));
+}
+
+/* Deliver the next bucket of a table, skipping blocks of buckets of a flat
+ * table that have never been used
+ */
+static InternHsElement *stepTable(dht const *ht, dirEnumerate *enumeration)
+{
+  if (ht->FlatDir!=Nil(InternHsElement *))
+  {
+    while (enumeration->index<=ht->FlatMask
+           && enumeration->index%FLAT_BLOCK_SIZE==0
+           && !isFlatBlockDirty(ht,FLAT_BLOCK(enumeration->index)))
+      enumeration->index += FLAT_BLOCK_SIZE;
+
+    if (enumeration->index<=ht->FlatMask)
+      return ht->FlatDir[enumeration->index++];
+    else
+      return &EndOfTable;
+  }
+  else
+    return stepDirTable(enumeration);
+}
+
 unsigned long dhtKeyCount(dht *h)
 {
   return h->KeyCount;
@@ -448,14 +500,14 @@ char const *dhtErrorMsg(void)
   return dhtError;
 }
 
-dht *dhtCreate(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
-               dhtValueType DtaType, dhtValuePolicy DataPolicy)
+/* Allocate a table and initialise the members that don't depend on how the
+ * table is organised
+ */
+static dht *allocTable(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
+                       dhtValueType DtaType, dhtValuePolicy DataPolicy)
 {
   dht *result = Nil(dht);
 
-  TraceFunctionEntry(__func__);
-  TraceEOL();
-
   if (KeyType>=dhtValueTypeCnt)
     sprintf(dhtError,
             "dhtCreate: invalid KeyType: numeric=%u\n", (unsigned int) KeyType);
@@ -483,57 +535,79 @@ dht *dhtCreate(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
       strcpy(dhtError, "dhtCreate: no memory.");
     else
     {
-      ht->DirTab.ld[0].dir = New(ht_dir);
-      if (ht->DirTab.ld[0].dir==Nil(ht_dir))
+      ht->KeyCount=     0;
+      ht->MinLoadFactor=  DefaultMinLoadFactor;
+      ht->MaxLoadFactor=  DefaultMaxLoadFactor;
+      ht->KeyPolicy=        KeyPolicy;
+      ht->DtaPolicy=        DataPolicy;
+      ht->NextStep=       NilInternHsElement;
+      ht->FlatDir=        Nil(InternHsElement *);
+      ht->FlatMask=       0;
+      ht->FlatDirty=      Nil(uChar);
+
+      ht->procs.Hash=     dhtProcedures[KeyType]->Hash;
+      ht->procs.Equal=    dhtProcedures[KeyType]->Equal;
+      ht->procs.DumpData= dhtProcedures[DtaType]->Dump;
+      ht->procs.DumpKey=  dhtProcedures[KeyType]->Dump;
+
+      if (KeyPolicy==dhtNoCopy)
       {
-        strcpy(dhtError,
-               "dhtCreate: No memory for Directory segment.");
-        FreeHashTable(ht);
+        ht->procs.DupKey= dhtProcedures[dhtSimpleValue]->Dup;
+        ht->procs.FreeKey= dhtProcedures[dhtSimpleValue]->Free;
       }
-      else
+      else if (KeyPolicy==dhtCopy)
       {
-        ht->DirTab.level= 0;
-        ht->DirTab.count= PTR_PER_DIR;
-        ht->DirTab.ld[0].valid= PTR_PER_DIR;
-        memset(ht->DirTab.ld[0].dir, 0, sizeof(ht_dir));
-        ht->p=            0;
-        ht->KeyCount=     0;
-        ht->maxp=     PTR_PER_DIR;
-        ht->CurrentSize=    ht->maxp;
-        ht->MinLoadFactor=  DefaultMinLoadFactor;
-        ht->MaxLoadFactor=  DefaultMaxLoadFactor;
-        ht->KeyPolicy=        KeyPolicy;
-        ht->DtaPolicy=        DataPolicy;
-
-        ht->procs.Hash=     dhtProcedures[KeyType]->Hash;
-        ht->procs.Equal=    dhtProcedures[KeyType]->Equal;
-        ht->procs.DumpData= dhtProcedures[DtaType]->Dump;
-        ht->procs.DumpKey=  dhtProcedures[KeyType]->Dump;
-
-        if (KeyPolicy==dhtNoCopy)
-        {
-          ht->procs.DupKey= dhtProcedures[dhtSimpleValue]->Dup;
-          ht->procs.FreeKey= dhtProcedures[dhtSimpleValue]->Free;
-        }
-        else if (KeyPolicy==dhtCopy)
-        {
-          ht->procs.DupKey= dhtProcedures[KeyType]->Dup;
-          ht->procs.FreeKey= dhtProcedures[KeyType]->Free;
-        }
-
-        if (DataPolicy==dhtNoCopy)
-        {
-          ht->procs.DupData= dhtProcedures[dhtSimpleValue]->Dup;
-          ht->procs.FreeData= dhtProcedures[dhtSimpleValue]->Free;
-        }
-        else if (DataPolicy==dhtCopy)
-        {
-          ht->procs.DupData= dhtProcedures[DtaType]->Dup;
-          ht->procs.FreeData= dhtProcedures[DtaType]->Free;
-        }
+        ht->procs.DupKey= dhtProcedures[KeyType]->Dup;
+        ht->procs.FreeKey= dhtProcedures[KeyType]->Free;
+      }
 
-        result = ht;
+      if (DataPolicy==dhtNoCopy)
+      {
+        ht->procs.DupData= dhtProcedures[dhtSimpleValue]->Dup;
+        ht->procs.FreeData= dhtProcedures[dhtSimpleValue]->Free;
+      }
+      else if (DataPolicy==dhtCopy)
+      {
+        ht->procs.DupData= dhtProcedures[DtaType]->Dup;
+        ht->procs.FreeData= dhtProcedures[DtaType]->Free;
       }
+
+      result = ht;
+    }
+  }
+
+  return result;
+}
+
+dht *dhtCreate(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
+               dhtValueType DtaType, dhtValuePolicy DataPolicy)
+{
+  dht *result;
+
+  TraceFunctionEntry(__func__);
+  TraceEOL();
+
+  result = allocTable(KeyType,KeyPolicy,DtaType,DataPolicy);
+  if (result!=Nil(dht))
+  {
+    dht * const ht = result;
+    ht->DirTab.ld[0].dir = New(ht_dir);
+    if (ht->DirTab.ld[0].dir==Nil(ht_dir))
+    {
+      strcpy(dhtError,
+             "dhtCreate: No memory for Directory segment.");
+      FreeHashTable(ht);
+      result = Nil(dht);
+    }
+    else
+    {
+      ht->DirTab.level= 0;
+      ht->DirTab.count= PTR_PER_DIR;
+      ht->DirTab.ld[0].valid= PTR_PER_DIR;
+      memset(ht->DirTab.ld[0].dir, 0, sizeof(ht_dir));
+      ht->p=            0;
+      ht->maxp=     PTR_PER_DIR;
+      ht->CurrentSize=    ht->maxp;
     }
   }
 
@@ -543,6 +617,71 @@ dht *dhtCreate(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
   return result;
 }
 
+size_t dhtFlatDirectorySize(unsigned long nrBuckets)
+{
+  return (size_t)nrBuckets*sizeof(InternHsElement *) + nrDirtyFlagBytes(nrBuckets);
+}
+
+dht *dhtCreateFlat(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
+                   dhtValueType DtaType, dhtValuePolicy DataPolicy,
+                   void *directory, unsigned long nrBuckets)
+{
+  dht *result;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%p",directory);
+  TraceFunctionParam("%lu",nrBuckets);
+  TraceFunctionParamListEnd();
+
+  assert(nrBuckets>=dhtMinFlatBuckets);
+  assert((nrBuckets&(nrBuckets-1))==0);
+
+  result = allocTable(KeyType,KeyPolicy,DtaType,DataPolicy);
+  if (result!=Nil(dht))
+  {
+    dht * const ht = result;
+    ht->FlatDir = (InternHsElement **)directory;
+    ht->FlatMask = nrBuckets-1;
+    ht->FlatDirty = (uChar *)(ht->FlatDir+nrBuckets);
+    ht->DirTab.level= 0;
+    ht->DirTab.count= 0;
+    ht->p=            0;
+    ht->maxp=     nrBuckets;
+    ht->CurrentSize=    nrBuckets;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%p",(void *)result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+void dhtResetFlatDirectory(HashTable *ht)
+{
+  uLong const nrBlocks = FLAT_BLOCK(ht->FlatMask+1);
+  uLong block;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%p",(void *)ht);
+  TraceFunctionParamListEnd();
+
+  assert(ht->FlatDir!=Nil(InternHsElement *));
+
+  for (block = 0; block<nrBlocks; ++block)
+    if (isFlatBlockDirty(ht,block))
+      memset(ht->FlatDir+(block<<LD2_BUCKETS_PER_BLOCK),
+             0,
+             FLAT_BLOCK_SIZE*sizeof *ht->FlatDir);
+
+  memset(ht->FlatDirty, 0, nrDirtyFlagBytes(ht->FlatMask+1));
+
+  ht->KeyCount = 0;
+  ht->NextStep = NilInternHsElement;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
 void dhtDestroy(HashTable *ht)
 {
   dirEnumerate dEnum;
@@ -555,7 +694,7 @@ void dhtDestroy(HashTable *ht)
   dEnum.current = 0;
   dEnum.dt= &ht->DirTab;
 
-  for (b = stepDirTable(&dEnum); b!=&EndOfTable; b = stepDirTable(&dEnum))
+  for (b = stepTable(ht,&dEnum); b!=&EndOfTable; b = stepTable(ht,&dEnum))
     while (b)
     {
       InternHsElement *tmp= b;
@@ -565,7 +704,10 @@ void dhtDestroy(HashTable *ht)
       FreeInternHsElement(tmp);
     }
 
-  freeDirTable(&ht->DirTab);
+  if (ht->FlatDir!=Nil(InternHsElement *))
+    dhtResetFlatDirectory(ht);
+  else
+    freeDirTable(&ht->DirTab);
   FreeHashTable(ht);
 
   TraceFunctionExit(__func__);
@@ -595,7 +737,7 @@ void dhtDumpIndented(int ind, HashTable *ht, FILE *f)
   dEnum.current = 0;
   dEnum.dt= &ht->DirTab;
 
-  for (b = stepDirTable(&dEnum); b!=&EndOfTable; b = stepDirTable(&dEnum))
+  for (b = stepTable(ht,&dEnum); b!=&EndOfTable; b = stepTable(ht,&dEnum))
     while (b)
     {
       fprintf(f, "%*s    ", ind, "");
@@ -630,9 +772,9 @@ dhtElement *dhtGetFirstElement(HashTable *ht)
     ht->DirEnum.index= 0;
     ht->DirEnum.dt = &ht->DirTab;
 
-    for (b = stepDirTable(&ht->DirEnum);
+    for (b = stepTable(ht,&ht->DirEnum);
          b!=&EndOfTable;
-         b = stepDirTable(&ht->DirEnum))
+         b = stepTable(ht,&ht->DirEnum))
       if (b!=0)
       {
         ht->NextStep= b->Next;
@@ -658,9 +800,9 @@ dhtElement *dhtGetNextElement(HashTable *ht)
     return de;
   }
 
-  for (b = stepDirTable(&ht->DirEnum);
+  for (b = stepTable(ht,&ht->DirEnum);
        b!=&EndOfTable;
-       b = stepDirTable(&ht->DirEnum))
+       b = stepTable(ht,&ht->DirEnum))
     if (b != 0)
     {
       ht->NextStep= b->Next;
@@ -796,9 +938,18 @@ LOCAL void ShrinkHashTable(HashTable *ht)
   shrinkDirTable(&ht->DirTab);
 }
 
-LOCAL InternHsElement **LookupInternHsElement(HashTable *ht, dhtConstValue key)
+/* Find the element for a key
+ * @param ht table
+ * @param key key
+ * @param bucket where to store the index of the key's bucket
+ * @return address of the pointer to the element; address of the null pointer
+ *         at the end of the bucket if there is no element for key
+ */
+LOCAL InternHsElement **LookupInternHsElement(HashTable *ht,
+                                              dhtConstValue key,
+                                              uLong *bucket)
 {
-  uLong h;
+  dhtHashValue const hashVal = (ht->procs.Hash)(key);
   InternHsElement **phe;
 
   TraceFunctionEntry(__func__);
@@ -806,9 +957,17 @@ LOCAL InternHsElement **LookupInternHsElement(HashTable *ht, dhtConstValue key)
   TraceFunctionParam("%p",(void const *)key);
   TraceFunctionParamListEnd();
 
-  h = DynamicHash(ht->p, ht->maxp, (ht->procs.Hash)(key));
-  phe = (InternHsElement**)accessAdr(&ht->DirTab, h);
-  TMDBG(printf("h:%lu\n",h));
+  if (ht->FlatDir!=Nil(InternHsElement *))
+  {
+    *bucket = hashVal & ht->FlatMask;
+    phe = ht->FlatDir+*bucket;
+  }
+  else
+  {
+    *bucket = DynamicHash(ht->p, ht->maxp, hashVal);
+    phe = (InternHsElement**)accessAdr(&ht->DirTab, *bucket);
+  }
+  TMDBG(printf("h:%lu\n",*bucket));
 
   assert(phe!=0);
   while (*phe)
@@ -831,13 +990,14 @@ void dhtRemoveElement(HashTable *ht, dhtConstValue key)
 {
   MYNAME(dhtRemoveElement)
   InternHsElement **phe, *he;
+  uLong bucket;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%p",(void *)ht);
   TraceFunctionParam("%p",(void const *)key);
   TraceFunctionParamListEnd();
 
-  phe= LookupInternHsElement(ht, key);
+  phe= LookupInternHsElement(ht, key, &bucket);
   if (*phe)
   {
     DEBUG_CODE(
@@ -853,7 +1013,8 @@ void dhtRemoveElement(HashTable *ht, dhtConstValue key)
     (ht->procs.FreeKey)((dhtValue)he->HsEl.Key);
     FreeInternHsElement(he);
     ht->KeyCount--;
-    if (ActualLoadFactor(ht) < ht->MinLoadFactor)
+    if (ht->FlatDir==Nil(InternHsElement *)
+        && ActualLoadFactor(ht) < ht->MinLoadFactor)
     {
       DEBUG_CODE(
         fprintf(stderr,
@@ -880,6 +1041,7 @@ void dhtRemoveElement(HashTable *ht, dhtConstValue key)
 dhtElement *dhtEnterElement(HashTable *ht, dhtConstValue key, dhtConstValue data)
 {
   InternHsElement **phe, *he;
+  uLong bucket;
   dhtConstValue KeyV;
   dhtConstValue DataV;
 
@@ -911,7 +1073,7 @@ dhtElement *dhtEnterElement(HashTable *ht, dhtConstValue key, dhtConstValue data
     return dhtNilElement;
   }
 
-  phe = LookupInternHsElement(ht,key);
+  phe = LookupInternHsElement(ht,key,&bucket);
   TraceValue("%p",(void *)phe);
   he = *phe;
   TraceValue("%p",(void *)he);
@@ -936,6 +1098,8 @@ dhtElement *dhtEnterElement(HashTable *ht, dhtConstValue key, dhtConstValue data
       *phe = he;
       he->Next = NilInternHsElement;
       ht->KeyCount++;
+      if (ht->FlatDir!=Nil(InternHsElement *))
+        markFlatBlockDirty(ht,FLAT_BLOCK(bucket));
     }
   }
   else
@@ -949,7 +1113,8 @@ dhtElement *dhtEnterElement(HashTable *ht, dhtConstValue key, dhtConstValue data
   he->HsEl.Key = KeyV;
   he->HsEl.Data = DataV;
 
-  if (ActualLoadFactor(ht)>ht->MaxLoadFactor)
+  if (ht->FlatDir==Nil(InternHsElement *)
+      && ActualLoadFactor(ht)>ht->MaxLoadFactor)
   {
     /*
       fputs("Dumping Hash-Table before expansion\n",stderr);
@@ -978,13 +1143,14 @@ dhtElement *dhtEnterElement(HashTable *ht, dhtConstValue key, dhtConstValue data
 dhtElement *dhtLookupElement(HashTable *ht, dhtConstValue key)
 {
   InternHsElement **phe;
+  uLong bucket;
   dhtElement *result;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%p",(void *)ht);
   TraceFunctionParamListEnd();
 
-  phe= LookupInternHsElement(ht,key);
+  phe= LookupInternHsElement(ht,key,&bucket);
   if (*phe)
     result = &(*phe)->HsEl;
   else
@@ -26,6 +26,24 @@ struct dht;
 /* procedures */
 struct dht *dhtCreate(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
                       dhtValueType DtaType, dhtValuePolicy DataPolicy);
+
+/* Tables of a known final size can use a flat array of buckets provided by
+ * the caller instead of a directory that grows by linear hashing.
+ * The number of buckets must be a power of 2 and at least dhtMinFlatBuckets.
+ * The memory of the directory (dhtFlatDirectorySize() bytes) must be zeroed
+ * before the first table is created in it; dhtDestroy() and
+ * dhtResetFlatDirectory() leave it ready for the next table.
+ */
+enum { dhtMinFlatBuckets = 256 };
+size_t	      dhtFlatDirectorySize(unsigned long nrBuckets);
+struct dht *dhtCreateFlat(dhtValueType KeyType, dhtValuePolicy KeyPolicy,
+                          dhtValueType DtaType, dhtValuePolicy DataPolicy,
+                          void *directory, unsigned long nrBuckets);
+/* Empty the buckets of a table created by dhtCreateFlat() without freeing
+ * the elements (e.g. because their memory is released in bulk by fxfReset()).
+ * Takes time proportional to the number of buckets used rather than to the
+ * size of the directory. */
+void	      dhtResetFlatDirectory(struct dht *);
 dhtElement *dhtEnterElement(struct dht *, dhtConstValue key, dhtConstValue data);
 unsigned int dhtBucketStat	(struct dht *, unsigned int *counter, unsigned int n);
 void	      dhtDestroy	(struct dht *);
@@ -72,15 +72,23 @@ static inline void * nNewImpl(size_t const nmemb, size_t const size) {
  * each size of memory we keep a head pointer and all freed chunks
  * of memory is threaded on this list. If memory of this size
  * is requested, we drag it from the list, otherwise we carve it
- * from larger preallocated (via malloc) chunks of memory. If
- * the sizes between allocation and deallocation vary too often,
- * this package is lost in fragmented memory.
+ * from the current slab of this size, i.e. a block of fxfSLABSIZE
+ * bytes taken from larger preallocated (via malloc) chunks of memory
+ * that only holds chunks of this size. This keeps chunks of the same
+ * size (e.g. the elements or the keys of a hash table) close to each
+ * other. If the sizes between allocation and deallocation vary too
+ * often, this package is lost in fragmented memory.
+ * fxfReset() releases all chunks at once without visiting them.
  */
 
 typedef struct {
     unsigned long  MallocCount;
     unsigned long  FreeCount;
     char *    FreeHead;
+    char *    SlabPtr;  /* next chunk to be carved from the current slab */
+    char *    SlabEnd;
+    unsigned long  SlabCount;
+    size_t    SlabBytes;
 } SizeHead;
 
 #if defined(DOS)
@@ -100,6 +108,13 @@ typedef struct {
 #define OSMAXMEM "768 MB"
 #endif
 
+/* The size of the slabs that the chunks of a size are carved from */
+#if defined(SEGMENTED)
+#define fxfSLABSIZE ((size_t)(ARENA_SEG_SIZE/8))
+#else
+#define fxfSLABSIZE ((size_t)16*1024)
+#endif
+
 /* The maximum size an fxfAlloc can handle */
 #if defined(SEGMENTED) || defined(__TURBOC__)
 #define fxfMAXSIZE  ((size_t)1024)
@@ -343,14 +358,6 @@ void fxfReset(void)
 #endif /*FREEMAP*/
 #endif /*SEGMENTED*/
 
-#if !defined(NDEBUG)
-  {
-    unsigned int i;
-    for (i = 1; i<=50; ++i)
-      assert(SizeData[i].MallocCount==0);
-  }
-#endif
-
   memset(SizeData, '\0', sizeof SizeData);
 }
 
@@ -369,6 +376,48 @@ void fxfReset(void)
 
 #define TMDBG(x) if (0) x
 
+/* Take a new slab for a size from the bottom of the (current segment of
+ * the) arena. If less than fxfSLABSIZE bytes are left, the rest is taken.
+ * @param sh size head of the size
+ * @param size the size
+ * @return 1 iff a slab holding at least one chunk could be taken
+ */
+static int NewSlab(SizeHead *sh, size_t size) {
+  size_t sizeCurrentSeg= (size_t)(TopFreePtr-BotFreePtr);
+  size_t slabSize;
+
+#if defined(SEGMENTED)
+  while (sizeCurrentSeg<size && (CurrentSeg+1) < ArenaSegCnt) {
+    TMDBG(fputs(" next seg", stdout));
+    ++CurrentSeg;
+    BotFreePtr= Arena[CurrentSeg];
+    TopFreePtr= Arena[CurrentSeg]+ARENA_SEG_SIZE;
+    sizeCurrentSeg= ARENA_SEG_SIZE;
+  }
+#endif /*SEGMENTED*/
+
+  if (sizeCurrentSeg<size)
+    return 0;
+
+  /* a slab consists of whole chunks; the next slab starts aligned */
+  slabSize= fxfSLABSIZE<sizeCurrentSeg ? fxfSLABSIZE : sizeCurrentSeg;
+  slabSize-= slabSize%size;
+  if (slabSize<size)
+    slabSize= size;
+  if (((slabSize+PTRMASK) & ~PTRMASK)<=sizeCurrentSeg)
+    slabSize= (slabSize+PTRMASK) & ~PTRMASK;
+
+  TMDBG(printf(" new slab size:%" SIZE_T_PRINTF_SPECIFIER,(size_t_printf_type)slabSize));
+
+  sh->SlabPtr= BotFreePtr;
+  sh->SlabEnd= BotFreePtr+slabSize;
+  BotFreePtr+= slabSize;
+  ++sh->SlabCount;
+  sh->SlabBytes+= slabSize;
+
+  return 1;
+}
+
 void *fxfAlloc(size_t size) {
 #if defined(LOG) || defined(DEBUG)
   static char const * const myname= "fxfAlloc";
@@ -404,42 +453,17 @@ void *fxfAlloc(size_t size) {
     TMDBG(printf(" FreeCount:%lu ptr-Arena:%" PTRDIFF_T_PRINTF_SPECIFIER " MallocCount:%lu\n",sh->FreeCount,(ptrdiff_t_printf_type)(ptr-Arena),sh->MallocCount));
 #endif
   }
-  else {
-    /* we have to allocate a new piece */
-    size_t const sizeCurrentSeg = (size_t)(TopFreePtr-BotFreePtr);
-    TMDBG(printf(" sizeCurrentSeg:%" SIZE_T_PRINTF_SPECIFIER,(size_t_printf_type)sizeCurrentSeg));
-    if (sizeCurrentSeg>=size) {
-      if (size&PTRMASK) {
-        /* not aligned */
-        ptr= BotFreePtr;
-        BotFreePtr+= size;
-      }
-      else {
-        /* aligned */
-        ptr= TopFreePtr-= size;
-      }
-      sh->MallocCount++;
+  else if ((size_t)(sh->SlabEnd-sh->SlabPtr)>=size || NewSlab(sh,size)) {
+    ptr= sh->SlabPtr;
+    sh->SlabPtr+= size;
+    sh->MallocCount++;
 #if !defined(SEGMENTED) /* TODO: What should we output in the SEGMENTED case? */
-      TMDBG(printf(" current seg ptr-Arena:%" PTRDIFF_T_PRINTF_SPECIFIER " MallocCount:%lu\n",(ptrdiff_t_printf_type)(ptr-Arena),sh->MallocCount));
+    TMDBG(printf(" slab ptr-Arena:%" PTRDIFF_T_PRINTF_SPECIFIER " MallocCount:%lu\n",(ptrdiff_t_printf_type)(ptr-Arena),sh->MallocCount));
 #endif
-    }
-    else
-    {
-#if defined(SEGMENTED)
-      if ((CurrentSeg+1) < ArenaSegCnt) {
-        TMDBG(fputs(" next seg", stdout));
-        ++CurrentSeg;
-        BotFreePtr= Arena[CurrentSeg];
-        TopFreePtr= Arena[CurrentSeg]+ARENA_SEG_SIZE;
-        ptr= fxfAlloc(size);
-      }
-      else
-        ptr= Nil(char);
-#else /*SEGMENTED*/
-      ptr= Nil(char);
-#endif /*!SEGMENTED*/
-      TMDBG(printf(" ptr:%p\n",(void *)ptr));
-    }
+  }
+  else {
+    ptr= Nil(char);
+    TMDBG(printf(" ptr:%p\n",(void *)ptr));
   }
   DBG((df, "%p\n", (void *) ptr));
   return ptr;
@@ -464,39 +488,18 @@ void fxfFree(void *ptr, size_t size)
   if ((size&PTRMASK) && size<ALIGNED_MINSIZE)
     size= ALIGNED_MINSIZE;
   sh= &SizeData[size];
-  if (size&PTRMASK) {
-    /* unaligned size */
-    TMDBG(printf(" BotFreePtr-ptr:%" PTRDIFF_T_PRINTF_SPECIFIER,(ptrdiff_t_printf_type)(BotFreePtr-(char const*)ptr)));
-    if ((char *)ptr+size == BotFreePtr) {
-      BotFreePtr-= size;
-      TMDBG(printf(" BotFreePtr sizeCurrentSeg:%" PTRDIFF_T_PRINTF_SPECIFIER,(ptrdiff_t_printf_type)(TopFreePtr-BotFreePtr)));
-      --sh->MallocCount;
-    }
-    else {
-      SetRange((char *)ptr-Arena,size);
-      *(char **)ALIGN(ptr)= sh->FreeHead;
-      sh->FreeHead= ptr;
-      ++sh->FreeCount;
-      --sh->MallocCount;
-      TMDBG(printf(" FreeCount:%lu",sh->FreeCount));
-    }
+  if ((char *)ptr+size == sh->SlabPtr) {
+    /* the latest chunk carved from the current slab */
+    sh->SlabPtr-= size;
+    --sh->MallocCount;
   }
   else {
-    /* aligned size */
-    TMDBG(printf(" ptr-TopFreePtr:%" PTRDIFF_T_PRINTF_SPECIFIER,(ptrdiff_t_printf_type)(((char const*)ptr)-TopFreePtr)));
-    if ((char *)ptr == TopFreePtr) {
-      TopFreePtr+= size;
-      TMDBG(printf(" TopFreePtr sizeCurrentSeg:%" PTRDIFF_T_PRINTF_SPECIFIER,(ptrdiff_t_printf_type)(TopFreePtr-BotFreePtr)));
-      --sh->MallocCount;
-    }
-    else {
-      SetRange((char *)ptr-Arena,size);
-      *(char **)ptr= sh->FreeHead;
-      sh->FreeHead= ptr;
-      ++sh->FreeCount;
-      --sh->MallocCount;
-      TMDBG(printf(" FreeCount:%lu",sh->FreeCount));
-    }
+    SetRange((char *)ptr-Arena,size);
+    PutNextPtr(ptr, sh->FreeHead);
+    sh->FreeHead= ptr;
+    ++sh->FreeCount;
+    --sh->MallocCount;
+    TMDBG(printf(" FreeCount:%lu",sh->FreeCount));
   }
   TMDBG(printf(" MallocCount:%lu",sh->MallocCount));
   TMDBG(putchar('\n'));
@@ -554,26 +557,38 @@ void fxfInfo(FILE *f) {
     SizeHead const *hd = SizeData;
     unsigned long nrUsed = 0;
     unsigned long nrFree = 0;
+    unsigned long nrSlabs = 0;
     size_t UsedBytes = 0;
     size_t FreeBytes = 0;
+    size_t SlabBytes = 0;
 
+    /* Frag: percentage of the bytes of the slabs of a size that don't hold
+     * an allocated chunk, i.e. that are on the free list or not carved yet */
     unsigned int i;
-    fprintf(f, "%12s  %10s%10s\n", "Size", "MallocCnt", "FreeCnt");
+    fprintf(f, "%12s  %10s%10s%10s%8s\n", "Size", "MallocCnt", "FreeCnt", "SlabCnt", "Frag%");
     for (i=0; i<=fxfMAXSIZE; i++,hd++) {
-      if (hd->MallocCount+hd->FreeCount>0) {
-        fprintf(f, "%12u  %10lu%10lu\n", i, hd->MallocCount, hd->FreeCount);
+      if (hd->MallocCount+hd->FreeCount+hd->SlabCount>0) {
+        size_t const used = hd->MallocCount*i;
+        unsigned int const frag = (hd->SlabBytes==0
+                                   ? 0
+                                   : (unsigned int)(((hd->SlabBytes-used)*100)/hd->SlabBytes));
+        fprintf(f, "%12u  %10lu%10lu%10lu%8u\n", i, hd->MallocCount, hd->FreeCount, hd->SlabCount, frag);
         nrUsed+= hd->MallocCount;
-        UsedBytes+= hd->MallocCount*i;
+        UsedBytes+= used;
         nrFree+= hd->FreeCount;
         FreeBytes+= hd->FreeCount*i;
+        nrSlabs+= hd->SlabCount;
+        SlabBytes+= hd->SlabBytes;
       }
     }
-    fprintf(f, "%12s  %10lu%10lu\n", "Total:", nrUsed, nrFree);
+    fprintf(f, "%12s  %10lu%10lu%10lu%8u\n", "Total:", nrUsed, nrFree, nrSlabs,
+            SlabBytes==0 ? 0 : (unsigned int)(((SlabBytes-UsedBytes)*100)/SlabBytes));
     assert(UsedBytes/one_kilo<=ULONG_MAX);
     assert(FreeBytes/one_kilo<=ULONG_MAX);
-    fprintf(f, "%12s  %10" SIZE_T_PRINTF_SPECIFIER "%10" SIZE_T_PRINTF_SPECIFIER "\n", "Total kB:",
+    fprintf(f, "%12s  %10" SIZE_T_PRINTF_SPECIFIER "%10" SIZE_T_PRINTF_SPECIFIER "%10" SIZE_T_PRINTF_SPECIFIER "\n", "Total kB:",
             (size_t_printf_type) (UsedBytes/one_kilo),
-            (size_t_printf_type) (FreeBytes/one_kilo));
+            (size_t_printf_type) (FreeBytes/one_kilo),
+            (size_t_printf_type) (SlabBytes/one_kilo));
   }
 }
 
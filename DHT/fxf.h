@@ -8,11 +8,12 @@ int fxfInitialised(void);
 void *fxfAlloc(size_t size);
 void *fxfReAlloc(void *ptr, size_t OldSize, size_t NewSize);
 void fxfFree(void *ptr, size_t size);
-void fxfInfo(FILE *);
+void fxfInfo(FILE *); /* includes the fragmentation of each size's slabs */
 size_t fxfTotal(void);
 
 /* Reset the internal data structures to the state that was reached
- * after the latest call to fxfInit() */
+ * after the latest call to fxfInit(), releasing all allocated chunks at
+ * once. Takes the same time however many chunks have been allocated. */
 void fxfReset(void);
 
 /* Free all the associated memory. */
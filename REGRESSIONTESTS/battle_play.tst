@@ -57,9 +57,9 @@ solution finished.
    1.Se8-c7 # !
 
   add_to_move_generation_stack:           4
-                     play_move:           4
- is_white_king_square_attacked:           1
- is_black_king_square_attacked:           5
+                     play_move:           1
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -132,9 +132,9 @@ solution finished.
       1...Se8-g7
           2.Sd5-c7 #
   add_to_move_generation_stack:          51
-                     play_move:          48
- is_white_king_square_attacked:          10
- is_black_king_square_attacked:          50
+                     play_move:          10
+ is_white_king_square_attacked:           5
+ is_black_king_square_attacked:           7
 
 solution finished.
 
@@ -175,9 +175,9 @@ solution finished.
       1...Se8-g7
           2.Sd5-c7 #
   add_to_move_generation_stack:          64
-                     play_move:          58
- is_white_king_square_attacked:          12
- is_black_king_square_attacked:          60
+                     play_move:          13
+ is_white_king_square_attacked:           6
+ is_black_king_square_attacked:           8
 
 solution finished.
 
@@ -212,9 +212,9 @@ solution finished.
    1.Se8-c7 # !
 
   add_to_move_generation_stack:          63
-                     play_move:          44
- is_white_king_square_attacked:          13
- is_black_king_square_attacked:          47
+                     play_move:          21
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:          15
 
 solution finished.
 
@@ -319,9 +319,9 @@ solution finished.
    1.Rc3-b3 #= !
 
   add_to_move_generation_stack:        1649
-                     play_move:         764
- is_white_king_square_attacked:         295
- is_black_king_square_attacked:         484
+                     play_move:         512
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -357,9 +357,9 @@ solution finished.
           2.Sa4-b6 #
 
   add_to_move_generation_stack:          75
-                     play_move:          57
- is_white_king_square_attacked:          19
- is_black_king_square_attacked:          60
+                     play_move:          25
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:          16
 
 solution finished.
 
@@ -396,9 +396,9 @@ solution finished.
           2.Rc5-c8 #
 
   add_to_move_generation_stack:         274
-                     play_move:         160
- is_white_king_square_attacked:          46
- is_black_king_square_attacked:         162
+                     play_move:          81
+ is_white_king_square_attacked:           3
+ is_black_king_square_attacked:          42
 
 solution finished.
 
@@ -433,9 +433,9 @@ the side to play can capture the king
           2.Rc5-c8 #
 
   add_to_move_generation_stack:         108
-                     play_move:          53
- is_white_king_square_attacked:          25
- is_black_king_square_attacked:          56
+                     play_move:          23
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:          15
 
 solution finished.
 
@@ -483,10 +483,10 @@ solution finished.
           2.Se6-c7 #
       1...Se8-g7
           2.Se6-c7 #
-  add_to_move_generation_stack:         403
-                     play_move:         233
- is_white_king_square_attacked:          58
- is_black_king_square_attacked:         211
+  add_to_move_generation_stack:         349
+                     play_move:          96
+ is_white_king_square_attacked:          10
+ is_black_king_square_attacked:          29
 
 solution finished.
 
@@ -544,10 +544,10 @@ solution finished.
       1...Se8-g7
           2.Se6-c7 #
 
-  add_to_move_generation_stack:        3375
-                     play_move:        2379
- is_white_king_square_attacked:        1408
- is_black_king_square_attacked:        1082
+  add_to_move_generation_stack:        2809
+                     play_move:         566
+ is_white_king_square_attacked:          14
+ is_black_king_square_attacked:         202
 
 solution finished.
 
@@ -578,9 +578,9 @@ solution finished.
 
       1...b3-b2 #
   add_to_move_generation_stack:          21
-                     play_move:          21
- is_white_king_square_attacked:          22
- is_black_king_square_attacked:           5
+                     play_move:           1
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -613,9 +613,9 @@ solution finished.
       1...b3-b2 #
 
   add_to_move_generation_stack:         106
-                     play_move:          73
- is_white_king_square_attacked:          73
- is_black_king_square_attacked:          25
+                     play_move:          27
+ is_white_king_square_attacked:          14
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -649,9 +649,9 @@ s#1 with incomplete set play (not given)
       1...b3-b2 #
 
   add_to_move_generation_stack:         104
-                     play_move:          71
- is_white_king_square_attacked:          69
- is_black_king_square_attacked:          29
+                     play_move:          27
+ is_white_king_square_attacked:          15
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -686,9 +686,9 @@ solution finished.
       1...b3-b2 #
 
   add_to_move_generation_stack:         160
-                     play_move:         123
- is_white_king_square_attacked:         124
- is_black_king_square_attacked:          38
+                     play_move:          28
+ is_white_king_square_attacked:          17
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -745,9 +745,9 @@ solution finished.
       1...b3-b2 + !
 
   add_to_move_generation_stack:         233
-                     play_move:         221
- is_white_king_square_attacked:         197
- is_black_king_square_attacked:         125
+                     play_move:          66
+ is_white_king_square_attacked:          38
+ is_black_king_square_attacked:           8
 
 solution finished.
 
@@ -815,9 +815,9 @@ solution finished.
       1...e4*f3 ep.
 
   add_to_move_generation_stack:          18
-                     play_move:          18
- is_white_king_square_attacked:          11
- is_black_king_square_attacked:          10
+                     play_move:          10
+ is_white_king_square_attacked:           1
+ is_black_king_square_attacked:           4
 
 solution finished.
 
@@ -851,9 +851,9 @@ solution finished.
           2.Qd1-g4
               2...b3-b2 #
   add_to_move_generation_stack:         255
-                     play_move:         176
- is_white_king_square_attacked:         178
- is_black_king_square_attacked:          79
+                     play_move:          81
+ is_white_king_square_attacked:          43
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -888,9 +888,9 @@ solution finished.
               2...b3-b2 #
 
   add_to_move_generation_stack:        3033
-                     play_move:        1532
- is_white_king_square_attacked:        1533
- is_black_king_square_attacked:         859
+                     play_move:        1135
+ is_white_king_square_attacked:         564
+ is_black_king_square_attacked:           4
 
 solution finished.
 
@@ -923,9 +923,9 @@ solution finished.
       1...b3-b2 #
 
   add_to_move_generation_stack:         801
-                     play_move:         361
- is_white_king_square_attacked:         361
- is_black_king_square_attacked:         180
+                     play_move:         273
+ is_white_king_square_attacked:         135
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1002,9 +1002,9 @@ solution finished.
               2...b3-b2 #
 
   add_to_move_generation_stack:        3136
-                     play_move:        1659
- is_white_king_square_attacked:        1662
- is_black_king_square_attacked:         852
+                     play_move:        1080
+ is_white_king_square_attacked:         542
+ is_black_king_square_attacked:           6
 
 solution finished.
 
@@ -1041,9 +1041,9 @@ solution finished.
               2...b3-b2 #
 
   add_to_move_generation_stack:         747
-                     play_move:         428
- is_white_king_square_attacked:         430
- is_black_king_square_attacked:         155
+                     play_move:         183
+ is_white_king_square_attacked:          94
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1105,9 +1105,9 @@ solution finished.
       1...Kc2*d2 !
 
   add_to_move_generation_stack:        3446
-                     play_move:        2010
- is_white_king_square_attacked:        1997
- is_black_king_square_attacked:         931
+                     play_move:         790
+ is_white_king_square_attacked:         403
+ is_black_king_square_attacked:          17
 
 solution finished.
 
@@ -1138,9 +1138,9 @@ solution finished.
 
       1...Se1-c2 #
   add_to_move_generation_stack:           4
-                     play_move:           4
- is_white_king_square_attacked:           5
- is_black_king_square_attacked:           2
+                     play_move:           1
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -1173,9 +1173,9 @@ solution finished.
       1...Se1-c2 #
 
   add_to_move_generation_stack:          30
-                     play_move:          21
- is_white_king_square_attacked:          21
- is_black_king_square_attacked:           7
+                     play_move:          12
+ is_white_king_square_attacked:           7
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -1210,9 +1210,9 @@ solution finished.
       1...Se1-c2 #
 
   add_to_move_generation_stack:          19
-                     play_move:          19
- is_white_king_square_attacked:          20
- is_black_king_square_attacked:           5
+                     play_move:           4
+ is_white_king_square_attacked:           4
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -1243,9 +1243,9 @@ solution finished.
 
    1.Bg7-f8 # ?!?
   add_to_move_generation_stack:           7
-                     play_move:           7
- is_white_king_square_attacked:           2
- is_black_king_square_attacked:           8
+                     play_move:           3
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1279,9 +1279,9 @@ solution finished.
           2.Sc1-e2
               2...b3-b2 #
   add_to_move_generation_stack:          52
-                     play_move:          45
- is_white_king_square_attacked:          44
- is_black_king_square_attacked:          10
+                     play_move:          15
+ is_white_king_square_attacked:           6
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1312,9 +1312,9 @@ solution finished.
 
       1...b3-b2 #
   add_to_move_generation_stack:           5
-                     play_move:           5
- is_white_king_square_attacked:           6
- is_black_king_square_attacked:           2
+                     play_move:           1
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -1349,9 +1349,9 @@ solution finished.
               2...b3-b2 #
 
   add_to_move_generation_stack:         315
-                     play_move:         244
- is_white_king_square_attacked:         197
- is_black_king_square_attacked:          77
+                     play_move:         156
+ is_white_king_square_attacked:          14
+ is_black_king_square_attacked:          16
 
 solution finished.
 
@@ -1386,9 +1386,9 @@ r#2 with short set play and short solution
       1...b3-b2 #
 
   add_to_move_generation_stack:          24
-                     play_move:          24
- is_white_king_square_attacked:          25
- is_black_king_square_attacked:           6
+                     play_move:           5
+ is_white_king_square_attacked:           5
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -1423,9 +1423,9 @@ exact r#2 that would have a solution in 1
               2...c2-c1=Q #
 
   add_to_move_generation_stack:         845
-                     play_move:         597
- is_white_king_square_attacked:         556
- is_black_king_square_attacked:         170
+                     play_move:         328
+ is_white_king_square_attacked:         131
+ is_black_king_square_attacked:          14
 
 solution finished.
 
@@ -1456,9 +1456,9 @@ r#2, but White must deliver mate immediately
 
    1.Bg7-f8 # ?!?
   add_to_move_generation_stack:           7
-                     play_move:           7
- is_white_king_square_attacked:           2
- is_black_king_square_attacked:           8
+                     play_move:           3
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1493,10 +1493,10 @@ solution finished.
               2...b4-b3
                   3.Bc2-b1
                       3...b3-b2 #
-  add_to_move_generation_stack:         859
-                     play_move:         757
- is_white_king_square_attacked:         695
- is_black_king_square_attacked:         143
+  add_to_move_generation_stack:         794
+                     play_move:         511
+ is_white_king_square_attacked:          72
+ is_black_king_square_attacked:           8
 
 solution finished.
 
@@ -1548,10 +1548,10 @@ solution finished.
 
  15  (Sd8-e6 )
  16  (Sd8-f7 )
-  add_to_move_generation_stack:        8466
-                     play_move:        6252
- is_white_king_square_attacked:        5550
- is_black_king_square_attacked:        1181
+  add_to_move_generation_stack:        8656
+                     play_move:        6438
+ is_white_king_square_attacked:        5657
+ is_black_king_square_attacked:        1326
 
 solution finished.
 
@@ -1582,9 +1582,9 @@ r#3, but White must deliver mate immediately
 
    1.Bg7-f8 # ?!?
   add_to_move_generation_stack:           7
-                     play_move:           7
- is_white_king_square_attacked:           2
- is_black_king_square_attacked:           8
+                     play_move:           3
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -1614,8 +1614,8 @@ a r#2 solution does not solve an exact r#3
   exact-r#3                   2 + 1
 
   add_to_move_generation_stack:        1100
-                     play_move:         470
- is_white_king_square_attacked:         453
+                     play_move:         291
+ is_white_king_square_attacked:         114
  is_black_king_square_attacked:           0
 
 solution finished.
@@ -1661,9 +1661,9 @@ would have to deliver mate (issue 2843251)
               2...d2*e1=R #
 
   add_to_move_generation_stack:         484
-                     play_move:         349
- is_white_king_square_attacked:         329
- is_black_king_square_attacked:          78
+                     play_move:         184
+ is_white_king_square_attacked:          78
+ is_black_king_square_attacked:          15
 
 solution finished.
 
@@ -1694,9 +1694,9 @@ solution finished.
 
       1...b3-b2 #
   add_to_move_generation_stack:           4
-                     play_move:           4
- is_white_king_square_attacked:           5
- is_black_king_square_attacked:           2
+                     play_move:           1
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -1729,9 +1729,9 @@ solution finished.
       1...b3-b2 #
 
   add_to_move_generation_stack:         104
-                     play_move:          59
- is_white_king_square_attacked:          59
- is_black_king_square_attacked:          10
+                     play_move:          20
+ is_white_king_square_attacked:           7
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -1798,9 +1798,9 @@ semi-r#2 with short solution; White needn't deliver mate immediately
       1...b3-b2 #
 
   add_to_move_generation_stack:         225
-                     play_move:         160
- is_white_king_square_attacked:         148
- is_black_king_square_attacked:          30
+                     play_move:          51
+ is_white_king_square_attacked:          13
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -1853,10 +1853,10 @@ solution finished.
           2.Rh5-h8 +
               2...Ke8-f7
                   3.Rh8-f8 #
-  add_to_move_generation_stack:       19409
-                     play_move:       15662
- is_white_king_square_attacked:        8665
- is_black_king_square_attacked:        8372
+  add_to_move_generation_stack:       18800
+                     play_move:        2513
+ is_white_king_square_attacked:           9
+ is_black_king_square_attacked:        1500
 
 solution finished.
 
@@ -0,0 +1,196 @@
+
+help play without solution - all positions go through the hash table
+
++---a---b---c---d---e---f---g---h---+
+|                                   |
+8   .   .   .   .   .  -K   .   .   8
+|                                   |
+7   .   .   .   .   .   .   .   .   7
+|                                   |
+6   .   .   .   .   .   .   .  -B   6
+|                                   |
+5   .   .   .   .   .   .   .   .   5
+|                                   |
+4   .   .   .   .   .   .   .   .   4
+|                                   |
+3   .   .   .   .   .   .   .   P   3
+|                                   |
+2   .   .   .   .   .   .   .   .   2
+|                                   |
+1   R   .   .   .   K   .   .   .   1
+|                                   |
++---a---b---c---d---e---f---g---h---+
+  h#3                         3 + 2
+
+  add_to_move_generation_stack:      504553
+                     play_move:      227002
+ is_white_king_square_attacked:         834
+ is_black_king_square_attacked:       46762
+
+solution finished.
+
+
+
+              help play
+
++---a---b---c---d---e---f---g---h---+
+|                                   |
+8   .  -K   .   .   .   .   .   .   8
+|                                   |
+7   .   .   .   .   .   .   .   .   7
+|                                   |
+6   K   .   .   .   .   .   .   .   6
+|                                   |
+5   .   .   .   .   .   .   .   .   5
+|                                   |
+4   .   .   S   .   .   .   .   .   4
+|                                   |
+3   .   .   .   .   .   .   .   .   3
+|                                   |
+2   .   .   .   .   .   .   .   B   2
+|                                   |
+1   .   .   .   .   .   .   .   .   1
+|                                   |
++---a---b---c---d---e---f---g---h---+
+  h#3                         3 + 1
+
+  1.Kb8-a8 Sc4-b6 #
+  1.Kb8-a8 Bh2-g1   2.Ka8-b8 Bg1-h2 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-a8 Bh2-g1   2.Ka8-b8 Bg1-a7 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-a8 Sc4-e5   2.Ka8-b8 Se5-c4 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-a8 Sc4-e5   2.Ka8-b8 Se5-d7 +   3.Kb8-a8 Sd7-b6 #
+  1.Kb8-a8 Sc4-d6   2.Ka8-b8 Sd6-c4 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-a8 Sc4-d6   2.Ka8-b8 Sd6-c8 +   3.Kb8-a8 Sc8-b6 #
+  1.Kb8-c8 Bh2-g1   2.Kc8-c7 Sc4-b6   3.Kc7-b8 Bg1-h2 #
+  1.Kb8-c8 Bh2-g1   2.Kc8-b8 Bg1-h2 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-c8 Bh2-g1   2.Kc8-b8 Bg1-a7 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-c8 Sc4-e5   2.Kc8-b8 Se5-c4 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-c8 Sc4-e5   2.Kc8-b8 Se5-d7 +   3.Kb8-a8 Sd7-b6 #
+  1.Kb8-c8 Sc4-d6 +   2.Kc8-b8 Sd6-c4 +   3.Kb8-a8 Sc4-b6 #
+  1.Kb8-c8 Sc4-d6 +   2.Kc8-b8 Sd6-c8 +   3.Kb8-a8 Sc8-b6 #
+  add_to_move_generation_stack:       17352
+                     play_move:        6698
+ is_white_king_square_attacked:          41
+ is_black_king_square_attacked:        1660
+
+solution finished.
+
+
+
+    direct play without solution
+
++---a---b---c---d---e---f---g---h---+
+|                                   |
+8   .   .   .   Q   .   .  -R  -K   8
+|                                   |
+7   .   .   .   .   .   .  -P  -B   7
+|                                   |
+6   .   .   .   .   .   .   .  -P   6
+|                                   |
+5   .   .   .   .   .   .   .   .   5
+|                                   |
+4   .   .  -P   S   .   .   .   .   4
+|                                   |
+3   .   .   .   .   .   .   .   .   3
+|                                   |
+2   .   .   .   .   .   .   .   .   2
+|                                   |
+1   .   .   .   .   .   R   K   .   1
+|                                   |
++---a---b---c---d---e---f---g---h---+
+  #5                          4 + 6
+
+  add_to_move_generation_stack:    12726125
+                     play_move:     1267619
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:      571776
+
+solution finished.
+
+
+
+        self and reflex play
+
++---a---b---c---d---e---f---g---h---+
+|                                   |
+8   .   .   .   .   .   .   .   .   8
+|                                   |
+7   .   .   .   .   .   .   .   .   7
+|                                   |
+6   .   .   .   .   .   .   .   .   6
+|                                   |
+5   .   .   .   .   .   .   .   .   5
+|                                   |
+4   .  -P   .   .   .   .   Q   .   4
+|                                   |
+3  -K   .   .   .   .   .   .   .   3
+|                                   |
+2  -P   .   .   .   .   .   .   .   2
+|                                   |
+1   K   .   .   .   .   .   .   G   1
+|                                   |
++---a---b---c---d---e---f---g---h---+
+  s#4                         3 + 3
+
+a) 
+
+   1.Qg4-d1 ! zugzwang.
+      1...b4-b3
+          2.Qd1-g4
+              2...b3-b2 #
+
+   1.Qg4-d7 ! threat:
+          2.Qd7-d1 zugzwang.
+              2...b4-b3
+                  3.Qd1-g4
+                      3...b3-b2 #
+      1...Ka3-b3
+          2.Qd7-c6 zugzwang.
+              2...Kb3-a3
+                  3.Gh1-b7 zugzwang.
+                      3...b4-b3
+                          4.Qc6-e4
+                              4...b3-b2 #
+                          4.Qc6-c4
+                              4...b3-b2 #
+                  3.Qc6-c2 zugzwang.
+                      3...b4-b3
+                          4.Qc2-e4
+                              4...b3-b2 #
+                          4.Qc2-c4
+                              4...b3-b2 #
+
+  add_to_move_generation_stack:      251506
+                     play_move:      133209
+ is_white_king_square_attacked:      130095
+ is_black_king_square_attacked:       49882
+
+b) r#3  
+
+   1.Qg4-d1 ! zugzwang.
+      1...b4-b3
+          2.Qd1-h5
+              2...b3-b2 #
+          2.Qd1-g4
+              2...b3-b2 #
+          2.Qd1-d8
+              2...b3-b2 #
+          2.Qd1-d7
+              2...b3-b2 #
+          2.Qd1-d5
+              2...b3-b2 #
+          2.Qd1-g1
+              2...b3-b2 #
+          2.Qd1-f1
+              2...b3-b2 #
+          2.Qd1-e1
+              2...b3-b2 #
+
+  add_to_move_generation_stack:       33875
+                     play_move:       24620
+ is_white_king_square_attacked:       17405
+ is_black_king_square_attacked:       10038
+
+solution finished.
+
+
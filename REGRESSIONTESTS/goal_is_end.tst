@@ -71,7 +71,7 @@ solution finished.
                                       5...a2-a1=B c81
 
   add_to_move_generation_stack:          79
-                     play_move:         102
+                     play_move:          91
  is_white_king_square_attacked:           0
  is_black_king_square_attacked:           0
 
@@ -144,10 +144,10 @@ post-key play
       1...Bh4-f6
           2.Rf1*f6 threat:
                   3.Rf6-f8 c81
-  add_to_move_generation_stack:         620
-                     play_move:         122
- is_white_king_square_attacked:          34
- is_black_king_square_attacked:          54
+  add_to_move_generation_stack:         550
+                     play_move:          98
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           6
 
 solution finished.
 
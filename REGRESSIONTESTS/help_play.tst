@@ -57,9 +57,9 @@ h#1 with set play, but black king is in check
 the side to play can capture the king
   1.Kb8-a8 Sc4-b6 #
   add_to_move_generation_stack:          21
-                     play_move:          18
- is_white_king_square_attacked:           5
- is_black_king_square_attacked:          19
+                     play_move:           7
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           4
 
 solution finished.
 
@@ -92,7 +92,7 @@ solution finished.
   add_to_move_generation_stack:           9
                      play_move:           5
  is_white_king_square_attacked:           3
- is_black_king_square_attacked:           5
+ is_black_king_square_attacked:           1
 
 solution finished.
 
@@ -123,9 +123,9 @@ solution finished.
 
   1...h3-h4   2.Bh6-g7 0-0-0
   add_to_move_generation_stack:         384
-                     play_move:         192
- is_white_king_square_attacked:          51
- is_black_king_square_attacked:         168
+                     play_move:         180
+ is_white_king_square_attacked:          35
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -222,9 +222,9 @@ solution finished.
 
   1.Qb5-e2 Ka3-b3   2.Qe2-b2 + c3*b2 #
   add_to_move_generation_stack:       11919
-                     play_move:       10485
- is_white_king_square_attacked:        9129
- is_black_king_square_attacked:        2754
+                     play_move:        5517
+ is_white_king_square_attacked:        2292
+ is_black_king_square_attacked:         440
 
 solution finished.
 
@@ -255,9 +255,9 @@ hr#1.5 - don't write long solutions because Black must mate immediately
 
   1...b3-b2 #
   add_to_move_generation_stack:          10
-                     play_move:          10
- is_white_king_square_attacked:          11
- is_black_king_square_attacked:           2
+                     play_move:           2
+ is_white_king_square_attacked:           3
+ is_black_king_square_attacked:           0
 
 solution finished.
 
@@ -288,9 +288,9 @@ hr#2 - don't write long solutions because Black must mate immediately
 
   1.f3-f4 b3-b2 #
   add_to_move_generation_stack:          18
-                     play_move:          18
- is_white_king_square_attacked:          18
- is_black_king_square_attacked:           4
+                     play_move:           4
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -354,9 +354,9 @@ solution finished.
 
   1.Qf6-d8 # ?!?
   add_to_move_generation_stack:          76
-                     play_move:          63
- is_white_king_square_attacked:           8
- is_black_king_square_attacked:          64
+                     play_move:          15
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           9
 
 solution finished.
 
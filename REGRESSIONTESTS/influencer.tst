@@ -263,10 +263,10 @@ solution finished.
       1...Kd5*e6 !
       1...Kd5-c5 !
 
-  add_to_move_generation_stack:      226546
-                     play_move:       86396
- is_white_king_square_attacked:       34255
- is_black_king_square_attacked:       68889
+  add_to_move_generation_stack:      192709
+                     play_move:       84897
+ is_white_king_square_attacked:       34009
+ is_black_king_square_attacked:       67394
 
 solution finished.
 
@@ -355,10 +355,10 @@ solution finished.
                                       5...a6-a5
                                           6.Sb3-c5[b5=P][b4=P] #
 
-  add_to_move_generation_stack:      846931
-                     play_move:      639748
- is_white_king_square_attacked:      544317
- is_black_king_square_attacked:      103201
+  add_to_move_generation_stack:      693869
+                     play_move:      639941
+ is_white_king_square_attacked:      544293
+ is_black_king_square_attacked:      103394
 
 solution finished.
 
@@ -24,9 +24,9 @@
 
   1...e7-e8=B   2.Kd3-e2 Be8-h5   3.Bh7-d3 Rg4-e4 #
   add_to_move_generation_stack:       34585
-                     play_move:       35413
- is_white_king_square_attacked:        1367
- is_black_king_square_attacked:        2430
+                     play_move:       26976
+ is_white_king_square_attacked:         151
+ is_black_king_square_attacked:         254
 
 solution finished.
 
@@ -57,9 +57,9 @@ solution finished.
 
   1...e3*d4   2.Sf7-e5 d4*e5 #
   add_to_move_generation_stack:         103
-                     play_move:         103
- is_white_king_square_attacked:           4
- is_black_king_square_attacked:          33
+                     play_move:          73
+ is_white_king_square_attacked:           1
+ is_black_king_square_attacked:           3
 
 solution finished.
 
@@ -90,9 +90,9 @@ double check by en passant capture from above
 
   1...Bh6-g7 +   2.e7-e5 d5*e6 ep. #
   add_to_move_generation_stack:         232
-                     play_move:         223
- is_white_king_square_attacked:          11
- is_black_king_square_attacked:          37
+                     play_move:         161
+ is_white_king_square_attacked:           5
+ is_black_king_square_attacked:           6
 
 solution finished.
 
@@ -123,9 +123,9 @@ double check by en passant capture from below
 
   1...Bb2-a3 +   2.c7-c5 d5*c6 ep. #
   add_to_move_generation_stack:         706
-                     play_move:         633
- is_white_king_square_attacked:          39
- is_black_king_square_attacked:         119
+                     play_move:         474
+ is_white_king_square_attacked:          23
+ is_black_king_square_attacked:          25
 
 solution finished.
 
@@ -156,9 +156,9 @@ interception of a defending pawn by a piece that doesn't guard
 
   1.Sc8-b6   2.Bh3-f1 #
   add_to_move_generation_stack:         110
-                     play_move:          99
+                     play_move:          71
  is_white_king_square_attacked:           0
- is_black_king_square_attacked:          63
+ is_black_king_square_attacked:          23
 
 solution finished.
 
@@ -189,9 +189,9 @@ guard with check -> selfpin with check -> selfpin with guard by s
 
   1...Rh1-h3 #
   add_to_move_generation_stack:         133
-                     play_move:         117
- is_white_king_square_attacked:          14
- is_black_king_square_attacked:         102
+                     play_move:          37
+ is_white_king_square_attacked:          13
+ is_black_king_square_attacked:          15
 
 solution finished.
 
@@ -222,9 +222,9 @@ guard with check -> selfpin with check -> selfpin with guard by b
 
   1...Sh6-g4 #
   add_to_move_generation_stack:          25
-                     play_move:          23
- is_white_king_square_attacked:           3
- is_black_king_square_attacked:          21
+                     play_move:           7
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           4
 
 solution finished.
 
@@ -256,9 +256,9 @@ in mate stipulations, it makes sense to pin a queen or rook by a
 
   1...Sc5-d3 #
   add_to_move_generation_stack:          24
-                     play_move:          21
+                     play_move:          10
  is_white_king_square_attacked:           0
- is_black_king_square_attacked:          17
+ is_black_king_square_attacked:           4
 
 solution finished.
 
@@ -121,8 +121,8 @@ solution finished.
 
   1.Sb5-d4   2.Sd4*e2   3.0-0
   add_to_move_generation_stack:         862
-                     play_move:         407
- is_white_king_square_attacked:         467
+                     play_move:         365
+ is_white_king_square_attacked:          61
  is_black_king_square_attacked:         368
 
 solution finished.
@@ -154,9 +154,9 @@ solution finished.
 
   1.Qb5-e2   2.Qe2-b2 + c3*b2 #
   add_to_move_generation_stack:        1198
-                     play_move:        1048
- is_white_king_square_attacked:         698
- is_black_king_square_attacked:         484
+                     play_move:         726
+ is_white_king_square_attacked:          12
+ is_black_king_square_attacked:         122
 
 solution finished.
 
@@ -221,9 +221,9 @@ no solution in 2 - Black has to deliver mate immediately
 
   1.h3-h4 b3-b2 #
   add_to_move_generation_stack:          18
-                     play_move:          18
- is_white_king_square_attacked:          18
- is_black_king_square_attacked:           4
+                     play_move:           4
+ is_white_king_square_attacked:           2
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -254,9 +254,9 @@ stop solving when the goal is reached
 
   1.h3-h4 Ka8*a7 x
   add_to_move_generation_stack:          11
-                     play_move:          11
+                     play_move:           5
  is_white_king_square_attacked:           0
- is_black_king_square_attacked:          11
+ is_black_king_square_attacked:           2
 
 solution finished.
 
@@ -23,9 +23,9 @@
 
   1...Rb1*c1 #
   add_to_move_generation_stack:          11
-                     play_move:          14
- is_white_king_square_attacked:           1
- is_black_king_square_attacked:          15
+                     play_move:           1
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           2
 
 solution finished.
 
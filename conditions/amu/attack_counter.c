@@ -14,12 +14,19 @@
 #include "debugging/assert.h"
 #include "solving/post_move_iteration.h"
 
-boolean amu_attacked_exactly_once[maxply+1];
+boolean *amu_attacked_exactly_once;
 
 static square single_attacker_departure;
 static unsigned int amu_attack_count;
 static boolean are_we_counting = false;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void amu_attack_counter_allocate_ply_tables(void)
+{
+  amu_attacked_exactly_once = ply_allocate_table(maxply+1,sizeof amu_attacked_exactly_once[0]);
+}
+
 boolean amu_count_observation(slice_index si)
 {
   boolean result;
@@ -6,7 +6,7 @@
 
 /* This module implements the condition Traitor Chess */
 
-extern boolean amu_attacked_exactly_once[maxply+1];
+extern boolean *amu_attacked_exactly_once;
 
 boolean amu_count_observation(slice_index si);
 
@@ -29,4 +29,8 @@ void amu_attack_counter_solve(slice_index si);
  */
 void solving_insert_amu_attack_counter(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void amu_attack_counter_allocate_ply_tables(void);
+
 #endif
@@ -83,7 +83,14 @@ static boolean exists_legal_move_back_home(void)
   return result;
 }
 
-static boolean exists[maxply+1];
+static boolean *exists;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void backhome_allocate_ply_tables(void)
+{
+  exists = ply_allocate_table(maxply+1,sizeof exists[0]);
+}
 
 static boolean goes_back_home_or_neednt(numecoup n)
 {
@@ -67,4 +67,8 @@ void back_home_moves_only_solve(slice_index si);
  */
 void backhome_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void backhome_allocate_ply_tables(void);
+
 #endif
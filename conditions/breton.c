@@ -16,7 +16,14 @@ breton_mode_type breton_mode;
 breton_chromaticity_type breton_chromaticity;
 breton_implementation_quirks breton_implementation_quirk;
 
-static square const *breton_state[maxply+1];
+static square const **breton_state;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void breton_allocate_ply_tables(void)
+{
+  breton_state = ply_allocate_table(maxply+1,sizeof breton_state[0]);
+}
 
 static boolean advance_breton_victim_position(slice_index si,
                                               move_effect_journal_index_type const capture,
@@ -47,4 +47,8 @@ void breton_applier_solve(slice_index si);
  */
 void solving_insert_breton(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void breton_allocate_ply_tables(void);
+
 #endif
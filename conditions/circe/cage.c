@@ -25,7 +25,14 @@ static enum
   serching_for_cage,
   cage_found,
   proved_there_is_no_cage
-} cage_search_status[maxply+1];
+} *cage_search_status;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_cage_allocate_ply_tables(void)
+{
+  cage_search_status = ply_allocate_table(maxply+1,sizeof cage_search_status[0]);
+}
 
 static void do_substitute(slice_index si,
                                                    stip_structure_traversal *st)
@@ -65,4 +65,8 @@ void circe_cage_futile_captures_remover_solve(slice_index si);
  */
 void circe_cage_optimise_away_futile_captures(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_cage_allocate_ply_tables(void);
+
 #endif
@@ -197,7 +197,7 @@ void circe_insert_slices(slice_index si,
 
 circe_variant_type circe_variant;
 
-circe_rebirth_context_elmt_type circe_rebirth_context_stack[maxply+1];
+circe_rebirth_context_elmt_type *circe_rebirth_context_stack;
 circe_rebirth_context_index circe_rebirth_context_stack_pointer = 0;
 
 static circe_variant_type const circe_variant_default = {
@@ -207,6 +207,13 @@ static circe_variant_type const circe_variant_default = {
     .anticirce_type = anticirce_type_count
 };
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_allocate_ply_tables(void)
+{
+  circe_rebirth_context_stack = ply_allocate_table(maxply+1,sizeof circe_rebirth_context_stack[0]);
+}
+
 /* Reset a circe_variant object to the default values
  * @param variant address of the variant object to be reset
  */
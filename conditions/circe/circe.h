@@ -69,7 +69,7 @@ typedef struct
     Side rebirth_as;
 } circe_rebirth_context_elmt_type;
 
-extern circe_rebirth_context_elmt_type circe_rebirth_context_stack[maxply+1];
+extern circe_rebirth_context_elmt_type *circe_rebirth_context_stack;
 
 typedef unsigned int circe_rebirth_context_index;
 
@@ -187,4 +187,8 @@ void circe_insert_slices(slice_index si,
                          slice_index const prototypes[],
                          unsigned int nr_prototypes);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_allocate_ply_tables(void);
+
 #endif
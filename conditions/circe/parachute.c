@@ -203,7 +203,14 @@ void circe_parachute_remember_solve(slice_index si)
   TraceFunctionResultEnd();
 }
 
-static boolean volcanic_rebirth[maxply+1];
+static boolean *volcanic_rebirth;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_parachute_allocate_ply_tables(void)
+{
+  volcanic_rebirth = ply_allocate_table(maxply+1,sizeof volcanic_rebirth[0]);
+}
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
@@ -92,4 +92,8 @@ void circe_volcanic_initialise_effect_doers(void);
 void circe_volcanic_initialise_solving(slice_index si,
                                        slice_type interval_start);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void circe_parachute_allocate_ply_tables(void);
+
 #endif
@@ -13,6 +13,15 @@
 
 #include "debugging/assert.h"
 
+static boolean *iterating_over_rebirth_squares;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void supercirce_allocate_ply_tables(void)
+{
+  iterating_over_rebirth_squares = ply_allocate_table(maxply+1,sizeof iterating_over_rebirth_squares[0]);
+}
+
 /* Instrument the solving machinery with Circe Super (apart from the rebirth
  * square determination, whose instrumentation is elsewhere)
  * @param si identifies entry slice into solving machinery
@@ -95,8 +104,6 @@ static void try_no_rebirth(slice_index si)
  */
 void supercirce_no_rebirth_fork_solve(slice_index si)
 {
-  static boolean iterating_over_rebirth_squares[maxply+1];
-
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
@@ -61,4 +61,8 @@ void supercirce_determine_rebirth_square_solve(slice_index si);
  */
 void supercirce_prevent_rebirth_on_non_empty_square_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void supercirce_allocate_ply_tables(void);
+
 #endif
@@ -17,10 +17,18 @@
 
 #include "debugging/assert.h"
 
-static square rebirth_square[toppile+1];
-static numecoup take_make_circe_current_rebirth_square_index[maxply+1];
+static square *rebirth_square;
+static numecoup *take_make_circe_current_rebirth_square_index;
 static unsigned int stack_pointer = 1;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void take_make_circe_allocate_ply_tables(void)
+{
+  rebirth_square = ply_allocate_table(toppile+1,sizeof rebirth_square[0]);
+  take_make_circe_current_rebirth_square_index = ply_allocate_table(maxply+1,sizeof take_make_circe_current_rebirth_square_index[0]);
+}
+
 static boolean init_rebirth_squares(circe_rebirth_context_elmt_type const *context)
 {
   boolean result = false;
@@ -40,4 +40,8 @@ void take_make_circe_determine_rebirth_squares_solve(slice_index si);
  */
 void circe_solving_instrument_takemake(void);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void take_make_circe_allocate_ply_tables(void);
+
 #endif
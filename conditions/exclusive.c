@@ -15,13 +15,23 @@
 
 #include "debugging/assert.h"
 
-table exclusive_chess_undecidable_continuations[maxply+1];
-unsigned int exclusive_chess_nr_continuations_reaching_goal[maxply+1];
+table *exclusive_chess_undecidable_continuations;
+unsigned int *exclusive_chess_nr_continuations_reaching_goal;
 
 static Goal exclusive_goal;
 
-static unsigned int nr_decidable_continuations_not_reaching_goal[maxply+1];
-static ply ply_horizon = maxply;
+static unsigned int *nr_decidable_continuations_not_reaching_goal;
+static ply ply_horizon;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void exclusive_chess_allocate_ply_tables(void)
+{
+  exclusive_chess_undecidable_continuations = ply_allocate_table(maxply+1,sizeof exclusive_chess_undecidable_continuations[0]);
+  exclusive_chess_nr_continuations_reaching_goal = ply_allocate_table(maxply+1,sizeof exclusive_chess_nr_continuations_reaching_goal[0]);
+  nr_decidable_continuations_not_reaching_goal = ply_allocate_table(maxply+1,sizeof nr_decidable_continuations_not_reaching_goal[0]);
+  ply_horizon = maxply;
+}
 
 /* Perform the necessary verification steps for solving an Exclusive
  * Chess problem
@@ -11,8 +11,8 @@
 #include "solving/machinery/solve.h"
 #include "solving/ply.h"
 
-extern table exclusive_chess_undecidable_continuations[maxply+1];
-extern unsigned int exclusive_chess_nr_continuations_reaching_goal[maxply+1];
+extern table *exclusive_chess_undecidable_continuations;
+extern unsigned int *exclusive_chess_nr_continuations_reaching_goal;
 
 /* Perform the necessary verification steps for solving an Exclusive
  * Chess problem
@@ -93,4 +93,8 @@ void exclusive_chess_nested_exclusivity_detector_solve(slice_index si);
  */
 void exclusive_chess_goal_reaching_move_counter_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void exclusive_chess_allocate_ply_tables(void);
+
 #endif
@@ -16,12 +16,20 @@
 
 #include "debugging/assert.h"
 
-piece_walk_type current_football_substitution[maxply+1];
+piece_walk_type *current_football_substitution;
 boolean is_football_substitute[nr_piece_walks];
 piece_walk_type next_football_substitute[nr_piece_walks];
 boolean football_are_substitutes_limited;
 
-static piece_walk_type const *bench[maxply+1];
+static piece_walk_type const **bench;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void football_chess_allocate_ply_tables(void)
+{
+  current_football_substitution = ply_allocate_table(maxply+1,sizeof current_football_substitution[0]);
+  bench = ply_allocate_table(maxply+1,sizeof bench[0]);
+}
 
 /* Initialise the substitutes' bench for the current twin
  */
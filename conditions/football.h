@@ -9,7 +9,7 @@
 
 /* This module implements Football Chess */
 
-extern piece_walk_type current_football_substitution[maxply+1];
+extern piece_walk_type *current_football_substitution;
 extern boolean is_football_substitute[nr_piece_walks];
 extern piece_walk_type next_football_substitute[nr_piece_walks];
 extern boolean football_are_substitutes_limited;
@@ -37,4 +37,8 @@ void football_chess_substitutor_solve(slice_index si);
  */
 void solving_insert_football_chess(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void football_chess_allocate_ply_tables(void);
+
 #endif
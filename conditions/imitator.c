@@ -24,14 +24,18 @@
 
 square im0;                    /* position of the 1st imitator */
 
-enum
-{
-  stack_size = max_nr_promotions_per_ply*maxply+1
-};
+#define stack_size (max_nr_promotions_per_ply*maxply+1)
 
 static unsigned int stack_pointer;
 
-static boolean promotion_into_imitator_happening[stack_size];
+static boolean *promotion_into_imitator_happening;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void imitator_allocate_ply_tables(void)
+{
+  promotion_into_imitator_happening = ply_allocate_table(stack_size,sizeof promotion_into_imitator_happening[0]);
+}
 
 static numecoup skip_over_remainder_of_line(numecoup i,
                                             square sq_departure,
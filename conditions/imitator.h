@@ -79,4 +79,8 @@ void imitator_pawn_promoter_solve(slice_index si);
  */
 void solving_insert_imitator(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void imitator_allocate_ply_tables(void);
+
 #endif
@@ -8,7 +8,14 @@
 #include "stipulation/move.h"
 #include "debugging/trace.h"
 
-static boolean contact_before_move[maxply+1];
+static boolean *contact_before_move;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void newkoeko_allocate_ply_tables(void)
+{
+  contact_before_move = ply_allocate_table(maxply+1,sizeof contact_before_move[0]);
+}
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
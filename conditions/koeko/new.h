@@ -40,4 +40,8 @@ void newkoeko_legality_tester_solve(slice_index si);
  */
 void newkoeko_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void newkoeko_allocate_ply_tables(void);
+
 #endif
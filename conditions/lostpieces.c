@@ -69,6 +69,9 @@ void lostpieces_remover_solve(slice_index si)
   being_solved.spec[save_king_square_removing] = save_king_flags_removing;
   being_solved.king_square[side_removing] = save_king_square_removing;
 
+  /* we have modified the flags behind the back of the Zobrist key */
+  assert(is_zobrist_key_in_sync());
+
   {
     unsigned int i;
     for (i = 0; i!=nr_lost; ++i)
@@ -38,7 +38,14 @@ typedef struct {
 /* we remember the move ids in the element for the parent ply of the ply where we play moves
  * or attempt king captures because we have to reset the ids before creating children plies
  */
-static move_ids_with_castling_as_make_type move_ids_with_castling_as_make[maxply+1];
+static move_ids_with_castling_as_make_type *move_ids_with_castling_as_make;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void make_and_take_allocate_ply_tables(void)
+{
+  move_ids_with_castling_as_make = ply_allocate_table(maxply+1,sizeof move_ids_with_castling_as_make[0]);
+}
 
 static void remember_move_ids_of_castlings_as_makes(square sq_capture,
                                                     numecoup min_move_id,
@@ -127,6 +134,9 @@ static void generate_castling_as_make(void)
   being_solved.spec[being_solved.king_square[side_victim]] = save_spec;
   being_solved.castling_rights = save_castling_rights;
 
+  /* we have modified the flags behind the back of the Zobrist key */
+  assert(is_zobrist_key_in_sync());
+
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
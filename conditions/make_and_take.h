@@ -80,4 +80,8 @@ square make_and_take_has_move_castling_as_make(ply ply, numecoup move_id);
  */
 void solving_insert_make_and_take(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void make_and_take_allocate_ply_tables(void);
+
 #endif
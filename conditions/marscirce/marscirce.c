@@ -15,10 +15,17 @@
 #include "debugging/assert.h"
 #include "debugging/trace.h"
 
-square marscirce_rebirth_square[toppile+1];
+square *marscirce_rebirth_square;
 
 circe_variant_type marscirce_variant;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void marscirce_allocate_ply_tables(void)
+{
+  marscirce_rebirth_square = ply_allocate_table(toppile+1,sizeof marscirce_rebirth_square[0]);
+}
+
 /* Reset a circe_variant object to the default values
  * @param variant address of the variant object to be reset
  */
@@ -12,7 +12,7 @@
 /* This module provides implements the condition Mars-Circe
  */
 
-extern square marscirce_rebirth_square[toppile+1];
+extern square *marscirce_rebirth_square;
 
 extern circe_variant_type marscirce_variant;
 
@@ -122,4 +122,8 @@ void marscirce_is_square_observed_enforce_rex_exclusive(slice_index si);
  */
 void solving_initialise_marscirce(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void marscirce_allocate_ply_tables(void);
+
 #endif
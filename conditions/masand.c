@@ -14,7 +14,14 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-static square current_observer_pos[maxply+1];
+static square *current_observer_pos;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void masand_allocate_ply_tables(void)
+{
+  current_observer_pos = ply_allocate_table(maxply+1,sizeof current_observer_pos[0]);
+}
 
 /* Validate an observation or observer by making sure it's the checking piece
  * @param si identifies the validator slice
@@ -48,4 +48,8 @@ void masand_generalised_recolorer_solve(slice_index si);
  */
 void solving_insert_masand_generalised(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void masand_allocate_ply_tables(void);
+
 #endif
@@ -26,10 +26,10 @@
 #include <stdlib.h>
 
 /* mum length found so far */
-static mummer_length_type mum_length[maxply+1];
+static mummer_length_type *mum_length;
 
 /* index of last move with mum length */
-static numecoup last_candidate[maxply+1];
+static numecoup *last_candidate;
 
 static mummer_length_measurer_type mummer_measure_length[nr_sides];
 
@@ -37,6 +37,14 @@ mummer_strictness_type mummer_strictness[nr_sides];
 
 mummer_strictness_type mummer_strictness_default_side;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void mummer_allocate_ply_tables(void)
+{
+  mum_length = ply_allocate_table(maxply+1,sizeof mum_length[0]);
+  last_candidate = ply_allocate_table(maxply+1,sizeof last_candidate[0]);
+}
+
 /* Determine the length of a move for the Maximummer condition; the higher the
  * value the more likely the move is going to be played.
  * @return a value expressing the precedence of this move
@@ -107,4 +107,8 @@ void mummer_bookkeeper_solve(slice_index si);
  */
 void mummer_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void mummer_allocate_ply_tables(void);
+
 #endif
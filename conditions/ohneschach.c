@@ -16,7 +16,14 @@
 
 #include "debugging/assert.h"
 
-boolean ohneschach_undecidable_goal_detected[maxply+1];
+boolean *ohneschach_undecidable_goal_detected;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void ohneschach_allocate_ply_tables(void)
+{
+  ohneschach_undecidable_goal_detected = ply_allocate_table(maxply+1,sizeof ohneschach_undecidable_goal_detected[0]);
+}
 
 static slice_index alloc_immobility_test_branch(void)
 {
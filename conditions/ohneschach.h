@@ -7,7 +7,7 @@
 #include "solving/machinery/solve.h"
 #include "solving/ply.h"
 
-extern boolean ohneschach_undecidable_goal_detected[maxply+1];
+extern boolean *ohneschach_undecidable_goal_detected;
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
@@ -29,4 +29,8 @@ void ohneschach_stop_if_check_and_not_mate_solve(slice_index si);
  */
 void ohneschach_insert_check_guards(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void ohneschach_allocate_ply_tables(void);
+
 #endif
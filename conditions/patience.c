@@ -12,7 +12,14 @@
 #include "debugging/assert.h"
 
 boolean PatienceB;
-static square sqdep[maxply+1];
+static square *sqdep;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void patience_chess_allocate_ply_tables(void)
+{
+  sqdep = ply_allocate_table(maxply+1,sizeof sqdep[0]);
+}
 
 static boolean patience_legal(void)
 {
@@ -28,4 +28,8 @@ void solving_insert_patience_chess(slice_index si);
  */
 void patience_chess_legality_tester_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void patience_chess_allocate_ply_tables(void);
+
 #endif
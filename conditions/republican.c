@@ -28,7 +28,14 @@
 
 ConditionNumberedVariantType RepublicanType;
 
-static square king_placement[maxply+1];
+static square *king_placement;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void republican_allocate_ply_tables(void)
+{
+  king_placement = ply_allocate_table(maxply+1,sizeof king_placement[0]);
+}
 
 enum
 {
@@ -50,4 +50,8 @@ void republican_king_placer_solve(slice_index si);
  */
 void republican_type1_dead_end_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void republican_allocate_ply_tables(void);
+
 #endif
@@ -10,7 +10,14 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-singlebox_type2_latent_pawn_promotion_type singlebox_type2_latent_pawn_promotions[maxply+1];
+singlebox_type2_latent_pawn_promotion_type *singlebox_type2_latent_pawn_promotions;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void singlebox_type2_allocate_ply_tables(void)
+{
+  singlebox_type2_latent_pawn_promotions = ply_allocate_table(maxply+1,sizeof singlebox_type2_latent_pawn_promotions[0]);
+}
 
 square next_latent_pawn(square s, Side c)
 {
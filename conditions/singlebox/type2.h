@@ -16,7 +16,7 @@ typedef struct
     pieces_pawns_promotion_sequence_type promotion;
 } singlebox_type2_latent_pawn_promotion_type;
 
-extern singlebox_type2_latent_pawn_promotion_type singlebox_type2_latent_pawn_promotions[maxply+1];
+extern singlebox_type2_latent_pawn_promotion_type *singlebox_type2_latent_pawn_promotions;
 
 /* Initialise the sequence of promotions of a latent pawn
  * @param sq_prom potential promotion square
@@ -105,4 +105,8 @@ void singlebox_type2_latent_pawn_promoter_solve(slice_index si);
  */
 void singlebox_type2_legality_tester_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void singlebox_type2_allocate_ply_tables(void);
+
 #endif
@@ -19,7 +19,14 @@ static struct
 {
     square where;
     piece_walk_type what;
-} promotion[toppile+1];
+} *promotion;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void singlebox_type3_allocate_ply_tables(void)
+{
+  promotion = ply_allocate_table(toppile+1,sizeof promotion[0]);
+}
 
 /* Determine whether the move just played is legal according to Singlebox Type 3
  * @return true iff the move is legal
@@ -54,4 +54,8 @@ boolean singleboxtype3_enforce_observer_walk(slice_index si);
  */
 void singleboxtype3_generate_moves_for_piece(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void singlebox_type3_allocate_ply_tables(void);
+
 #endif
@@ -10,7 +10,14 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-static square const *current_snekked_pos[maxply+1];
+static square const **current_snekked_pos;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void snek_allocate_ply_tables(void)
+{
+  current_snekked_pos = ply_allocate_table(maxply+1,sizeof current_snekked_pos[0]);
+}
 
 static piece_walk_type const snekked_walk[Bishop+1] =
 {
@@ -46,4 +46,8 @@ void snek_circle_substitutor_solve(slice_index si);
  */
 void solving_insert_snekcircle_chess(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void snek_allocate_ply_tables(void);
+
 #endif
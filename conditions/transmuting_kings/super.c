@@ -22,12 +22,20 @@
 #include "debugging/assert.h"
 
 
-static piece_walk_type supertransmutation[toppile+1];
+static piece_walk_type *supertransmutation;
 
-static boolean exists_transmutation[maxply+1];
+static boolean *exists_transmutation;
 
 #define MAX_OTHER_LEN 1000 /* needs to be at least the max of any value that can be returned in the len functions */
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void supertransmuting_kings_allocate_ply_tables(void)
+{
+  supertransmutation = ply_allocate_table(toppile+1,sizeof supertransmutation[0]);
+  exists_transmutation = ply_allocate_table(maxply+1,sizeof exists_transmutation[0]);
+}
+
 /* the mummer logic is (ab)used to priorise transmuting king moves */
 mummer_length_type len_supertransmuting_kings(void)
 {
@@ -51,4 +51,8 @@ void supertransmuting_kings_generate_moves_for_piece(slice_index si);
  */
 void supertransmuting_kings_initialise_solving(slice_index si, Side side);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void supertransmuting_kings_allocate_ply_tables(void);
+
 #endif
@@ -18,16 +18,25 @@ piece_walk_type transmuting_kings_potential_transmutations[nr_piece_walks];
 
 boolean transmuting_kings_testing_transmutation[nr_sides];
 
-static boolean testing_with_non_transmuting_king[maxply+1];
+static boolean *testing_with_non_transmuting_king;
 
 static enum
 {
   dont_know,
   does_transmute,
   does_not_transmute
-} is_king_transmuting_as_observing_walk[maxply+1];
+} *is_king_transmuting_as_observing_walk;
 
-static boolean is_king_transmuting_as_any_walk[maxply+1];
+static boolean *is_king_transmuting_as_any_walk;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void transmuting_kings_allocate_ply_tables(void)
+{
+  testing_with_non_transmuting_king = ply_allocate_table(maxply+1,sizeof testing_with_non_transmuting_king[0]);
+  is_king_transmuting_as_observing_walk = ply_allocate_table(maxply+1,sizeof is_king_transmuting_as_observing_walk[0]);
+  is_king_transmuting_as_any_walk = ply_allocate_table(maxply+1,sizeof is_king_transmuting_as_any_walk[0]);
+}
 
 /* Initialise the sequence of king transmuters
  */
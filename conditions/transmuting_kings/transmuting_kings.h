@@ -64,4 +64,8 @@ void transmuting_king_detect_non_transmutation(slice_index si);
  */
 boolean transmuting_kings_enforce_observer_walk(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void transmuting_kings_allocate_ply_tables(void);
+
 #endif
@@ -23,7 +23,14 @@ typedef enum
   does_not_vault
 } knowledge;
 
-static knowledge is_king_vaulting[maxply+1];
+static knowledge *is_king_vaulting;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void vaulting_kings_allocate_ply_tables(void)
+{
+  is_king_vaulting = ply_allocate_table(maxply+1,sizeof is_king_vaulting[0]);
+}
 
 void reset_king_vaulters(void)
 {
@@ -44,4 +44,8 @@ boolean vaulting_kings_enforce_observer_walk(slice_index si);
  */
 void vaulting_kings_initalise_solving(slice_index si, Side side);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void vaulting_kings_allocate_ply_tables(void);
+
 #endif
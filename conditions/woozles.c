@@ -24,7 +24,14 @@ typedef enum
   is_observation_mutual
 } validation_phase;
 
-static validation_phase phase[maxply+1];
+static validation_phase *phase;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void woozles_allocate_ply_tables(void)
+{
+  phase = ply_allocate_table(maxply+1,sizeof phase[0]);
+}
 
 static void init_woozlers(void)
 {
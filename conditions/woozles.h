@@ -108,4 +108,8 @@ void biheffalumps_remove_illegal_captures_solve(slice_index si);
  */
 void biheffalumps_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void woozles_allocate_ply_tables(void);
+
 #endif
@@ -20,7 +20,14 @@
 square wormhole_positions[wormholes_capacity];
 static unsigned int nr_wormholes;
 
-unsigned int wormhole_next_transfer[maxply+1];
+unsigned int *wormhole_next_transfer;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void wormhole_allocate_ply_tables(void)
+{
+  wormhole_next_transfer = ply_allocate_table(maxply+1,sizeof wormhole_next_transfer[0]);
+}
 
 static void skip_wormhole(void)
 {
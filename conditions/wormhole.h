@@ -14,7 +14,7 @@ enum
 extern square wormhole_positions[wormholes_capacity];
 
 /* index into wormhole_positions */
-extern unsigned int wormhole_next_transfer[maxply+1];
+extern unsigned int *wormhole_next_transfer;
 
 /* Validate an observation according to Worm holes
  * @return true iff the observation is valid
@@ -56,4 +56,8 @@ void wormhole_transferer_solve(slice_index si);
  */
 void wormhole_initialse_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void wormhole_allocate_ply_tables(void);
+
 #endif
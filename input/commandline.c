@@ -1,14 +1,24 @@
 #include "input/commandline.h"
+#include "input/server.h"
+#include "input/regression_suite.h"
 #include "optimisations/hash.h"
+#include "optimisations/hash_cache.h"
 #include "output/plaintext/language_dependant.h"
 #include "output/plaintext/protocol.h"
 #include "platform/maxtime.h"
 #include "platform/maxmem.h"
 #include "input/plaintext/memory.h"
+#include "solving/ply.h"
+#include "solving/parallel/workers.h"
+#include "solving/parallel/partition.h"
+#include "solving/parallel/twins.h"
+#include "options/movenumbers/checkpoint.h"
 #include "stipulation/pipe.h"
 #include "solving/pipe.h"
+#include "solving/statistics.h"
 #include "debugging/trace.h"
 
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -52,6 +62,91 @@ static int parseCommandlineOptions(int argc, char *argv[])
       idx += 2;
       continue;
     }
+    else if (strcmp(argv[idx],"-compacthash")==0)
+    {
+      hash_use_compact_table();
+      idx++;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-maxply")==0)
+    {
+      /* ignore invalid values - use the default number of plies */
+      ply_read_maxply(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-threads")==0)
+    {
+      /* ignore invalid values - solve sequentially */
+      parallel_read_nr_workers(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-twinthreads")==0)
+    {
+      /* ignore invalid values - solve the twins sequentially */
+      parallel_read_nr_twin_workers(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-partition")==0)
+    {
+      /* ignore invalid values - solve everything */
+      parallel_read_partition(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (strcmp(argv[idx],"-merge")==0)
+    {
+      /* the remaining arguments are the partial result files */
+      parallel_merge_enable(argc-idx-1,argv+idx+1);
+      idx = argc;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-hashcache")==0)
+    {
+      hash_cache_set_directory(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-checkpoint")==0)
+    {
+      checkpoint_set_file(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-resume")==0)
+    {
+      if (!checkpoint_resume(argv[idx+1]))
+        fprintf(stderr,"couldn't read checkpoint file %s - solving from the start\n",argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (strcmp(argv[idx],"-server")==0)
+    {
+      server_enable(0);
+      idx++;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-socket")==0)
+    {
+      server_enable(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-regression-suite")==0)
+    {
+      regression_suite_enable(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
+    else if (idx+1<argc && strcmp(argv[idx],"-j")==0)
+    {
+      /* ignore invalid values - solve one input file at a time */
+      regression_suite_read_nr_jobs(argv[idx+1]);
+      idx += 2;
+      continue;
+    }
     else if (strcmp(argv[idx], "-regression")==0)
     {
       protocol_overwrite();
@@ -59,6 +154,12 @@ static int parseCommandlineOptions(int argc, char *argv[])
       idx++;
       continue;
     }
+    else if (strcmp(argv[idx], "-stats")==0)
+    {
+      statistics_enable();
+      idx++;
+      continue;
+    }
     else if (strcmp(argv[idx], "-maxtrace")==0)
     {
 #if defined(DOTRACE)
@@ -102,10 +203,26 @@ void command_line_options_parser_solve(slice_index si)
   int const argc = SLICE_U(si).command_line_options_parser.argc;
   char **argv = SLICE_U(si).command_line_options_parser.argv;
   int const idx_end_of_options = parseCommandlineOptions(argc,argv);
-  char const *filename = idx_end_of_options<argc ? argv[idx_end_of_options] : "";
-  slice_index const opener = input_plaintext_alloc_opener(filename);
 
-  slice_insertion_insert(si,&opener,1);
+  /* the table of fingerprints isn't saved to the cache */
+  if (hash_cache_is_enabled() && hash_is_compact_table_requested())
+    fputs("-hashcache has no effect in combination with -compacthash\n",stderr);
+
+  if (parallel_merge_is_enabled())
+    parallel_merge_instrument_root(si);
+  else if (server_is_enabled())
+    server_instrument_root(si);
+  else if (regression_suite_is_enabled())
+    regression_suite_instrument_root(si);
+  else
+  {
+    char const *filename = idx_end_of_options<argc ? argv[idx_end_of_options] : "";
+    slice_index const opener = input_plaintext_alloc_opener(filename);
+    slice_insertion_insert(si,&opener,1);
+
+    if (parallel_is_partitioned())
+      parallel_partition_write_header();
+  }
 
   pipe_solve_delegate(si);
 }
@@ -6,6 +6,10 @@
 #include "solving/move_generator.h"
 #include "solving/pipe.h"
 #include "solving/incomplete.h"
+#include "solving/parallel/workers.h"
+#include "solving/parallel/root_moves.h"
+#include "solving/parallel/partition.h"
+#include "solving/parallel/twins.h"
 #include "stipulation/pipe.h"
 #include "stipulation/branch.h"
 #include "stipulation/modifier.h"
@@ -73,6 +77,7 @@ void input_plaintext_problem_handle(slice_index si)
 
   InitMetaData();
   InitBoard();
+  InputResetFingerprint();
 
   ply_reset();
 
@@ -90,6 +95,12 @@ void input_plaintext_problem_handle(slice_index si)
     enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
     slice_insertion_insert(si,prototypes,nr_prototypes);
 
+    if (parallel_get_nr_workers()>1 || parallel_is_partitioned())
+      parallel_root_moves_instrument_problem(si);
+
+    if (parallel_get_nr_twin_workers()>1)
+      parallel_twins_instrument_problem(si);
+
     stipulation_modifier_instrument(si,STStipulationStarterDetector);
 
     pipe_solve_delegate(si);
@@ -38,6 +38,9 @@ static FILE *InputOriginal;
 static FILE *InputMirror;
 static fpos_t mirrorEnd;
 
+static unsigned long long const inputFingerprintBasis = 0xcbf29ce484222325ULL;
+static unsigned long long inputFingerprint = inputFingerprintBasis;
+
 char InputLine[LINESIZE];    /* This array contains the input as is */
 
 static char LineSpaceChar[] = " \t;.,";
@@ -92,6 +95,24 @@ void input_plaintext_opener_solve(slice_index si)
   }
 }
 
+/* Solve the problems read from a stream rather than from the input opened by
+ * an STInputPlainTextOpener slice
+ * @param si identifies the slice to delegate to
+ * @param stream stream positioned at the beginning of the input; has to support
+ *               fgetpos() and fsetpos(); is closed when solving is done
+ */
+void input_plaintext_solve_stream(slice_index si, FILE *stream)
+{
+  Input = stream;
+  InputOriginal = Input;
+  InputMirror = Input;
+  LastChar = ' ';
+
+  pipe_solve_delegate(si);
+
+  CloseInput();
+}
+
 slice_index input_plaintext_alloc_opener(char const *name)
 {
   slice_index const result = alloc_pipe(STInputPlainTextOpener);
@@ -116,6 +137,8 @@ static void NextChar(void)
       LastChar = (char)ch;
       if (InputMirror!=Input)
         fputc(ch,InputMirror);
+      /* FNV-1a */
+      inputFingerprint = (inputFingerprint^(unsigned char)ch)*0x100000001b3ULL;
     }
   }
 }
@@ -142,6 +165,16 @@ void InputEndReplay(void)
   memcpy(TokenLine, savedTokenLine, sizeof TokenLine);
 }
 
+void InputResetFingerprint(void)
+{
+  inputFingerprint = inputFingerprintBasis;
+}
+
+unsigned long long InputGetFingerprint(void)
+{
+  return inputFingerprint;
+}
+
 char *ReadNextTokStr(void)
 {
   while (strchr(SpaceChar,LastChar))
@@ -20,6 +20,14 @@ void input_plaintext_opener_solve(slice_index si);
 
 slice_index input_plaintext_alloc_opener(char const *name);
 
+/* Solve the problems read from a stream rather than from the input opened by
+ * an STInputPlainTextOpener slice
+ * @param si identifies the slice to delegate to
+ * @param stream stream positioned at the beginning of the input; has to support
+ *               fgetpos() and fsetpos(); is closed when solving is done
+ */
+void input_plaintext_solve_stream(slice_index si, FILE *stream);
+
 char *ReadNextTokStr(void);
 
 /* Test whether the next input token starts with a string
@@ -42,4 +50,14 @@ fpos_t InputGetPosition(void);
 void InputStartReplay(fpos_t pos);
 void InputEndReplay(void);
 
+/* Restart calculating the fingerprint of the characters read
+ */
+void InputResetFingerprint(void);
+
+/* Determine the fingerprint of the characters read (including replayed ones)
+ * since the last invokation of InputResetFingerprint()
+ * @return fingerprint
+ */
+unsigned long long InputGetFingerprint(void);
+
 #endif
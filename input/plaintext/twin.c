@@ -44,6 +44,7 @@
 #include "solving/duplex.h"
 #include "solving/proofgames.h"
 #include "solving/zeroposition.h"
+#include "solving/statistics.h"
 #include "utilities/table.h"
 #include "platform/maxmem.h"
 #include "platform/maxtime.h"
@@ -1029,6 +1030,9 @@ void solving_machinery_intro_builder_solve(slice_index si)
       slice_index const prototype = alloc_illegal_selfcheck_writer_slice();
       slice_insertion_insert(si,&prototype,1);
     }
+
+    if (statistics_is_enabled())
+      statistics_instrument_twin(si);
   }
 
   solving_impose_starter(si,SLICE_STARTER(si));
@@ -0,0 +1,574 @@
+#include "input/regression_suite.h"
+#include "input/plaintext/token.h"
+#include "output/plaintext/protocol.h"
+#include "output/plaintext/message.h"
+#include "platform/directory.h"
+#include "platform/worker.h"
+#include "platform/tmpfile.h"
+#include "solving/move_player.h"
+#include "solving/parallel/workers.h"
+#include "stipulation/pipe.h"
+#include "stipulation/slice_insertion.h"
+#include "debugging/trace.h"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+enum
+{
+  max_nr_jobs = parallel_max_nr_workers,
+  max_protocol_name_length = 255
+};
+
+static char const *suite_dir;
+static unsigned int nr_jobs = 1;
+
+typedef enum
+{
+  comparison_identical,
+  comparison_different,
+  comparison_no_reference,
+  comparison_no_protocol,
+  comparison_failed
+} comparison_type;
+
+/* What a worker communicates to the master about the input file it solved
+ */
+typedef struct
+{
+    int volatile is_done;
+    unsigned long msec;
+    unsigned long nr_moves;
+    char protocol[max_protocol_name_length+1];
+} job_record_type;
+
+/* Enable running a regression test suite
+ * @param dir path of the directory containing the input files
+ */
+void regression_suite_enable(char const *dir)
+{
+  suite_dir = dir;
+}
+
+/* Read the number of input files to be solved concurrently
+ * @param tok text to be read the number from
+ * @return true iff the number has been successfully read
+ */
+boolean regression_suite_read_nr_jobs(char const *tok)
+{
+  char *end;
+  unsigned long const value = strtoul(tok,&end,10);
+
+  if (tok!=end && *end==0 && value>0)
+  {
+    nr_jobs = value>max_nr_jobs ? max_nr_jobs : (unsigned int)value;
+    return true;
+  }
+  else
+    return false;
+}
+
+/* Determine whether running a regression test suite has been enabled
+ * @return true iff it has been enabled
+ */
+boolean regression_suite_is_enabled(void)
+{
+  return suite_dir!=0;
+}
+
+static boolean is_input_file(char const *name)
+{
+  size_t const length = strlen(name);
+  return length>4 && strcmp(name+length-4,".inp")==0;
+}
+
+static char *join_path(char const *dir, char const *name)
+{
+  char * const result = malloc(strlen(dir)+1+strlen(name)+1);
+
+  if (result!=0)
+  {
+    strcpy(result,dir);
+    strcat(result,"/");
+    strcat(result,name);
+  }
+
+  return result;
+}
+
+typedef struct
+{
+    char *text;
+    size_t length;
+    size_t capacity;
+} line_type;
+
+/* Determine whether a line reports the value of a counter, as builds with
+ * DOMEASURE write them (e.g. "  play_move:    12"); such lines are missing from
+ * the protocols of other builds and depend on details such as the hash table
+ * size, so the comparison ignores them
+ * @param line line to be tested
+ * @return true iff line is a counter line
+ */
+static boolean is_counter_line(char const *line)
+{
+  char const *p = line;
+
+  while (*p==' ')
+    ++p;
+  while (*p==' ' || *p=='_' || isalpha((unsigned char)*p))
+    ++p;
+
+  if (*p!=':')
+    return false;
+
+  ++p;
+  while (*p==' ')
+    ++p;
+
+  if (!isdigit((unsigned char)*p))
+    return false;
+
+  while (isdigit((unsigned char)*p))
+    ++p;
+  while (isspace((unsigned char)*p))
+    ++p;
+
+  return *p==0;
+}
+
+/* Read the next line, as is
+ * @param file file to read from
+ * @param line where to store the line (without the new line character)
+ * @return true iff a line could be read
+ */
+static boolean read_line(FILE *file, line_type *line)
+{
+  int c = getc(file);
+
+  if (c==EOF)
+    return false;
+
+  line->length = 0;
+
+  while (true)
+  {
+    if (line->length+1>=line->capacity)
+    {
+      size_t const capacity = line->capacity==0 ? 256 : 2*line->capacity;
+      char * const text = realloc(line->text,capacity);
+      if (text==0)
+        return false;
+      line->text = text;
+      line->capacity = capacity;
+    }
+
+    if (c==EOF || c=='\n')
+      break;
+
+    line->text[line->length++] = (char)c;
+    c = getc(file);
+  }
+
+  line->text[line->length] = 0;
+
+  return true;
+}
+
+/* Read the next line that isn't a counter line, removing its blank space
+ * @param file file to read from
+ * @param line where to store the line
+ * @param line_nr number of the last line read; updated
+ * @return true iff a line could be read
+ */
+static boolean read_relevant_line(FILE *file, line_type *line, unsigned long *line_nr)
+{
+  while (read_line(file,line))
+  {
+    ++*line_nr;
+
+    if (!is_counter_line(line->text))
+    {
+      size_t from;
+      size_t to = 0;
+
+      for (from = 0; from!=line->length; ++from)
+        if (!isspace((unsigned char)line->text[from]))
+          line->text[to++] = line->text[from];
+
+      line->text[to] = 0;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/* Compare two files line by line, ignoring blank space within the lines and
+ * counter lines
+ * @param output output file
+ * @param reference reference file
+ * @return number of the first line of output where the files differ; 0 if
+ *         they don't differ
+ */
+static unsigned long find_first_difference(FILE *output, FILE *reference)
+{
+  unsigned long result = 0;
+  unsigned long line_nr_output = 0;
+  unsigned long line_nr_reference = 0;
+  line_type line_output = { 0 };
+  line_type line_reference = { 0 };
+
+  while (true)
+  {
+    boolean const is_output_read = read_relevant_line(output,&line_output,&line_nr_output);
+    boolean const is_reference_read = read_relevant_line(reference,&line_reference,&line_nr_reference);
+
+    if (!is_output_read && !is_reference_read)
+      break;
+    else if (!is_output_read || !is_reference_read
+             || strcmp(line_output.text,line_reference.text)!=0)
+    {
+      result = is_output_read ? line_nr_output : line_nr_output+1;
+      break;
+    }
+  }
+
+  free(line_output.text);
+  free(line_reference.text);
+
+  return result;
+}
+
+/* Compare the protocol file written while solving an input file with its
+ * reference
+ * @param record the record of the job that solved the input file
+ * @param first_difference where to store the number of the first line of the
+ *                         protocol that differs from the reference
+ */
+static comparison_type compare_with_reference(job_record_type const *record,
+                                              unsigned long *first_difference)
+{
+  comparison_type result = comparison_failed;
+
+  if (record->protocol[0]==0)
+    result = comparison_no_protocol;
+  else
+  {
+    char const * const slash = strrchr(record->protocol,'/');
+    char const * const basename = slash==0 ? record->protocol : slash+1;
+    char * const reference_dir = join_path(suite_dir,"../REGRESSIONTESTS");
+    char * const reference_path = reference_dir==0 ? 0 : join_path(reference_dir,basename);
+
+    if (reference_path!=0)
+    {
+      FILE * const reference = fopen(reference_path,"r");
+      if (reference==0)
+        result = comparison_no_reference;
+      else
+      {
+        FILE * const output = fopen(record->protocol,"r");
+        if (output!=0)
+        {
+          *first_difference = find_first_difference(output,reference);
+          result = *first_difference==0 ? comparison_identical : comparison_different;
+          fclose(output);
+        }
+
+        fclose(reference);
+      }
+    }
+
+    free(reference_path);
+    free(reference_dir);
+  }
+
+  return result;
+}
+
+/* Solve an input file in the current worker, then terminate the worker
+ * @param si identifies the STRegressionSuiteRunner slice
+ * @param path path of the input file
+ * @param record where to communicate the outcome to the master
+ */
+static void solve_input_file(slice_index si,
+                             char const *path,
+                             job_record_type *record)
+{
+  FILE * const input = fopen(path,"r");
+
+  if (input!=0)
+  {
+    clock_t const start = clock();
+    char const *protocol;
+
+    input_plaintext_solve_stream(si,input);
+
+    protocol = protocol_get_filename();
+    if (protocol!=0)
+      strncpy(record->protocol,protocol,max_protocol_name_length);
+    protocol_close();
+
+    record->msec = (unsigned long)((clock()-start)*1000/CLOCKS_PER_SEC);
+    record->nr_moves = move_player_get_nr_moves_played();
+    record->is_done = true;
+  }
+
+  platform_end_worker();
+}
+
+typedef struct
+{
+    unsigned int nr_identical;
+    unsigned int nr_different;
+    unsigned int nr_without_reference;
+    unsigned int nr_failed;
+    unsigned long msec;
+    unsigned long nr_moves;
+} summary_type;
+
+static void report_job(char const *name,
+                       job_record_type const *record,
+                       summary_type *summary)
+{
+  printf("%-32s",name);
+
+  if (record->is_done)
+  {
+    unsigned long first_difference = 0;
+
+    printf(" %6lu.%03lus %12lu  ",
+           record->msec/1000,record->msec%1000,
+           record->nr_moves);
+    summary->msec += record->msec;
+    summary->nr_moves += record->nr_moves;
+
+    switch (compare_with_reference(record,&first_difference))
+    {
+      case comparison_identical:
+        puts("identical");
+        ++summary->nr_identical;
+        break;
+
+      case comparison_different:
+        printf("DIFFERENT %s from line %lu\n",record->protocol,first_difference);
+        ++summary->nr_different;
+        break;
+
+      case comparison_no_reference:
+        printf("no reference for %s\n",record->protocol);
+        ++summary->nr_without_reference;
+        break;
+
+      case comparison_no_protocol:
+        puts("no protocol file");
+        ++summary->nr_without_reference;
+        break;
+
+      default:
+        printf("FAILED to read %s\n",record->protocol);
+        ++summary->nr_failed;
+        break;
+    }
+  }
+  else
+  {
+    puts(" FAILED");
+    ++summary->nr_failed;
+  }
+
+  fflush(stdout);
+}
+
+/* Report the jobs that are done in the order of the input files
+ * @param names names of the input files
+ * @param records job records of the input files
+ * @param nr_reported number of jobs already reported; updated
+ * @param nr_started number of jobs started so far
+ * @param summary where to accumulate the summary
+ */
+static void report_jobs_done(char **names,
+                             job_record_type const records[],
+                             unsigned int *nr_reported,
+                             unsigned int nr_started,
+                             summary_type *summary)
+{
+  while (*nr_reported<nr_started && records[*nr_reported].is_done)
+  {
+    report_job(names[*nr_reported],&records[*nr_reported],summary);
+    ++*nr_reported;
+  }
+}
+
+static void report_summary(unsigned int nr_files, summary_type const *summary)
+{
+  printf("\n%u input files: %u identical, %u different, %u without reference, %u failed\n",
+         nr_files,
+         summary->nr_identical,
+         summary->nr_different,
+         summary->nr_without_reference,
+         summary->nr_failed);
+  printf("total: %lu.%03lus %lu moves\n",
+         summary->msec/1000,summary->msec%1000,
+         summary->nr_moves);
+}
+
+/* Solve the input files, reporting the outcomes
+ * @param si identifies the STRegressionSuiteRunner slice
+ * @param names names of the input files
+ * @param nr_files number of input files
+ * @param records job records of the input files
+ * @param output file to redirect the workers' standard output to
+ */
+static void run_jobs(slice_index si,
+                     char **names,
+                     unsigned int nr_files,
+                     job_record_type records[],
+                     FILE *output)
+{
+  summary_type summary = { 0 };
+  unsigned int nr_started = 0;
+  unsigned int nr_reported = 0;
+  unsigned int nr_running = 0;
+
+  while (nr_started<nr_files)
+  {
+    if (nr_running==nr_jobs)
+    {
+      platform_wait_for_any_worker();
+      --nr_running;
+      report_jobs_done(names,records,&nr_reported,nr_started,&summary);
+    }
+    else
+    {
+      char * const path = join_path(suite_dir,names[nr_started]);
+      platform_worker_start_result start_result = platform_worker_start_failed;
+
+      if (path!=0)
+      {
+        fflush(stdout);
+        start_result = platform_start_worker(output);
+      }
+
+      switch (start_result)
+      {
+        case platform_worker_running:
+          solve_input_file(si,path,&records[nr_started]);
+          break;
+
+        case platform_worker_started:
+          ++nr_started;
+          ++nr_running;
+          break;
+
+        default:
+          if (nr_running>0)
+          {
+            /* try again when a worker has terminated */
+            platform_wait_for_any_worker();
+            --nr_running;
+            report_jobs_done(names,records,&nr_reported,nr_started,&summary);
+          }
+          else
+          {
+            fputs("couldn't start a worker for solving the regression test suite\n",stderr);
+            nr_files = nr_started;
+          }
+          break;
+      }
+
+      free(path);
+    }
+  }
+
+  platform_wait_for_workers();
+
+  report_jobs_done(names,records,&nr_reported,nr_started,&summary);
+
+  /* jobs whose worker terminated irregularly */
+  while (nr_reported<nr_started)
+  {
+    report_job(names[nr_reported],&records[nr_reported],&summary);
+    ++nr_reported;
+  }
+
+  report_summary(nr_started,&summary);
+}
+
+/* Solve the input files of the regression test suite
+ * @param si identifies the STRegressionSuiteRunner slice
+ */
+void regression_suite_runner_solve(slice_index si)
+{
+  char ** const entries = platform_read_directory(suite_dir);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (entries==0)
+    fprintf(stderr,"couldn't read directory %s\n",suite_dir);
+  else if (parallel_get_nr_workers()>1)
+    fputs("-regression-suite can't be combined with -threads\n",stderr);
+  else
+  {
+    unsigned int nr_files = 0;
+    char **entry;
+
+    /* move the names of the input files to the front */
+    for (entry = entries; *entry!=0; ++entry)
+      if (is_input_file(*entry))
+      {
+        char * const name = *entry;
+        *entry = entries[nr_files];
+        entries[nr_files] = name;
+        ++nr_files;
+      }
+
+    if (nr_files>0)
+    {
+      size_t const size = nr_files*sizeof(job_record_type);
+      job_record_type * const records = platform_allocate_shared_memory(size);
+      FILE * const output = platform_open_tmpfile();
+
+      if (records==0 || output==0)
+        fputs("couldn't set up the workers for solving the regression test suite\n",stderr);
+      else
+      {
+        protocol_overwrite();
+        output_plaintext_suppress_variable();
+        run_jobs(si,entries,nr_files,records,output);
+      }
+
+      if (output!=0)
+        platform_close_tmpfile(output);
+      if (records!=0)
+        platform_free_shared_memory(records,size);
+    }
+
+    platform_free_directory(entries);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the root slices for running a regression test suite
+ * @param si identifies the root slice
+ */
+void regression_suite_instrument_root(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototype = alloc_pipe(STRegressionSuiteRunner);
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
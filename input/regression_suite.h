@@ -0,0 +1,43 @@
+#if !defined(INPUT_REGRESSION_SUITE_H)
+#define INPUT_REGRESSION_SUITE_H
+
+#include "stipulation/stipulation.h"
+
+/* This module implements running a regression test suite: each input file
+ * (*.inp) of a directory is solved in a worker process of its own, with up
+ * to a configurable number of workers running concurrently, as if Popeye
+ * had been invoked with -regression for the file.
+ * Each protocol file written is then compared with the file of the same name
+ * in the REGRESSIONTESTS directory next to the suite directory, ignoring
+ * whitespace as diff -wb does and the counter lines written by builds with
+ * DOMEASURE. Popeye reports the time spent and the number of moves played for
+ * each input file, the result of the comparison and a summary.
+ */
+
+/* Enable running a regression test suite
+ * @param dir path of the directory containing the input files
+ */
+void regression_suite_enable(char const *dir);
+
+/* Read the number of input files to be solved concurrently
+ * @param tok text to be read the number from
+ * @return true iff the number has been successfully read
+ */
+boolean regression_suite_read_nr_jobs(char const *tok);
+
+/* Determine whether running a regression test suite has been enabled
+ * @return true iff it has been enabled
+ */
+boolean regression_suite_is_enabled(void);
+
+/* Instrument the root slices for running a regression test suite
+ * @param si identifies the root slice
+ */
+void regression_suite_instrument_root(slice_index si);
+
+/* Solve the input files of the regression test suite
+ * @param si identifies the STRegressionSuiteRunner slice
+ */
+void regression_suite_runner_solve(slice_index si);
+
+#endif
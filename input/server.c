@@ -0,0 +1,275 @@
+#include "input/server.h"
+#include "input/plaintext/token.h"
+#include "input/plaintext/memory.h"
+#include "platform/server.h"
+#include "platform/tmpfile.h"
+#include "platform/maxtime.h"
+#include "platform/maxmem.h"
+#include "solving/parallel/workers.h"
+#include "stipulation/pipe.h"
+#include "stipulation/slice_insertion.h"
+#include "solving/pipe.h"
+#include "debugging/trace.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+enum
+{
+  max_request_length = 1<<20
+};
+
+static boolean is_server_enabled;
+static char const *socket_path;
+
+static maxtime_type default_maxtime;
+static maxmem_kilos_type default_maxmem;
+
+/* Enable the server
+ * @param path path of the Unix domain socket to listen at; 0 for reading the
+ *             requests from standard input
+ */
+void server_enable(char const *path)
+{
+  is_server_enabled = true;
+  socket_path = path;
+}
+
+/* Determine whether the server has been enabled
+ * @return true iff the server has been enabled
+ */
+boolean server_is_enabled(void)
+{
+  return is_server_enabled;
+}
+
+static void send_error(FILE *results, char const *message)
+{
+  fprintf(results,"error %lu\n%s",(unsigned long)strlen(message),message);
+  fflush(results);
+}
+
+static void send_result(FILE *results, FILE *output)
+{
+  long length;
+  char buffer[BUFSIZ];
+  size_t nr_read;
+
+  fseek(output,0,SEEK_END);
+  length = ftell(output);
+  fseek(output,0,SEEK_SET);
+
+  fprintf(results,"result %ld\n",length);
+  while ((nr_read = fread(buffer,1,sizeof buffer,output))>0)
+    fwrite(buffer,1,nr_read,results);
+  fflush(results);
+}
+
+/* Parse a request header, applying the values of maxtime and maxmem
+ * @param header the header
+ * @param length where to store the length of the input
+ * @return true iff the header is well-formed
+ */
+static boolean parse_header(char *header, unsigned long *length)
+{
+  char const * const separators = " \t\r\n";
+  char *tok = strtok(header,separators);
+  char *end;
+
+  if (tok==0 || strcmp(tok,"problem")!=0)
+    return false;
+
+  tok = strtok(0,separators);
+  if (tok==0)
+    return false;
+  *length = strtoul(tok,&end,10);
+  if (*end!=0 || *length>max_request_length)
+    return false;
+
+  while ((tok = strtok(0,separators))!=0)
+  {
+    char * const value = strtok(0,separators);
+    if (value==0)
+      return false;
+    else if (strcmp(tok,"maxtime")==0)
+    {
+      maxtime_type const seconds = (maxtime_type)strtoul(value,&end,10);
+      if (*end!=0)
+        return false;
+      platform_set_commandline_maxtime(seconds);
+    }
+    else if (strcmp(tok,"maxmem")==0)
+    {
+      /* the hash table shared with workers can't be allocated again */
+      if (parallel_get_nr_workers()<=1)
+        input_plaintext_read_requested_memory(value);
+    }
+    else
+      return false;
+  }
+
+  return true;
+}
+
+/* Copy the input of a request to a temporary file
+ * @param requests stream to read the input from
+ * @param length length of the input
+ * @return temporary file positioned at the beginning of the input; 0 if the
+ *         input couldn't be read
+ */
+static FILE *receive_input(FILE *requests, unsigned long length)
+{
+  FILE * const result = platform_open_tmpfile();
+
+  if (result!=0)
+  {
+    char buffer[BUFSIZ];
+
+    while (length>0)
+    {
+      size_t const nr_to_read = length<sizeof buffer ? length : sizeof buffer;
+      size_t const nr_read = fread(buffer,1,nr_to_read,requests);
+      if (nr_read!=nr_to_read
+          || fwrite(buffer,1,nr_read,result)!=nr_read)
+        break;
+      length -= nr_read;
+    }
+
+    if (length>0)
+    {
+      platform_close_tmpfile(result);
+      return 0;
+    }
+    else
+      fseek(result,0,SEEK_SET);
+  }
+
+  return result;
+}
+
+/* Serve the next request of a client
+ * @param si identifies the STServerRequestsIterator slice
+ * @param requests stream to read the request from
+ * @param results stream to write the result to
+ * @return false iff communication with the client is over
+ */
+static boolean serve_request(slice_index si, FILE *requests, FILE *results)
+{
+  char header[LINESIZE];
+  unsigned long length;
+  FILE *input;
+
+  if (fgets(header,sizeof header,requests)==0)
+    return false;
+
+  platform_set_commandline_maxtime(default_maxtime);
+  platform_request_memory(default_maxmem);
+
+  if (!parse_header(header,&length))
+  {
+    send_error(results,"malformed request header\n");
+    return false;
+  }
+
+  input = receive_input(requests,length);
+  if (input==0)
+  {
+    send_error(results,"incomplete request\n");
+    return false;
+  }
+
+  if (!platform_redimension_hashtable())
+    send_error(results,"Couldn't allocate the requested amount of memory\n");
+  else if (!platform_server_start_capturing())
+    send_error(results,"couldn't capture the output\n");
+  else
+  {
+    FILE *output;
+
+    input_plaintext_solve_stream(si,input);
+    input = 0;
+
+    output = platform_server_stop_capturing();
+    send_result(results,output);
+    platform_close_tmpfile(output);
+  }
+
+  if (input!=0)
+    platform_close_tmpfile(input);
+
+  return true;
+}
+
+/* Open the channel over which the requests are received
+ * @param si identifies the STServerChannelOpener slice
+ */
+void server_channel_opener_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (platform_server_open(socket_path))
+  {
+    pipe_solve_delegate(si);
+    platform_server_close();
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Serve the requests
+ * @param si identifies the STServerRequestsIterator slice
+ */
+void server_requests_iterator_solve(slice_index si)
+{
+  FILE *requests;
+  FILE *results;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  default_maxtime = platform_get_commandline_maxtime();
+  default_maxmem = platform_get_requested_memory();
+
+  while (platform_server_accept(&requests,&results))
+  {
+    while (serve_request(si,requests,results))
+    {
+      /* nothing */
+    }
+
+    platform_server_hang_up();
+  }
+
+  platform_set_commandline_maxtime(default_maxtime);
+  platform_request_memory(default_maxmem);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the root slices for serving requests
+ * @param si identifies the root slice
+ */
+void server_instrument_root(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototypes[] =
+    {
+      alloc_pipe(STServerChannelOpener),
+      alloc_pipe(STServerRequestsIterator)
+    };
+    enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
+    slice_insertion_insert(si,prototypes,nr_prototypes);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,48 @@
+#if !defined(INPUT_SERVER_H)
+#define INPUT_SERVER_H
+
+#include "stipulation/stipulation.h"
+
+/* This module implements a long-lived server that solves the problems it
+ * receives as requests, keeping the solving machinery and the hash table
+ * memory allocated between requests.
+ *
+ * Each request consists of a header line
+ *   problem <length> [maxtime <seconds>] [maxmem <amount>]
+ * followed by <length> bytes of input as it would be read from an input file.
+ * The server answers with
+ *   result <length>
+ * followed by the <length> bytes of output, or with
+ *   error <length>
+ * followed by a message of <length> bytes.
+ * maxtime and maxmem override the values of the respective command line
+ * parameters for one request.
+ */
+
+/* Enable the server
+ * @param path path of the Unix domain socket to listen at; 0 for reading the
+ *             requests from standard input
+ */
+void server_enable(char const *path);
+
+/* Determine whether the server has been enabled
+ * @return true iff the server has been enabled
+ */
+boolean server_is_enabled(void);
+
+/* Instrument the root slices for serving requests
+ * @param si identifies the root slice
+ */
+void server_instrument_root(slice_index si);
+
+/* Open the channel over which the requests are received
+ * @param si identifies the STServerChannelOpener slice
+ */
+void server_channel_opener_solve(slice_index si);
+
+/* Serve the requests
+ * @param si identifies the STServerRequestsIterator slice
+ */
+void server_requests_iterator_solve(slice_index si);
+
+#endif
@@ -4,12 +4,20 @@
 #include "solving/legal_move_counter.h"
 #include "solving/has_solution_type.h"
 #include "solving/pipe.h"
+#include "optimisations/orthodox_legal_moves.h"
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
 #include <limits.h>
 
-unsigned int opponent_moves_few_moves_prioriser_table[toppile + 1];
+unsigned int *opponent_moves_few_moves_prioriser_table;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void opponent_moves_counter_allocate_ply_tables(void)
+{
+  opponent_moves_few_moves_prioriser_table = ply_allocate_table(toppile+1,sizeof opponent_moves_few_moves_prioriser_table[0]);
+}
 
 /* Allocate a STOpponentMovesCounter slice.
  * @return index of allocated slice
@@ -70,3 +78,63 @@ void opponent_moves_counter_solve(slice_index si)
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
+
+/* Allocate a STOpponentMovesKnownLegalCounter slice.
+ * @return index of allocated slice
+ */
+slice_index alloc_opponent_moves_known_legal_counter_slice(void)
+{
+  slice_index result;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  result = alloc_pipe(STOpponentMovesKnownLegalCounter);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+static boolean is_move_not_known_legal(numecoup n)
+{
+  return !orthodox_legal_moves_is_move_known_legal(n);
+}
+
+/* Count the opponent's moves that are known to be legal without playing them,
+ * and remove them from the move generation stack. Only the remaining moves
+ * (if any) are played and counted by STLegalAttackCounter.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void opponent_moves_known_legal_counter_solve(slice_index si)
+{
+  numecoup const base = MOVEBASE_OF_PLY(nbply);
+  numecoup const top = CURRMOVE_OF_PLY(nbply);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  move_generator_filter_moves(base,&is_move_not_known_legal);
+
+  /* STOpponentMovesCounter is only interested in the total number, i.e. the
+   * counting can't make the move iteration stop */
+  assert(legal_move_counter_interesting[parent_ply[nbply]]==UINT_MAX);
+  legal_move_counter_count[parent_ply[nbply]] += top-CURRMOVE_OF_PLY(nbply);
+
+  pipe_solve_delegate(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -8,7 +8,7 @@
  * in STOpponentMovesCounter stipulation slices.
  */
 
-extern unsigned int opponent_moves_few_moves_prioriser_table[toppile+1];
+extern unsigned int *opponent_moves_few_moves_prioriser_table;
 
 /* Allocate a STOpponentMovesCounter slice.
  * @return index of allocated slice
@@ -30,4 +30,30 @@ slice_index alloc_opponent_moves_counter_slice(void);
  */
 void opponent_moves_counter_solve(slice_index si);
 
+/* Allocate a STOpponentMovesKnownLegalCounter slice.
+ * @return index of allocated slice
+ */
+slice_index alloc_opponent_moves_known_legal_counter_slice(void);
+
+/* Count the opponent's moves that are known to be legal without playing them,
+ * and remove them from the move generation stack. Only the remaining moves
+ * (if any) are played and counted by STLegalAttackCounter.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void opponent_moves_known_legal_counter_solve(slice_index si);
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void opponent_moves_counter_allocate_ply_tables(void);
+
 #endif
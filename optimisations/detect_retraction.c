@@ -143,7 +143,7 @@ void solving_optimise_by_detecting_retracted_moves(slice_index si)
   stip_structure_traversal_override_single(&st,STDefenseAdapter,&enter_branch);
   stip_structure_traversal_override_single(&st,STGeneratingMoves,&priorise);
   stip_structure_traversal_override_single(&st,STOrthodoxMatingMoveGenerator,&remember_not_to_priorise);
-  stip_structure_traversal_override_single(&st,STKillerMoveFinalDefenseMove,&remember_not_to_priorise);
+  stip_structure_traversal_override_single(&st,STKillerMoveStagedDefense,&remember_not_to_priorise);
   stip_structure_traversal_override_single(&st,STMove,&optimise_move);
   stip_traverse_structure(si,&st);
 
@@ -37,26 +37,54 @@
  ** type (1 byte) and specification (2 bytes). After this information
  ** about en_passant_multistep_over[0]-captures, Duellants and Imitators are coded.
  **
+ ** ZobristEncode avoids looking at each square of the board at each
+ ** node: it uses the Zobrist key of the board that is kept up to date
+ ** while moves are played and taken back (see position/position.h),
+ ** followed by the ghosts and the information coded by CommonEncode.
+ ** The table is hashed by the key alone. The board is only encoded
+ ** when an element with the same key is found, or when the position is
+ ** entered into the table, so that boards with the same key are still
+ ** told apart. SmallEncode or LargeEncode are still used if they
+ ** produce an encoding that is not longer than the prefix written by
+ ** ZobristEncode.
+ **
  ** The hash table uses a dynamic hashing scheme which allows dynamic
  ** growth and shrinkage of the hashtable. See the relevant dht* files
- ** for more details. Two procedures are used:
+ ** for more details. If the amount of memory for the table is known in
+ ** advance, the table is created with a flat directory of its final size
+ ** instead. Two procedures are used:
  **   dhtLookupElement: This procedure delivers
  ** a nil pointer, when the given position is not in the hashtable,
  ** or a pointer to a hashelement.
  **   dhtEnterElement:  This procedure enters an encoded position
  ** with its values into the hashtable.
  **
- ** When there is no more memory, or more than hash_max_number_storable_positions positions
- ** are stored in the hash-table, then some positions are removed
- ** from the table. This is done in the compress procedure.
- ** This procedure uses a little improved scheme introduced by Torsten.
+ ** When solving in parallel, the workers share a table of fixed size
+ ** instead (see shared_hash_table.h). In that table, the value of the
+ ** information about a position (see below) decides which entry of a
+ ** full bucket is replaced. As the table only stores a fingerprint of each
+ ** position, a single process can use it to hold more positions in the same
+ ** amount of memory (command line option -compacthash).
+ **
+ ** If requested, the table is saved to a file in a cache directory when
+ ** it is closed and looked up again when the same problem is solved again
+ ** (see hash_cache.h). Positions that are not found in the table are
+ ** looked up in the file of the previous run and entered into the table if
+ ** they are found there. The file is only replaced if the table has been
+ ** modified and solving can't have been cut short.
+ **
+ ** When there is no more memory, then some positions are removed
+ ** from the table. Originally, this was done all at once in a compress
+ ** procedure, which stopped solving for the whole sweep over the table.
+ ** Now a clock hand moves over the table by a few positions at each
+ ** insertion, and further only if an insertion fails.
  ** The selection of positions to remove is based on the value of
  ** information gathered about this position. The information about
  ** a position "unsolvable in 2 moves" is less valuable than "unsolvable
  ** in 5 moves", since the former can be recomputed faster. For the other
  ** type of information ("solvable") the comparison is the other way round.
- ** The compression of the table is an expensive operation, in a lot
- ** of exeperiments it has shown to be quite effective in keeping the
+ ** The removal of positions by their value has shown in a lot
+ ** of exeperiments to be quite effective in keeping the
  ** most valuable information, and speeds up the computation time
  ** considerably. But to be of any use, there must be enough memory to
  ** to store more than 800 positions.
@@ -84,6 +112,9 @@
 
 #include <memory.h>
 #include "optimisations/hash.h"
+#include "optimisations/shared_hash_table.h"
+#include "optimisations/hash_cache.h"
+#include "input/plaintext/token.h"
 #include "output/plaintext/message.h"
 #include "solving/proofgames.h"
 #include "DHT/dhtvalue.h"
@@ -109,6 +140,8 @@
 #include "platform/maxtime.h"
 #include "platform/maxmem.h"
 #include "solving/pipe.h"
+#include "solving/parallel/workers.h"
+#include "solving/statistics.h"
 #include "debugging/trace.h"
 #include "pieces/pieces.h"
 #include "pieces/attributes/neutral/neutral.h"
@@ -126,22 +159,53 @@ typedef unsigned int hash_value_type;
 
 static struct dht *pyhash;
 
+/* The flat directory of pyhash (see dhtCreateFlat()) if the amount of memory
+ * for the table is known, i.e. if its elements are allocated with FXF */
+static void *flat_directory;
+static unsigned long nr_flat_buckets;
+
+/* Are we using the table of fingerprints (see shared_hash_table.h) instead of
+ * pyhash? We do if we share the table with the workers solving in parallel or
+ * if a compact table has been requested. */
+static boolean is_table_of_fingerprints;
+static boolean is_compact_table_requested;
+
+static boolean is_cache_used;
+static boolean is_cache_outdated;
+
+/* the input fingerprint of the last table opened, and the number of tables
+ * opened since the fingerprint has last changed */
+static hash_cache_fingerprint_type cached_input_fingerprint;
+static unsigned int nr_tables_opened_with_input_fingerprint;
+
 static byte piece_nbr[nr_piece_walks];
 static boolean one_byte_hash;
 static unsigned int bytes_per_spec;
 static unsigned int bytes_per_piece;
 
+/* the flags coded by SmallEncode and LargeEncode */
+static Flags encoded_flags;
+
 /* TODO we should remove help hash slices instead of testing this flag over and
  * over */
 static boolean is_table_uncompressed;
 
 /* Minimal value of a hash table element.
- * compresshash() will remove all elements with a value less than
- * minimalElementValueAfterCompression, and increase
+ * Once the table has been full, the clock hand (see advance_clock_hand())
+ * removes all elements with a value less than
+ * minimalElementValueAfterCompression, and increases
  * minimalElementValueAfterCompression if necessary.
  */
 static hash_value_type minimalElementValueAfterCompression;
 
+/* Number of entries of the table of fingerprints replaced since it was opened.
+ * A replacement corresponds to the removal of an element by the clock hand,
+ * but replacements begin long before the table is full. We therefore only
+ * consider the table compressed once a sixteenth of the entries has been
+ * replaced.
+ */
+static unsigned long nr_replaced_fingerprints;
+
 
 /* Container of indices of hash slices
  */
@@ -149,7 +213,14 @@ static unsigned int nr_hash_slices;
 static slice_index hash_slices[max_nr_slices];
 
 
-HashBuffer hashBuffers[maxply+1];
+HashBuffer *hashBuffers;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hash_allocate_ply_tables(void)
+{
+  hashBuffers = ply_allocate_table(maxply+1,sizeof hashBuffers[0]);
+}
 
 #if defined(TESTHASH)
 static void dump_hash_buffer(void)
@@ -580,8 +651,8 @@ enum
 
 /* Reduce the value offsets for the hash slices to the minimal
  * possible value. This is important in order for
- * minimalElementValueAfterCompression not to grow too high in
- * compresshash().
+ * minimalElementValueAfterCompression not to grow too high while
+ * elements are removed from the table.
  */
 static void minimiseValueOffset(void)
 {
@@ -930,143 +1001,147 @@ static hash_value_type value_of_data(hashElement_union_t const *hue)
   return result;
 }
 
-#if defined(TESTHASH)
-static unsigned long nrElementsRemovedInAllCompressions = 0;
-#endif
-
-static void compresshash (void)
+/* Elements are removed from the table by a clock hand that moves over the
+ * table, a few elements at a time. The hand starts moving when the table
+ * has become full for the first time; from then on, it moves at each
+ * insertion into the almost full table until it has removed an element, and
+ * further only if an insertion fails. It passes over the table once during
+ * each "revolution", removing the elements whose value is below
+ * minimalElementValueAfterCompression. Elements entered since the
+ * hand has last passed their place have thus had some time to prove
+ * valuable.
+ * If a revolution removes less than a sixteenth of the elements,
+ * minimalElementValueAfterCompression is increased.
+ */
+enum
 {
-  unsigned long targetKeyCount;
+  nr_elements_examined_per_insertion = 8
+};
 
-#if defined(TESTHASH)
-  unsigned long nrElementsRemovedInCompression = 0;
-  unsigned long const nrElementsAtStartOfCompression = dhtKeyCount(pyhash);
-  unsigned long nrIterationsInCompression = 0;
-#endif
+/* the element that the clock hand examines next; 0 if the hand is to start a
+ * new revolution */
+static dhtElement const *clock_hand;
 
-  TraceFunctionEntry(__func__);
-  TraceFunctionParamListEnd();
+/* the number of elements when an insertion has last failed */
+static unsigned long nrElementsWhenFull;
 
-  is_table_uncompressed = false;
+static unsigned long nrElementsAtStartOfRevolution;
+static unsigned long nrElementsRemovedInRevolution;
 
-  targetKeyCount = dhtKeyCount(pyhash);
-  targetKeyCount -= targetKeyCount/16;
+/* Move the clock hand by one element
+ * @return true iff an element has been removed
+ */
+static boolean advance_clock_hand(void)
+{
+  boolean result = false;
 
-  TraceValue("%u",minimalElementValueAfterCompression);
-  TraceValue("%lu",dhtKeyCount(pyhash));
-  TraceValue("%lu",targetKeyCount);
-  TraceEOL();
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
 
-  while (true)
+  if (clock_hand==0)
   {
-    dhtElement const *he;
+    clock_hand = dhtGetFirstElement(pyhash);
+    nrElementsAtStartOfRevolution = dhtKeyCount(pyhash);
+    nrElementsRemovedInRevolution = 0;
+  }
 
-#if defined(TESTHASH)
-    unsigned long nrElementsVisitedInIteration = 0;
-    printf("starting iteration: minimalElementValueAfterCompression: %u\n",
-           minimalElementValueAfterCompression);
-    fflush(stdout);
-#endif  /* TESTHASH */
+  if (clock_hand!=0)
+  {
+    hashElement_union_t hue;
+    hue.d = *clock_hand;
 
-#if defined(TESTHASH)    
-    for (he = dhtGetFirstElement(pyhash);
-         he!=0;
-         he = dhtGetNextElement(pyhash))
+    /* dhtRemoveElement() keeps the table's enumeration valid */
+    if (value_of_data(&hue)<minimalElementValueAfterCompression)
     {
-      hashElement_union_t hue;
-      hue.d = *he;
-      printf("%u\n",value_of_data(&hue));
+      dhtRemoveElement(pyhash,hue.d.Key);
+      ++nrElementsRemovedInRevolution;
+      result = true;
     }
-#endif  /* TESTHASH */
 
-    for (he = dhtGetFirstElement(pyhash);
-         he!=0;
-         he = dhtGetNextElement(pyhash))
+    clock_hand = dhtGetNextElement(pyhash);
+
+    if (clock_hand==0)
     {
-      hashElement_union_t hue;
-      hue.d = *he;
-      if (value_of_data(&hue)<minimalElementValueAfterCompression)
-      {
-#if defined(TESTHASH)
-        ++nrElementsRemovedInCompression;
-        ++nrElementsRemovedInAllCompressions;
-#endif  /* TESTHASH */
+      TraceValue("%lu",nrElementsAtStartOfRevolution);
+      TraceValue("%lu",nrElementsRemovedInRevolution);
+      TraceValue("%u",minimalElementValueAfterCompression);
+      TraceEOL();
 
-        dhtRemoveElement(pyhash, hue.d.Key);
+      if (nrElementsRemovedInRevolution<nrElementsAtStartOfRevolution/16+1)
+        ++minimalElementValueAfterCompression;
 
 #if defined(TESTHASH)
-        if (nrElementsRemovedInCompression + dhtKeyCount(pyhash) != nrElementsAtStartOfCompression)
-        {
-          printf("dhtRemove failed on %lu-th element of iteration %lu. "
-                 "This was the %lu-th call to dhtRemoveElement.\n"
-                 "nrElementsRemovedInCompression=%lu "
-                 "dhtKeyCount=%lu "
-                 "nrElementsAtStartOfCompression=%lu\n",
-                 nrElementsVisitedInIteration,
-                 nrIterationsInCompression,
-                 nrElementsRemovedInAllCompressions,
-                 nrElementsRemovedInCompression,
-                 dhtKeyCount(pyhash),
-                 nrElementsAtStartOfCompression);
-          exit(1);
-        }
-#endif  /* TESTHASH */
-      }
-#if defined(TESTHASH)
-      ++nrElementsVisitedInIteration;
+      printf("revolution: %lu elements, %lu removed, "
+             "minimalElementValueAfterCompression: %u\n",
+             nrElementsAtStartOfRevolution,
+             nrElementsRemovedInRevolution,
+             minimalElementValueAfterCompression);
 #endif  /* TESTHASH */
     }
+  }
 
-#if defined(TESTHASH)
-    ++nrIterationsInCompression;
-    assert(nrElementsAtStartOfCompression>=nrElementsVisitedInIteration);
-    printf("iteration=%lu, nrElementsRemovedInCompression:%lu, missed:%lu\n",
-           nrIterationsInCompression,
-           nrElementsRemovedInCompression,
-           nrElementsAtStartOfCompression-nrElementsVisitedInIteration);
-    {
-      unsigned int i;
-      unsigned int counter[16];
-      unsigned long const KeyCount = dhtKeyCount(pyhash);
-      dhtBucketStat(pyhash,counter,16);
-      for (i=0; i<16; ++i)
-        printf("%lu %u %u\n", KeyCount, i+1, counter[i]);
-      putchar('\n');
-      if (nrIterationsInCompression>9)
-        printf("nrIterationsInCompression > 9 after %lu-th call to  dhtRemoveElement\n",
-               nrElementsRemovedInAllCompressions);
-      set_dhtDebug(nrIterationsInCompression==9);
-    }
-    fflush(stdout);
-#endif  /* TESTHASH */
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
 
-    if (dhtKeyCount(pyhash)<=targetKeyCount)
-      break;
-    else
-      ++minimalElementValueAfterCompression;
+/* Do the bounded amount of eviction work that accompanies each insertion
+ * into a table that has been full: if the table is (almost) as full as it
+ * was when an insertion last failed, move the clock hand until it has removed
+ * an element, but by a limited number of elements
+ */
+static void evict_incrementally(void)
+{
+  if (dhtKeyCount(pyhash)+nrElementsWhenFull/64>=nrElementsWhenFull)
+  {
+    unsigned int i;
+    for (i = 0; i!=nr_elements_examined_per_insertion; ++i)
+      if (advance_clock_hand())
+        break;
   }
-#if defined(TESTHASH)
-  printf("%lu;",dhtKeyCount(pyhash));
-#if defined(HASHRATE)
-  printf(" usage: %lu", use_pos);
-  printf(" / %lu", use_all);
-  printf(" = %.Lf%%", (100.0L * (long double) use_pos) / (long double) use_all);
-#endif
-#if defined(FREEMAP) && defined(FXF)
-  PrintFreeMap(stdout);
-#endif /*FREEMAP*/
-  putchar('\n');
-#if defined(FXF)
-  puts("\n after compression:");
-  fxfInfo(stdout);
-#endif /*FXF*/
-#endif /*TESTHASH*/
+}
+
+/* Make room for a new element after an insertion has failed because the table
+ * is full: move the clock hand until it has removed an element
+ * @return true iff an element has been removed, i.e. false iff the table is
+ *              empty
+ */
+static boolean make_room(void)
+{
+  boolean result = false;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  is_table_uncompressed = false;
+  nrElementsWhenFull = dhtKeyCount(pyhash);
+
+  while (dhtKeyCount(pyhash)>0)
+    if (advance_clock_hand())
+    {
+      result = true;
+      break;
+    }
 
   TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
   TraceFunctionResultEnd();
-} /* compresshash */
+  return result;
+}
 
 #if defined(HASHRATE)
+/* Determine the number of positions in the hash table
+ * @return number of positions
+ */
+static unsigned long nr_hashed_positions(void)
+{
+  if (is_table_of_fingerprints)
+    return shared_hash_table_nr_entered();
+  else
+    return pyhash==0 ? 0 : dhtKeyCount(pyhash);
+}
+
 /* Level = 0: No output of HashStat
  * Level = 1: Output with every trace output
  * Level = 2: Output at each table compression
@@ -1112,7 +1187,7 @@ void HashStats(unsigned int level, char const *trailer)
 #if defined(HASHRATE)
   if (level<=HashRateLevel)
   {
-    unsigned long int pos= dhtKeyCount(pyhash);
+    unsigned long int pos= nr_hashed_positions();
     fputs("  ",stdout);
     Message2(stdout,HashedPositions,pos);
     if (use_all > 0)
@@ -1380,6 +1455,24 @@ static unsigned int TellSmallEncodePosLeng(void)
   return result;
 } /* TellSmallEncodePosLeng */
 
+/* Tell the length of the prefix written by ZobristEncode */
+static unsigned int TellZobristEncodePosLeng(void)
+{
+  unsigned int const len = 1 + sizeof zobrist_key + nr_ghosts*(1+bytes_per_piece);
+  unsigned int result;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  /* holes are part of the Zobrist key */
+  result = TellCommonEncodePosLeng(len,nr_files_on_board*nr_rows_on_board);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+} /* TellZobristEncodePosLeng */
+
 byte *CommonEncode(byte *bp,
                    stip_length_type min_length,
                    stip_length_type validity_value)
@@ -1519,18 +1612,15 @@ static byte *LargeEncodePiece(byte *bp, byte *position,
   return bp;
 }
 
-static void LargeEncode(stip_length_type min_length,
-                        stip_length_type validity_value)
+/* Encode the pieces on the board in the format of LargeEncode
+ * @param position where to write the bits representing the occupied squares
+ * @return address after the encoded pieces
+ */
+static byte *LargeEncodeBoard(byte *position)
 {
-  HashBuffer *hb = &hashBuffers[nbply];
-  byte *position = hb->cmv.Data;
   byte *bp = position+nr_rows_on_board;
   int row, col;
   square a_square = square_a1;
-  underworld_index_type gi;
-
-  TraceFunctionEntry(__func__);
-  TraceFunctionParamListEnd();
 
   /* clear the bits for storing the position of pieces */
   memset(position,0,nr_rows_on_board);
@@ -1546,6 +1636,23 @@ static void LargeEncode(stip_length_type min_length,
     }
   }
 
+  return bp;
+}
+
+static void LargeEncode(stip_length_type min_length,
+                        stip_length_type validity_value)
+{
+  HashBuffer *hb = &hashBuffers[nbply];
+  byte *position = hb->cmv.Data;
+  byte *bp;
+  int row, col;
+  underworld_index_type gi;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  bp = LargeEncodeBoard(position);
+
   for (gi = 0; gi<nr_ghosts; ++gi)
   {
     square s = (underworld[gi].on
@@ -1586,18 +1693,15 @@ byte *SmallEncodePiece(byte *bp,
   return bp;
 }
 
-static void SmallEncode(stip_length_type min_length,
-                        stip_length_type validity_value)
+/* Encode the pieces on the board in the format of SmallEncode
+ * @param bp where to write the encoded pieces
+ * @return address after the encoded pieces
+ */
+static byte *SmallEncodeBoard(byte *bp)
 {
-  HashBuffer *hb = &hashBuffers[nbply];
-  byte *bp = hb->cmv.Data;
   square a_square = square_a1;
   int row;
   int col;
-  underworld_index_type gi;
-
-  TraceFunctionEntry(__func__);
-  TraceFunctionParamListEnd();
 
   for (row=0; row<nr_rows_on_board; row++, a_square += onerow)
   {
@@ -1610,6 +1714,23 @@ static void SmallEncode(stip_length_type min_length,
     }
   }
 
+  return bp;
+}
+
+static void SmallEncode(stip_length_type min_length,
+                        stip_length_type validity_value)
+{
+  HashBuffer *hb = &hashBuffers[nbply];
+  byte *bp;
+  int row;
+  int col;
+  underworld_index_type gi;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  bp = SmallEncodeBoard(hb->cmv.Data);
+
   for (gi = 0; gi<nr_ghosts; ++gi)
   {
     square s = (underworld[gi].on
@@ -1632,6 +1753,114 @@ static void SmallEncode(stip_length_type min_length,
   TraceFunctionResultEnd();
 }
 
+/* ZobristEncode only writes a prefix of the encoding: a byte telling whether
+ * the encoding is complete, the Zobrist key, the ghosts and the information
+ * coded by CommonEncode. The board is only encoded (by SmallEncodeBoard or
+ * LargeEncodeBoard, whichever is shorter) if the prefix matches that of an
+ * element of the table, or if the position is entered into the table.
+ */
+enum
+{
+  zobrist_encoding_prefix_only,
+  zobrist_encoding_complete
+};
+
+static byte *(*encode_board)(byte *bp);
+
+/* Append the encoding of the board to an encoding written by ZobristEncode
+ * @param value encoding of the current position
+ */
+static void complete_zobrist_encoding(BCMemValue *value)
+{
+  if (value->Data[0]==zobrist_encoding_prefix_only)
+  {
+    byte * const bp = (*encode_board)(value->Data+value->Leng);
+    assert(bp-value->Data<=UCHAR_MAX);
+    value->Leng = (unsigned char)(bp-value->Data);
+    value->Data[0] = zobrist_encoding_complete;
+  }
+}
+
+/* Hash an encoding written by ZobristEncode. Only the key is used, so that
+ * the hash value doesn't depend on whether the encoding is complete.
+ */
+static dhtHashValue HashZobristValue(dhtConstValue v)
+{
+  BCMemValue const * const value = (BCMemValue const *)v;
+  zobrist_key_type key;
+
+  memcpy(&key,value->Data+1,sizeof key);
+
+  return (dhtHashValue)(key ^ key>>32);
+}
+
+/* Compare an element of the table with a position that is looked up
+ * @param v1 encoding of the element
+ * @param v2 encoding of the position; completed if the prefixes are equal
+ * @return non-zero iff the encodings are equal
+ */
+static int EqualZobristValue(dhtConstValue v1, dhtConstValue v2)
+{
+  BCMemValue const * const element = (BCMemValue const *)v1;
+  BCMemValue const * const position = (BCMemValue const *)v2;
+
+  if (position->Data[0]==zobrist_encoding_prefix_only)
+  {
+    /* boards with the same key are only told apart by their encodings, but
+     * most of the time the prefixes already differ */
+    if (position->Leng>element->Leng
+        || memcmp(element->Data+1,position->Data+1,position->Leng-1)!=0)
+      return 0;
+    else
+      complete_zobrist_encoding((BCMemValue *)position);
+  }
+
+  return (element->Leng==position->Leng
+          && memcmp(element->Data,position->Data,element->Leng)==0);
+}
+
+static dhtValueType const dhtZobristValue = dhtUser1Value;
+
+static dhtValueProcedures dhtZobristProcs;
+
+static void ZobristEncode(stip_length_type min_length,
+                          stip_length_type validity_value)
+{
+  HashBuffer *hb = &hashBuffers[nbply];
+  byte *bp = hb->cmv.Data;
+  underworld_index_type gi;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  /* a missed update of the key would cause wrong solutions */
+  assert(is_zobrist_key_in_sync());
+
+  *bp++ = zobrist_encoding_prefix_only;
+
+  memcpy(bp,&zobrist_key,sizeof zobrist_key);
+  bp += sizeof zobrist_key;
+
+  for (gi = 0; gi<nr_ghosts; ++gi)
+  {
+    square s = (underworld[gi].on
+                - nr_of_slack_rows_below_board*onerow
+                - nr_of_slack_files_left_of_board);
+    bp = SmallEncodePiece(bp,
+                          s/onerow,s%onerow,
+                          underworld[gi].walk,underworld[gi].flags);
+  }
+
+  /* Now the rest of the party */
+  bp = CommonEncode(bp,min_length,validity_value);
+
+  assert(bp-hb->cmv.Data<=UCHAR_MAX);
+  hb->cmv.Leng = (unsigned char)(bp-hb->cmv.Data);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
 /* Initialise the bits representing all slices in a hash table
  * element's data field with null values
  * @param he address of hash table element
@@ -1671,26 +1900,59 @@ static void init_elements(hashElement_union_t *hue)
   TraceFunctionResultEnd();
 }
 
-/* (attempt to) allocate a hash table element - compress the current
- * hash table if necessary; exit()s if allocation is not possible
- * in spite of compression
+/* Create the (non-shared) hash table
+ * @return the table; dhtNilHashTable if it couldn't be created
+ */
+static struct dht *create_table(void)
+{
+  dhtValueType const key_type = (encode==ZobristEncode
+                                 ? dhtZobristValue
+                                 : dhtBCMemValue);
+
+  if (flat_directory!=0)
+    return dhtCreateFlat(key_type,dhtCopy,dhtSimpleValue,dhtNoCopy,
+                         flat_directory,nr_flat_buckets);
+  else
+    return dhtCreate(key_type,dhtCopy,dhtSimpleValue,dhtNoCopy);
+}
+
+/* Destroy the (non-shared) hash table
+ * With FXF, all of the table's memory is released at once rather than
+ * element by element.
+ */
+static void destroy_table(void)
+{
+#if defined(FXF)
+  if (flat_directory!=0)
+    dhtResetFlatDirectory(pyhash);
+  fxfReset();
+#else
+  dhtDestroy(pyhash);
+#endif
+  pyhash = 0;
+  clock_hand = 0;
+}
+
+/* (attempt to) allocate a hash table element - remove elements from the
+ * current hash table if necessary; exit()s if allocation is not possible
+ * in spite of removing elements
  * @param hb has value (basis for calculation of key)
  * @return address of element
  */
 static dhtElement *allocDHTelement(dhtConstValue hb)
 {
-  dhtElement *result = dhtEnterElement(pyhash,hb,template_element.d.Data);
+  dhtElement *result;
+
+  if (!is_table_uncompressed)
+    evict_incrementally();
+
+  result = dhtEnterElement(pyhash,hb,template_element.d.Data);
   while (result==dhtNilElement)
   {
-    unsigned long const nrKeysBeforeCompression = dhtKeyCount(pyhash);
-    compresshash();
-    if (dhtKeyCount(pyhash)==nrKeysBeforeCompression)
+    if (!make_room())
     {
-      dhtDestroy(pyhash);
-#if defined(FXF)
-      fxfReset();
-#endif
-      pyhash = dhtCreate(dhtBCMemValue,dhtCopy,dhtSimpleValue,dhtNoCopy);
+      destroy_table();
+      pyhash = create_table();
       if (pyhash == dhtNilHashTable)
       {
         fprintf(stderr, "\nOUT OF SPACE: Unable to create hash table in %s in %s -- aborting.\n", __func__, __FILE__);
@@ -1713,8 +1975,170 @@ static dhtElement *allocDHTelement(dhtConstValue hb)
   return result;
 }
 
+/* How much is the data of a shared table element worth to us?
+ * @param data data of the element
+ * @return value of the element
+ */
+static unsigned int value_of_shared_data(shared_hash_table_data_type data)
+{
+  hashElement_union_t hue;
+  hue.e.data = data;
+  return value_of_data(&hue);
+}
+
+/* Copy of the element of the shared table that we are currently looking at;
+ * the elements of the shared table can't be accessed directly.
+ */
+static hashElement_union_t shared_element;
+
+/* Complete the encoding of the current position where ZobristEncode only
+ * wrote a prefix
+ * @param hb encoded position
+ */
+static void complete_encoding(HashBuffer *hb)
+{
+  if (encode==ZobristEncode)
+    complete_zobrist_encoding(&hb->cmv);
+}
+
+/* Find the hash table element for a position
+ * @param hb encoded position
+ * @return address of the element; 0 if the position isn't in the table
+ * @note the address is only valid until the next access to the table
+ */
+
+static hashElement_union_t *find_element(HashBuffer *hb)
+{
+  if (is_table_of_fingerprints)
+  {
+    boolean const found = shared_hash_table_lookup(&hb->cmv,&shared_element.e.data);
+    if (statistics_are_collected)
+      statistics_count_hash_probe(found);
+    return found ? &shared_element : 0;
+  }
+  else
+  {
+    dhtElement *he = dhtLookupElement(pyhash,hb);
+
+    if (he==dhtNilElement && is_cache_used)
+    {
+      hash_cache_data_type data;
+      complete_encoding(hb);
+      if (hash_cache_lookup(&hb->cmv,&data))
+      {
+        he = allocDHTelement(hb);
+        ((hashElement_union_t *)he)->e.data = data;
+      }
+    }
+
+    if (statistics_are_collected)
+      statistics_count_hash_probe(he!=dhtNilElement);
+
+    return he==dhtNilElement ? 0 : (hashElement_union_t *)he;
+  }
+}
+
+/* Enter a position into the hash table
+ * @param hb encoded position
+ * @return address of the element for the position
+ * @note the address is only valid until the next access to the table
+ */
+static hashElement_union_t *enter_element(HashBuffer *hb)
+{
+  if (is_table_of_fingerprints)
+  {
+    shared_element = template_element;
+    return &shared_element;
+  }
+  else
+  {
+    complete_encoding(hb);
+    return (hashElement_union_t *)allocDHTelement(hb);
+  }
+}
+
+/* Make the modifications to a hash table element permanent
+ * @param hb encoded position
+ * @param hue address of the element as returned by find_element() or
+ *            enter_element()
+ */
+static void commit_element(HashBuffer const *hb, hashElement_union_t const *hue)
+{
+  if (is_cache_used)
+    is_cache_outdated = true;
+
+  if (is_table_of_fingerprints
+      && shared_hash_table_store(&hb->cmv,hue->e.data,&value_of_shared_data))
+  {
+    ++nr_replaced_fingerprints;
+    if (nr_replaced_fingerprints>shared_hash_table_capacity()/16)
+      is_table_uncompressed = false;
+  }
+}
+
 static unsigned long hashtable_kilos;
 
+#if defined(FXF)
+/* Allocate the memory for the (non-shared) hash table: a flat directory of
+ * about a sixteenth of the memory, which corresponds to the directory of a
+ * table that has grown to that size by linear hashing, and the FXF arena for
+ * the elements
+ * @param nr_bytes number of bytes to allocate
+ * @return true iff the memory could be allocated
+ */
+static boolean allocate_table_memory(size_t nr_bytes)
+{
+  size_t directory_size = 0;
+
+  free(flat_directory);
+  flat_directory = 0;
+  nr_flat_buckets = 0;
+
+  if (dhtFlatDirectorySize(dhtMinFlatBuckets)<=nr_bytes/16)
+  {
+    unsigned long nr_buckets = dhtMinFlatBuckets;
+    while (nr_buckets*2!=0
+           && dhtFlatDirectorySize(nr_buckets*2)<=nr_bytes/16)
+      nr_buckets *= 2;
+
+    directory_size = dhtFlatDirectorySize(nr_buckets);
+    flat_directory = calloc(1,directory_size);
+    if (flat_directory==0)
+      return false;
+    else
+      nr_flat_buckets = nr_buckets;
+  }
+
+  if (fxfInit(nr_bytes-directory_size)==0)
+  {
+    free(flat_directory);
+    flat_directory = 0;
+    nr_flat_buckets = 0;
+    return false;
+  }
+  else
+    return true;
+}
+#endif /*FXF*/
+
+/* Use a table that stores fixed size fingerprints of the positions rather
+ * than the positions themselves, even if we don't solve in parallel
+ * @note must be invoked before allochash()
+ */
+void hash_use_compact_table(void)
+{
+  is_compact_table_requested = true;
+}
+
+/* Determine whether a table of fingerprints has been requested with
+ * hash_use_compact_table()
+ * @return true iff it has been requested
+ */
+boolean hash_is_compact_table_requested(void)
+{
+  return is_compact_table_requested;
+}
+
 /* Allocate memory for the hash table. If the requested amount of
  * memory isn't available, reduce the amount until allocation
  * succeeds.
@@ -1723,23 +2147,34 @@ static unsigned long hashtable_kilos;
  */
 unsigned long allochash(unsigned long nr_kilos)
 {
-#if defined(FXF)
-  static boolean need_to_schedule_fxfTeardown = true;
-  size_t const one_kilo = 1<<10;
-  if (nr_kilos > (((size_t) -1)/one_kilo))
-    nr_kilos = (((size_t) -1)/one_kilo);
-  while (nr_kilos && !fxfInit(nr_kilos*one_kilo))
-    /* we didn't get hashmemory ... */
-    nr_kilos /= 2;
-  if (nr_kilos && need_to_schedule_fxfTeardown)
-  {
-    if (atexit(&fxfTeardown))
-      perror(__func__);
-    else
-      need_to_schedule_fxfTeardown = false;
+  boolean const is_shared = parallel_get_nr_workers()>1;
+
+  if (is_shared || is_compact_table_requested)
+  {
+    /* the table has to be allocated before the workers are started */
+    nr_kilos = shared_hash_table_allocate(nr_kilos,is_shared);
+    is_table_of_fingerprints = nr_kilos>0;
   }
-  ifTESTHASH(fxfInfo(stdout));
+  else
+  {
+#if defined(FXF)
+    static boolean need_to_schedule_fxfTeardown = true;
+    size_t const one_kilo = 1<<10;
+    if (nr_kilos > (((size_t) -1)/one_kilo))
+      nr_kilos = (((size_t) -1)/one_kilo);
+    while (nr_kilos && !allocate_table_memory(nr_kilos*one_kilo))
+      /* we didn't get hashmemory ... */
+      nr_kilos /= 2;
+    if (nr_kilos && need_to_schedule_fxfTeardown)
+    {
+      if (atexit(&fxfTeardown))
+        perror(__func__);
+      else
+        need_to_schedule_fxfTeardown = false;
+    }
+    ifTESTHASH(fxfInfo(stdout));
 #endif /*FXF*/
+  }
 
   hashtable_kilos = nr_kilos;
   return nr_kilos;
@@ -1790,7 +2225,7 @@ static boolean is_proofgame(slice_index si)
  */
 boolean is_hashtable_allocated(void)
 {
-  return fxfInitialised();
+  return fxfInitialised() || shared_hash_table_is_allocated();
 }
 
 /* Initialise the hashing machinery for the current stipulation
@@ -1822,6 +2257,11 @@ static void inithash(slice_index si)
   dhtRegisterValue(dhtBCMemValue,0,&dhtBCMemoryProcs);
   dhtRegisterValue(dhtSimpleValue,0,&dhtSimpleProcs);
 
+  dhtZobristProcs = dhtBCMemoryProcs;
+  dhtZobristProcs.Hash = &HashZobristValue;
+  dhtZobristProcs.Equal = &EqualZobristValue;
+  dhtRegisterValue(dhtZobristValue,"ZobristValue",&dhtZobristProcs);
+
   ifHASHRATE(use_pos = use_all = 0);
 
   /* check whether a piece can be coded in a single byte */
@@ -1857,6 +2297,16 @@ static void inithash(slice_index si)
 
   bytes_per_piece = one_byte_hash ? 1 : 1+bytes_per_spec;
 
+  if (one_byte_hash)
+    encoded_flags = ByteMask;
+  else
+  {
+    unsigned int i;
+    encoded_flags = 0;
+    for (i = 0; i<bytes_per_spec; i++)
+      encoded_flags |= (Flags)ByteMask<<(CHAR_BIT*i);
+  }
+
   if (is_proofgame(si))
   {
     encode = ProofEncode;
@@ -1867,7 +2317,17 @@ static void inithash(slice_index si)
   {
     unsigned int const Small = TellSmallEncodePosLeng();
     unsigned int const Large = TellLargeEncodePosLeng();
-    if (Small<=Large)
+    unsigned int const Zobrist = TellZobristEncodePosLeng();
+    /* the encoding of the board is included in Small and Large */
+    unsigned int const ZobristComplete = Zobrist + (Small<=Large ? Small : Large);
+    if (Zobrist<Small && Zobrist<Large && ZobristComplete<=UCHAR_MAX)
+    {
+      encode = ZobristEncode;
+      encode_board = Small<=Large ? &SmallEncodeBoard : &LargeEncodeBoard;
+      if (hashtable_kilos>0 && hash_max_number_storable_positions==0)
+        hash_max_number_storable_positions= hashtable_kilos/(ZobristComplete+sizeof(char *)+1);
+    }
+    else if (Small<=Large)
     {
       encode = SmallEncode;
       if (hashtable_kilos>0 && hash_max_number_storable_positions==0)
@@ -1896,24 +2356,179 @@ static void inithash(slice_index si)
 #endif /*TESTHASH,FXF*/
 
 #if defined(FXF)
-  fxfReset();
+  if (!is_table_of_fingerprints)
+    fxfReset();
 #endif
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
 
+/* Calculate the fingerprint that identifies the cache file of the table that
+ * is being opened.
+ * The table is identified by the problem text read so far and by the number
+ * of tables that have been opened since; this relies on the hash encoding
+ * being the same for the same problem text in the same version of Popeye.
+ * @return fingerprint
+ */
+static hash_cache_fingerprint_type calc_cache_fingerprint(void)
+{
+  hash_cache_fingerprint_type const input_fingerprint = InputGetFingerprint();
+  unsigned int const version = (unsigned int)(VERSION*100+0.5);
+  hash_cache_fingerprint_type result;
+
+  if (input_fingerprint==cached_input_fingerprint)
+    ++nr_tables_opened_with_input_fingerprint;
+  else
+  {
+    cached_input_fingerprint = input_fingerprint;
+    nr_tables_opened_with_input_fingerprint = 0;
+  }
+
+  result = input_fingerprint;
+  result ^= (hash_cache_fingerprint_type)nr_tables_opened_with_input_fingerprint<<40;
+  result ^= (hash_cache_fingerprint_type)version<<20;
+
+  return result;
+}
+
+/* Identify how positions and their data are represented in the table: the
+ * encoding function, the length of the pieces and the key in the encodings and
+ * the size of the elements. The same version of Popeye can represent them
+ * differently depending on how it has been built.
+ * @return format of the table for the cache file
+ */
+static hash_cache_format_type calc_cache_format(void)
+{
+  /* increase if an encoding changes without changing these lengths */
+  unsigned int const revision = 1;
+  unsigned int encoding;
+  hash_cache_format_type result;
+
+  if (encode==ProofEncode)
+    encoding = 0;
+  else if (encode==SmallEncode)
+    encoding = 1;
+  else if (encode==LargeEncode)
+    encoding = 2;
+  else if (encode_board==&SmallEncodeBoard)
+    encoding = 3;
+  else
+    encoding = 4;
+
+  result = revision;
+  result = (result<<8) | encoding;
+  result = (result<<8) | bytes_per_piece;
+  result = (result<<8) | sizeof zobrist_key;
+  result = (result<<16) | sizeof(hashElement_union_t);
+  result = (result<<8) | sizeof(hash_cache_data_type);
+
+  return result;
+}
+
+/* Determine whether the table can be saved to the cache file, i.e. whether
+ * solving can't have been cut short so that the table might contain wrong
+ * information
+ * @return true iff the table can be saved
+ */
+static boolean can_cache_be_updated(void)
+{
+  return (!OptFlag[maxsols]
+          && !OptFlag[stoponshort]
+          && !platform_has_maxtime_elapsed());
+}
+
+static boolean is_key_in_table(BCMemValue const *key)
+{
+  return dhtLookupElement(pyhash,key)!=dhtNilElement;
+}
+
+/* Replace the cache file with the current contents of the table and the
+ * records of the cache file that are not in the table (any more)
+ */
+static void save_to_cache(void)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (hash_cache_start_saving(dhtKeyCount(pyhash)+hash_cache_nr_records()))
+  {
+    dhtElement const *he;
+
+    for (he = dhtGetFirstElement(pyhash);
+         he!=0;
+         he = dhtGetNextElement(pyhash))
+    {
+      hashElement_union_t hue;
+      hue.d = *he;
+      hash_cache_save_record(he->Key,hue.e.data);
+    }
+
+    hash_cache_save_cached_records(&is_key_in_table);
+    hash_cache_end_saving();
+
+    /* we have used the table's enumeration */
+    clock_hand = 0;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Save the contents of the hash table to the cache file (if any) while
+ * solving goes on, e.g. at a checkpoint
+ */
+void hash_save_to_cache(void)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (is_cache_used && is_cache_outdated && can_cache_be_updated())
+  {
+    save_to_cache();
+    is_cache_outdated = false;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
 static void openhash(void)
 {
   TraceFunctionEntry(__func__);
   TraceFunctionParamListEnd();
 
   assert(pyhash==0);
-  pyhash = dhtCreate(dhtBCMemValue,dhtCopy,dhtSimpleValue,dhtNoCopy);
-  if (pyhash == dhtNilHashTable)
+
+  if (encode==ZobristEncode)
+    start_maintaining_zobrist_key(encoded_flags);
+
+  /* start with a table of our own even if other processes are using the
+   * shared table concurrently */
+  if (is_table_of_fingerprints)
   {
-    fprintf(stderr, "\nOUT OF SPACE: Unable to create hash table in %s in %s -- aborting.\n", __func__, __FILE__);
-    exit(2); /* TODO: Do we have to exit here? */
+    shared_hash_table_clear();
+    nr_replaced_fingerprints = 0;
+  }
+  else
+  {
+    pyhash = create_table();
+    if (pyhash == dhtNilHashTable)
+    {
+      fprintf(stderr, "\nOUT OF SPACE: Unable to create hash table in %s in %s -- aborting.\n", __func__, __FILE__);
+      exit(2); /* TODO: Do we have to exit here? */
+    }
+
+    /* tables of intelligent mode and of workers don't correspond to a
+     * problem */
+    if (hash_cache_is_enabled()
+        && !OptFlag[intelligent]
+        && parallel_get_nr_workers()<=1)
+    {
+      hash_cache_open(calc_cache_fingerprint(),calc_cache_format());
+      is_cache_used = true;
+      is_cache_outdated = false;
+    }
   }
 
   TraceFunctionExit(__func__);
@@ -1927,7 +2542,7 @@ static void closehash(void)
   TraceFunctionEntry(__func__);
   TraceFunctionParamListEnd();
 
-  assert(pyhash!=0);
+  assert(pyhash!=0 || is_table_of_fingerprints);
 
 #if defined(TESTHASH)
   puts("calling closehash");
@@ -1945,7 +2560,7 @@ static void closehash(void)
 #else /* must HAVE_SBRK */
     unsigned long const HashMem = sbrk(0)-OldBreak;
 #endif /*FXF*/
-    unsigned long const HashCount = pyhash==0 ? 0 : dhtKeyCount(pyhash);
+    unsigned long const HashCount = nr_hashed_positions();
     if (HashCount>0)
     {
       unsigned long const BytePerPos = (HashMem*100)/HashCount;
@@ -1960,8 +2575,19 @@ static void closehash(void)
 #endif /*__unix*/
 #endif /*TESTHASH*/
 
-  dhtDestroy(pyhash);
-  pyhash = 0;
+  if (is_cache_used)
+  {
+    if (is_cache_outdated && can_cache_be_updated())
+      save_to_cache();
+    hash_cache_close();
+    is_cache_used = false;
+  }
+
+  if (!is_table_of_fingerprints)
+    destroy_table();
+
+  if (encode==ZobristEncode)
+    stop_maintaining_zobrist_key();
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
@@ -2202,33 +2828,34 @@ static void addtohash_battle_nosuccess(slice_index si,
                                        stip_length_type n,
                                        stip_length_type min_length_adjusted)
 {
-  HashBuffer const * const hb = &hashBuffers[nbply];
+  HashBuffer * const hb = &hashBuffers[nbply];
   hash_value_type const val = (n+1-min_length_adjusted)/2;
-  dhtElement *he;
+  hashElement_union_t *hue;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParam("%u",min_length_adjusted);
   TraceFunctionParamListEnd();
 
-  he = dhtLookupElement(pyhash,hb);
-  if (he==dhtNilElement)
+  hue = find_element(hb);
+  if (hue==0)
   {
-    hashElement_union_t * const hue = (hashElement_union_t *)allocDHTelement(hb);
+    hue = enter_element(hb);
     set_value_attack_nosuccess(hue,si,val);
   }
   else
   {
-    hashElement_union_t * const hue = (hashElement_union_t *)he;
     if (get_value_attack_nosuccess(hue,si)<val)
       set_value_attack_nosuccess(hue,si,val);
   }
 
+  commit_element(hb,hue);
+
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 
 #if defined(HASHRATE)
-  if (dhtKeyCount(pyhash)%1000 == 0)
+  if (nr_hashed_positions()%1000 == 0)
     HashStats(3, "\n");
 #endif /*HASHRATE*/
 }
@@ -2242,34 +2869,34 @@ static void addtohash_battle_success(slice_index si,
                                      stip_length_type n,
                                      stip_length_type min_length_adjusted)
 {
-  HashBuffer const * const hb = &hashBuffers[nbply];
+  HashBuffer * const hb = &hashBuffers[nbply];
   hash_value_type const val = (n+1-min_length_adjusted)/2 - 1;
-  dhtElement *he;
+  hashElement_union_t *hue;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParam("%u",min_length_adjusted);
   TraceFunctionParamListEnd();
 
-  he = dhtLookupElement(pyhash,hb);
-  if (he==dhtNilElement)
+  hue = find_element(hb);
+  if (hue==0)
   {
-    hashElement_union_t * const
-        hue = (hashElement_union_t *)allocDHTelement(hb);
+    hue = enter_element(hb);
     set_value_attack_success(hue,si,val);
   }
   else
   {
-    hashElement_union_t * const hue = (hashElement_union_t *)he;
     if (get_value_attack_success(hue,si)>val)
       set_value_attack_success(hue,si,val);
   }
 
+  commit_element(hb,hue);
+
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 
 #if defined(HASHRATE)
-  if (dhtKeyCount(pyhash)%1000 == 0)
+  if (nr_hashed_positions()%1000 == 0)
     HashStats(3, "\n");
 #endif /*HASHRATE*/
 }
@@ -2316,7 +2943,7 @@ stip_length_type delegate_can_attack_in_n(slice_index si,
  */
 void attack_hashed_tester_solve(slice_index si)
 {
-  dhtElement const *he;
+  hashElement_union_t const *hue;
   slice_index const base = SLICE_U(si).derived_pipe.base;
   stip_length_type const min_length = SLICE_U(base).branch.min_length;
   stip_length_type const played = SLICE_U(base).branch.length-solve_nr_remaining;
@@ -2334,12 +2961,11 @@ void attack_hashed_tester_solve(slice_index si)
 
   (*encode)(min_length,validity_value);
 
-  he = dhtLookupElement(pyhash,&hashBuffers[nbply]);
-  if (he==dhtNilElement)
+  hue = find_element(&hashBuffers[nbply]);
+  if (hue==0)
     solve_result = delegate_can_attack_in_n(si,min_length_adjusted);
   else
   {
-    hashElement_union_t const * const hue = (hashElement_union_t const *)he;
     stip_length_type const parity = (solve_nr_remaining-min_length_adjusted)%2;
 
     /* It is more likely that a position has no solution. */
@@ -2386,7 +3012,7 @@ static boolean inhash_help(slice_index si)
 {
   boolean result;
   HashBuffer *hb = &hashBuffers[nbply];
-  dhtElement const *he;
+  hashElement_union_t const *hue;
   stip_length_type const validity_value = (solve_nr_remaining-1)/2+1;
 
   TraceFunctionEntry(__func__);
@@ -2404,10 +3030,10 @@ static boolean inhash_help(slice_index si)
 
   ifHASHRATE(use_all++);
 
-  he = dhtLookupElement(pyhash,hb);
-  if (he==dhtNilElement)
+  hue = find_element(hb);
+  if (hue==0)
     result = false;
-  else if (get_value_help((hashElement_union_t const *)he,si)==1)
+  else if (get_value_help(hue,si)==1)
   {
     ifHASHRATE(use_pos++);
     result = true;
@@ -2427,27 +3053,25 @@ static boolean inhash_help(slice_index si)
  */
 static void addtohash_help(slice_index si)
 {
-  HashBuffer const * const hb = &hashBuffers[nbply];
-  dhtElement *he;
-  hashElement_union_t * hue;
+  HashBuffer * const hb = &hashBuffers[nbply];
+  hashElement_union_t *hue;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
 
-  he = dhtLookupElement(pyhash,hb);
-  if (he==dhtNilElement)
-    hue = (hashElement_union_t *)allocDHTelement(hb);
-  else
-    hue = (hashElement_union_t *)he;
+  hue = find_element(hb);
+  if (hue==0)
+    hue = enter_element(hb);
 
   set_value_help(hue,si,1);
+  commit_element(hb,hue);
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 
 #if defined(HASHRATE)
-  if (dhtKeyCount(pyhash)%1000 == 0)
+  if (nr_hashed_positions()%1000 == 0)
     HashStats(3, "\n");
 #endif /*HASHRATE*/
 }
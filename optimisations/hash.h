@@ -34,13 +34,25 @@ typedef union
     byte buffer[hashbuf_length];
 } HashBuffer;
 
-extern HashBuffer hashBuffers[maxply+1];
+extern HashBuffer *hashBuffers;
 
 extern unsigned long  hash_max_number_storable_positions;
 
 /* exported functions */
 void check_hash_assumptions(void);
 
+/* Use a table that stores fixed size fingerprints of the positions rather
+ * than the positions themselves, even if we don't solve in parallel
+ * @note must be invoked before allochash()
+ */
+void hash_use_compact_table(void);
+
+/* Determine whether a table of fingerprints has been requested with
+ * hash_use_compact_table()
+ * @return true iff it has been requested
+ */
+boolean hash_is_compact_table_requested(void);
+
 /* Allocate memory for the hash table. If the requested amount of
  * memory isn't available, reduce the amount until allocation
  * succeeds.
@@ -59,6 +71,11 @@ void HashStats(unsigned int level, char const *trailer);
 void IncHashRateLevel(void);
 void DecHashRateLevel(void);
 
+/* Save the contents of the hash table to the cache file (if any) while
+ * solving goes on, e.g. at a checkpoint
+ */
+void hash_save_to_cache(void);
+
 byte *CommonEncode(byte *bp,
                    stip_length_type min_length,
                    stip_length_type validity_value);
@@ -147,4 +164,8 @@ void help_hashed_tester_solve(slice_index si);
  */
 void solving_insert_hashing(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hash_allocate_ply_tables(void);
+
 #endif
@@ -0,0 +1,390 @@
+#include "optimisations/hash_cache.h"
+#include "platform/mapped_file.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned long long offset_type;
+
+/* A cache file starts with a header, followed by the index, which is an array
+ * of header.nr_slots offsets of records (0 for empty slots), followed by
+ * header.nr_records records. A record consists of a length byte, the bytes of
+ * the key and the data; a record thus starts with the representation of the
+ * key as a BCMemValue.
+ */
+typedef struct
+{
+    offset_type magic;
+    hash_cache_fingerprint_type fingerprint;
+    hash_cache_format_type format;
+    offset_type nr_slots;
+    offset_type nr_records;
+} header_type;
+
+/* identifies cache files written by this version of this module on a platform
+ * with the same byte order */
+static offset_type const magic = 0x3230686361436850ULL;
+
+static char const *directory;
+
+static char *path;
+static char *new_path;
+
+static hash_cache_fingerprint_type current_fingerprint;
+static hash_cache_format_type current_format;
+static unsigned char const *contents;
+static size_t contents_size;
+static header_type header;
+static offset_type const *slots;
+
+static FILE *new_file;
+static offset_type *new_slots;
+static header_type new_header;
+static offset_type new_file_size;
+static unsigned long new_max_nr_records;
+static boolean is_saving_ok;
+
+/* Calculate the hash value of a key
+ * @param key the key
+ * @return hash value
+ */
+static offset_type calc_hash(BCMemValue const *key)
+{
+  /* FNV-1a */
+  offset_type result = 0xcbf29ce484222325ULL;
+  unsigned int i;
+
+  for (i = 0; i!=key->Leng; ++i)
+  {
+    result ^= key->Data[i];
+    result *= 0x100000001b3ULL;
+  }
+
+  result ^= result>>33;
+  result *= 0xff51afd7ed558ccdULL;
+  result ^= result>>33;
+
+  return result;
+}
+
+static offset_type record_size(BCMemValue const *key)
+{
+  return 1+key->Leng+sizeof(hash_cache_data_type);
+}
+
+/* Determine whether a record lies entirely inside the mapped file
+ * @param offset offset of the record
+ * @param key key of the record
+ */
+static boolean is_record_in_contents(offset_type offset, BCMemValue const *key)
+{
+  return record_size(key)<=contents_size && offset<=contents_size-record_size(key);
+}
+
+static offset_type index_offset(void)
+{
+  return sizeof(header_type);
+}
+
+static offset_type records_offset(header_type const *h)
+{
+  return index_offset()+h->nr_slots*sizeof(offset_type);
+}
+
+/* Determine whether the mapped file is a cache file that we can use
+ * @return true iff we can use it
+ */
+static boolean is_contents_valid(void)
+{
+  if (contents_size<sizeof header)
+    return false;
+  else
+  {
+    memcpy(&header,contents,sizeof header);
+    return (header.magic==magic
+            && header.fingerprint==current_fingerprint
+            && header.format==current_format
+            && header.nr_slots>0
+            && (header.nr_slots&(header.nr_slots-1))==0
+            && header.nr_slots<=(contents_size-index_offset())/sizeof(offset_type)
+            && header.nr_records<header.nr_slots);
+  }
+}
+
+static void unmap_contents(void)
+{
+  if (contents!=0)
+  {
+    platform_unmap_file(contents,contents_size);
+    contents = 0;
+    slots = 0;
+  }
+}
+
+/* Set the directory where the cache files are kept
+ * @param path path of the directory
+ */
+void hash_cache_set_directory(char const *path)
+{
+  directory = path;
+}
+
+static void map_contents(void)
+{
+  contents = platform_map_file(path,&contents_size);
+  if (contents!=0)
+  {
+    if (is_contents_valid())
+      slots = (offset_type const *)(contents+index_offset());
+    else
+      unmap_contents();
+  }
+}
+
+/* Determine whether the contents of the hash table are to be cached
+ * @return true iff a cache directory has been set
+ */
+boolean hash_cache_is_enabled(void)
+{
+  return directory!=0;
+}
+
+/* Open the cache file for a fingerprint. It's not an error if there is no
+ * such file yet.
+ * @param fingerprint fingerprint of what is being solved
+ * @param format format of the keys and data; a file written in a different
+ *               format is ignored (and replaced when saving)
+ */
+void hash_cache_open(hash_cache_fingerprint_type fingerprint,
+                     hash_cache_format_type format)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  assert(directory!=0);
+  assert(contents==0);
+
+  if (path==0)
+  {
+    /* directory + '/' + 16 hex digits + ".pyh" + ".new" */
+    size_t const length = strlen(directory)+1+16+4+4+1;
+    path = malloc(length);
+    new_path = malloc(length);
+  }
+
+  current_fingerprint = fingerprint;
+  current_format = format;
+
+  if (path!=0 && new_path!=0)
+  {
+    sprintf(path,"%s/%016llx.pyh",directory,fingerprint);
+    sprintf(new_path,"%s.new",path);
+
+    map_contents();
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Close the cache file opened by hash_cache_open()
+ */
+void hash_cache_close(void)
+{
+  unmap_contents();
+}
+
+/* Determine the number of records in the cache file
+ * @return number of records; 0 if there is no cache file
+ */
+unsigned long hash_cache_nr_records(void)
+{
+  return contents==0 ? 0 : (unsigned long)header.nr_records;
+}
+
+/* Look up a key in the cache file
+ * @param key the key
+ * @param data where to store the data of the record if the key is found
+ * @return true iff the key was found
+ */
+boolean hash_cache_lookup(BCMemValue const *key, hash_cache_data_type *data)
+{
+  if (contents!=0)
+  {
+    offset_type const mask = header.nr_slots-1;
+    offset_type slot = calc_hash(key)&mask;
+    offset_type nr_probes;
+
+    for (nr_probes = 0;
+         nr_probes!=header.nr_slots && slots[slot]!=0;
+         ++nr_probes, slot = (slot+1)&mask)
+    {
+      offset_type const offset = slots[slot];
+      if (is_record_in_contents(offset,key)
+          && contents[offset]==key->Leng
+          && memcmp(contents+offset+1,key->Data,key->Leng)==0)
+      {
+        memcpy(data,contents+offset+1+key->Leng,sizeof *data);
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+/* Start writing a new version of the cache file
+ * @param max_nr_records maximum number of records that will be saved
+ * @return true iff saving could be started
+ */
+boolean hash_cache_start_saving(unsigned long max_nr_records)
+{
+  boolean result = false;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%lu",max_nr_records);
+  TraceFunctionParamListEnd();
+
+  assert(new_file==0);
+
+  if (path!=0 && new_path!=0)
+  {
+    /* keep the index at most half full */
+    new_header.magic = magic;
+    new_header.fingerprint = current_fingerprint;
+    new_header.format = current_format;
+    new_header.nr_slots = 1;
+    while (new_header.nr_slots<=2*(offset_type)max_nr_records)
+      new_header.nr_slots *= 2;
+    new_header.nr_records = 0;
+
+    if (new_header.nr_slots<=((size_t)-1)/sizeof *new_slots)
+      new_slots = calloc((size_t)new_header.nr_slots,sizeof *new_slots);
+
+    if (new_slots!=0)
+    {
+      new_file = fopen(new_path,"wb");
+      if (new_file==0)
+      {
+        free(new_slots);
+        new_slots = 0;
+      }
+      else
+      {
+        /* reserve space for header and index; they are written at the end */
+        is_saving_ok = (fwrite(&new_header,sizeof new_header,1,new_file)==1
+                        && fwrite(new_slots,
+                                  sizeof *new_slots,(size_t)new_header.nr_slots,
+                                  new_file)==new_header.nr_slots);
+        new_file_size = records_offset(&new_header);
+        new_max_nr_records = max_nr_records;
+        result = true;
+      }
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Save a record to the new version of the cache file
+ * @param key the key
+ * @param data the data
+ */
+void hash_cache_save_record(BCMemValue const *key, hash_cache_data_type data)
+{
+  assert(new_file!=0);
+  assert(new_header.nr_records<new_max_nr_records);
+
+  if (is_saving_ok && new_header.nr_records<new_max_nr_records)
+  {
+    offset_type const mask = new_header.nr_slots-1;
+    offset_type slot = calc_hash(key)&mask;
+
+    while (new_slots[slot]!=0)
+      slot = (slot+1)&mask;
+    new_slots[slot] = new_file_size;
+
+    is_saving_ok = (fwrite(key,1,1u+key->Leng,new_file)==1u+key->Leng
+                    && fwrite(&data,sizeof data,1,new_file)==1);
+
+    new_file_size += record_size(key);
+    ++new_header.nr_records;
+  }
+}
+
+/* Copy the records of the current version of the cache file to the new one
+ * @param is_superseded identifies the keys that are not to be copied
+ */
+void hash_cache_save_cached_records(hash_cache_key_filter_type is_superseded)
+{
+  if (contents!=0)
+  {
+    offset_type offset = records_offset(&header);
+    offset_type i;
+
+    for (i = 0; i!=header.nr_records && offset<contents_size; ++i)
+    {
+      BCMemValue const * const key = (BCMemValue const *)(contents+offset);
+      if (!is_record_in_contents(offset,key))
+        break;
+      else
+      {
+        if (!(*is_superseded)(key))
+        {
+          hash_cache_data_type data;
+          memcpy(&data,contents+offset+1+key->Leng,sizeof data);
+          hash_cache_save_record(key,data);
+        }
+
+        offset += record_size(key);
+      }
+    }
+  }
+}
+
+/* Replace the current version of the cache file with the new one
+ */
+void hash_cache_end_saving(void)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  assert(new_file!=0);
+
+  if (is_saving_ok)
+    is_saving_ok = (fseek(new_file,0,SEEK_SET)==0
+                    && fwrite(&new_header,sizeof new_header,1,new_file)==1
+                    && fwrite(new_slots,
+                              sizeof *new_slots,(size_t)new_header.nr_slots,
+                              new_file)==new_header.nr_slots);
+
+  if (fclose(new_file)!=0)
+    is_saving_ok = false;
+  new_file = 0;
+
+  free(new_slots);
+  new_slots = 0;
+
+  if (is_saving_ok)
+  {
+    /* some platforms refuse to rename to an existing file */
+    unmap_contents();
+    remove(path);
+    if (rename(new_path,path)!=0)
+      remove(new_path);
+
+    /* solving may go on, e.g. after a checkpoint */
+    map_contents();
+  }
+  else
+    remove(new_path);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,87 @@
+#if !defined(OPTIMISATIONS_HASH_CACHE_H)
+#define OPTIMISATIONS_HASH_CACHE_H
+
+#include "DHT/dhtbcmem.h"
+#include "utilities/boolean.h"
+
+/* This module implements keeping the contents of the hash table in files
+ * between runs of Popeye, so that a problem that is solved again doesn't
+ * have to start with an empty table.
+ *
+ * There is one file per fingerprint of what is being solved. A file holds an
+ * open addressed index of record offsets followed by the records themselves,
+ * each consisting of the complete key and the data of a table element. Files
+ * are accessed through platform_map_file(), so that the records are only
+ * read from disk when a position is looked up.
+ */
+
+typedef unsigned int hash_cache_data_type;
+typedef unsigned long long hash_cache_fingerprint_type;
+
+/* identifies the encoding of the keys and the layout of the data, which can
+ * differ between builds of the same version */
+typedef unsigned long long hash_cache_format_type;
+
+/* Determine whether a key is superseded by a key that has been saved
+ * @param key the key
+ * @return true iff the key has been saved
+ */
+typedef boolean (*hash_cache_key_filter_type)(BCMemValue const *key);
+
+/* Set the directory where the cache files are kept
+ * @param path path of the directory
+ */
+void hash_cache_set_directory(char const *path);
+
+/* Determine whether the contents of the hash table are to be cached
+ * @return true iff a cache directory has been set
+ */
+boolean hash_cache_is_enabled(void);
+
+/* Open the cache file for a fingerprint. It's not an error if there is no
+ * such file yet.
+ * @param fingerprint fingerprint of what is being solved
+ * @param format format of the keys and data; a file written in a different
+ *               format is ignored (and replaced when saving)
+ */
+void hash_cache_open(hash_cache_fingerprint_type fingerprint,
+                     hash_cache_format_type format);
+
+/* Close the cache file opened by hash_cache_open()
+ */
+void hash_cache_close(void);
+
+/* Determine the number of records in the cache file
+ * @return number of records; 0 if there is no cache file
+ */
+unsigned long hash_cache_nr_records(void);
+
+/* Look up a key in the cache file
+ * @param key the key
+ * @param data where to store the data of the record if the key is found
+ * @return true iff the key was found
+ */
+boolean hash_cache_lookup(BCMemValue const *key, hash_cache_data_type *data);
+
+/* Start writing a new version of the cache file
+ * @param max_nr_records maximum number of records that will be saved
+ * @return true iff saving could be started
+ */
+boolean hash_cache_start_saving(unsigned long max_nr_records);
+
+/* Save a record to the new version of the cache file
+ * @param key the key
+ * @param data the data
+ */
+void hash_cache_save_record(BCMemValue const *key, hash_cache_data_type data);
+
+/* Copy the records of the current version of the cache file to the new one
+ * @param is_superseded identifies the keys that are not to be copied
+ */
+void hash_cache_save_cached_records(hash_cache_key_filter_type is_superseded);
+
+/* Replace the current version of the cache file with the new one
+ */
+void hash_cache_end_saving(void);
+
+#endif
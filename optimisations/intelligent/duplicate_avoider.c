@@ -12,6 +12,7 @@
 #include "debugging/assert.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /* This module provides the slice type STIntelligentDuplicateAvoider
  * which avoids producing certain solutions twice in intelligent mode
@@ -27,15 +28,54 @@ typedef struct
     piece_walk_type   prom;
 } simplified_move_type;
 
-static simplified_move_type **stored_solutions;
+/* The solutions found so far are stored one after the other in a single
+ * arena; an open addressing hash set of references to the stored solutions
+ * allows a solution to be looked up in constant time.
+ */
+typedef struct
+{
+    unsigned long hash_value;
+    size_t start;       /* index of the solution's first move in the arena */
+    unsigned int length;
+} stored_solution_type;
+
+enum
+{
+  initial_nr_slots = 1<<10,
+  initial_arena_capacity = 1<<12
+};
+
+static simplified_move_type *arena;
+static size_t arena_size;
+static size_t arena_capacity;
 
-static unsigned int nr_stored_solutions;
+/* nr_slots is 0 or a power of 2; slots with length 0 are empty */
+static stored_solution_type *slots;
+static size_t nr_slots;
+static size_t nr_stored_solutions;
+
+/* set if we have run out of memory while solving the current problem */
+static boolean is_out_of_memory;
+
+/* the moves of the current solution, as collected by collect_solution() */
+static simplified_move_type *current_solution;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void intelligent_duplicate_avoider_allocate_ply_tables(void)
+{
+  current_solution = ply_allocate_table(maxply+1,sizeof current_solution[0]);
+}
 
 /* Initialise the duplication avoidance machinery
  */
 void intelligent_duplicate_avoider_init(void)
 {
+  arena_size = 0;
+  if (slots!=0)
+    memset(slots,0,nr_slots * sizeof *slots);
   nr_stored_solutions = 0;
+  is_out_of_memory = false;
 }
 
 /* Cleanup the duplication avoidance machinery
@@ -45,38 +85,28 @@ void intelligent_duplicate_avoider_cleanup(void)
   TraceFunctionEntry(__func__);
   TraceFunctionParamListEnd();
 
-  if (nr_stored_solutions>0)
-  {
-    simplified_move_type **sol;
-    for (sol = stored_solutions;
-         sol!=stored_solutions+nr_stored_solutions;
-         ++sol)
-      free(*sol);
+  free(arena);
+  arena = 0;
+  arena_size = 0;
+  arena_capacity = 0;
 
-    free(stored_solutions);
-  }
+  free(slots);
+  slots = 0;
+  nr_slots = 0;
+  nr_stored_solutions = 0;
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
 
-/* Allocate room for storing the current solution
- * @return true iff room could be allocated
+/* Give up avoiding duplicate solutions for the rest of the current problem
+ * because we have run out of memory; solving continues
  */
-static boolean alloc_room_for_solution(void)
+static void give_up(void)
 {
-  boolean result;
-
-  if (stored_solutions==NULL)
-    result = false;
-  else
-  {
-    simplified_move_type ** const sol = stored_solutions+nr_stored_solutions;
-    *sol = ((nbply < ((size_t)-1)) ? ((simplified_move_type *) calloc((nbply+(size_t)1), sizeof **sol)) : NULL);
-    result = *sol!=NULL;
-  }
-
-  return result;
+  intelligent_duplicate_avoider_cleanup();
+  fputs("Cannot (re)allocate enough memory\n",stderr);
+  is_out_of_memory = true;
 }
 
 static piece_walk_type get_promotion_walk(ply ply)
@@ -89,56 +119,181 @@ static piece_walk_type get_promotion_walk(ply ply)
     return Empty;
 }
 
-/* Store the current solution in order to avoid writing it again later
+/* Copy the moves of the current solution to current_solution, starting with
+ * the last one
+ * @return number of moves copied
  */
-static void store_solution(void)
+static unsigned int collect_solution(void)
 {
-  TraceFunctionEntry(__func__);
-  TraceFunctionParamListEnd();
+  unsigned int result = 0;
+  ply cp;
 
-  if (nr_stored_solutions < (((size_t) -1) / (sizeof *stored_solutions)))
-    /* The new size won't overflow, so continue. */
-    if (nr_stored_solutions>0)
-    {
-      size_t const size = (nr_stored_solutions+1) * sizeof *stored_solutions;
-      void * const tmp = realloc(stored_solutions,size);
-      if (tmp==NULL)
-      {
-        intelligent_duplicate_avoider_cleanup();
-        nr_stored_solutions = 0;
-      }
-      stored_solutions = (simplified_move_type **) tmp;
-    }
-    else
-      stored_solutions = (simplified_move_type **) malloc(sizeof *stored_solutions);
-  else
+  for (cp = nbply; cp>ply_retro_move; cp = parent_ply[cp])
   {
-    /* The new size will overflow, so give up. */
-    intelligent_duplicate_avoider_cleanup();
-    stored_solutions = NULL;
-    nr_stored_solutions = 0;
+    simplified_move_type * const elmt = current_solution+result;
+    elmt->from = move_generation_stack[CURRMOVE_OF_PLY(cp)].departure;
+    elmt->to = move_generation_stack[CURRMOVE_OF_PLY(cp)].arrival;
+    elmt->prom = get_promotion_walk(cp);
+    ++result;
   }
 
-  if (!alloc_room_for_solution())
+  return result;
+}
+
+static unsigned long hash_solution(simplified_move_type const solution[],
+                                   unsigned int length)
+{
+  /* FNV-1a over the move components */
+  unsigned long result = 2166136261UL;
+  unsigned int i;
+
+  for (i = 0; i!=length; ++i)
   {
-    intelligent_duplicate_avoider_cleanup();
-    fputs("Cannot (re)allocate enough memory\n",stderr);
-    exit(EXIT_FAILURE);
+    result = (result^(unsigned long)solution[i].from)*16777619UL;
+    result = (result^(unsigned long)solution[i].to)*16777619UL;
+    result = (result^(unsigned long)solution[i].prom)*16777619UL;
   }
 
+  return result;
+}
+
+static boolean is_stored_solution(stored_solution_type const *slot,
+                                  unsigned long hash_value,
+                                  simplified_move_type const solution[],
+                                  unsigned int length)
+{
+  simplified_move_type const * const stored = arena+slot->start;
+  unsigned int i;
+
+  if (slot->hash_value!=hash_value || slot->length!=length)
+    return false;
+
+  for (i = 0; i!=length; ++i)
+    if (stored[i].from!=solution[i].from
+        || stored[i].to!=solution[i].to
+        || stored[i].prom!=solution[i].prom)
+      return false;
+
+  return true;
+}
+
+/* Find the slot where a solution is stored or would be stored
+ * @return address of the slot; its length is 0 if the solution isn't stored
+ */
+static stored_solution_type *find_slot(unsigned long hash_value,
+                                       simplified_move_type const solution[],
+                                       unsigned int length)
+{
+  size_t const mask = nr_slots-1;
+  size_t i = hash_value & mask;
+
+  while (slots[i].length!=0
+         && !is_stored_solution(slots+i,hash_value,solution,length))
+    i = (i+1) & mask;
+
+  return slots+i;
+}
+
+/* Double the number of slots of the hash set (or allocate the initial ones)
+ * @return true iff the slots could be allocated
+ */
+static boolean grow_slots(void)
+{
+  stored_solution_type * const old_slots = slots;
+  size_t const old_nr_slots = nr_slots;
+  size_t const new_nr_slots = nr_slots==0 ? initial_nr_slots : 2*nr_slots;
+  size_t i;
+
+  if (new_nr_slots > ((size_t)-1)/sizeof *slots)
+    return false;
+
+  slots = calloc(new_nr_slots,sizeof *slots);
+  if (slots==0)
   {
-    simplified_move_type ** const sol = stored_solutions+nr_stored_solutions;
-    ply cp;
-    for (cp = nbply; cp>ply_retro_move; cp = parent_ply[cp])
+    slots = old_slots;
+    return false;
+  }
+
+  nr_slots = new_nr_slots;
+
+  for (i = 0; i!=old_nr_slots; ++i)
+    if (old_slots[i].length!=0)
     {
-      simplified_move_type * const elmt = *sol + cp;
-      elmt->from = move_generation_stack[CURRMOVE_OF_PLY(cp)].departure;
-      elmt->to = move_generation_stack[CURRMOVE_OF_PLY(cp)].arrival;
-      elmt->prom = get_promotion_walk(cp);
+      size_t const mask = nr_slots-1;
+      size_t j = old_slots[i].hash_value & mask;
+      while (slots[j].length!=0)
+        j = (j+1) & mask;
+      slots[j] = old_slots[i];
     }
+
+  free(old_slots);
+
+  return true;
+}
+
+/* Make room for at least length additional moves in the arena
+ * @return true iff there is enough room
+ */
+static boolean reserve_arena(unsigned int length)
+{
+  if (arena_capacity-arena_size<length)
+  {
+    size_t new_capacity = arena_capacity==0 ? initial_arena_capacity : arena_capacity;
+    simplified_move_type *new_arena;
+
+    while (new_capacity-arena_size<length)
+      new_capacity *= 2;
+
+    if (new_capacity > ((size_t)-1)/sizeof *arena)
+      return false;
+
+    new_arena = realloc(arena,new_capacity * sizeof *arena);
+    if (new_arena==0)
+      return false;
+
+    arena = new_arena;
+    arena_capacity = new_capacity;
   }
 
-  ++nr_stored_solutions;
+  return true;
+}
+
+/* Store the current solution in order to avoid writing it again later
+ */
+static void store_solution(void)
+{
+  unsigned int const length = collect_solution();
+  unsigned long const hash_value = hash_solution(current_solution,length);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (!is_out_of_memory)
+  {
+    /* keep the load factor of the hash set at most 1/2 */
+    if (2*(nr_stored_solutions+1)>nr_slots && !grow_slots())
+      give_up();
+    else
+    {
+      stored_solution_type * const slot = find_slot(hash_value,current_solution,length);
+      if (slot->length==0)
+      {
+        if (reserve_arena(length))
+        {
+          memcpy(arena+arena_size,current_solution,length * sizeof *arena);
+
+          slot->hash_value = hash_value;
+          slot->start = arena_size;
+          slot->length = length;
+
+          arena_size += length;
+          ++nr_stored_solutions;
+        }
+        else
+          give_up();
+      }
+    }
+  }
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
@@ -154,23 +309,11 @@ static boolean is_duplicate_solution(void)
   TraceFunctionEntry(__func__);
   TraceFunctionParamListEnd();
 
-  for (unsigned int sol_index = 0;
-       sol_index<nr_stored_solutions && !found;
-       ++sol_index)
+  if (nr_stored_solutions>0)
   {
-    found = true;
-
-    for (ply cp = nbply; cp>ply_retro_move; cp = parent_ply[cp])
-    {
-      const simplified_move_type * const elmt = stored_solutions[sol_index] + cp;
-      if (elmt->from!=move_generation_stack[CURRMOVE_OF_PLY(cp)].departure
-               || elmt->to!=move_generation_stack[CURRMOVE_OF_PLY(cp)].arrival
-               || elmt->prom!=get_promotion_walk(cp))
-      {
-        found = false;
-        break;
-      }
-    }
+    unsigned int const length = collect_solution();
+    unsigned long const hash_value = hash_solution(current_solution,length);
+    found = find_slot(hash_value,current_solution,length)->length!=0;
   }
 
   TraceFunctionExit(__func__);
@@ -45,4 +45,8 @@ void intelligent_duplicate_avoider_solve(slice_index si);
  */
 void intelligent_solution_rememberer_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void intelligent_duplicate_avoider_allocate_ply_tables(void);
+
 #endif
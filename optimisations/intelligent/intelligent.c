@@ -17,6 +17,7 @@
 #include "solving/check.h"
 #include "solving/temporary_hacks.h"
 #include "solving/pipe.h"
+#include "solving/parallel/root_moves.h"
 #include "stipulation/help_play/branch.h"
 #include "stipulation/fork.h"
 #include "stipulation/pipe.h"
@@ -63,13 +64,25 @@ boolean solutions_found;
 
 boolean testcastling;
 
-unsigned int MovesRequired[nr_sides][maxply+1];
-unsigned int CapturesLeft[maxply+1];
+unsigned int *MovesRequired[nr_sides];
+unsigned int *CapturesLeft;
 
 unsigned int PieceId2index[MaxPieceId+1];
 
 unsigned int nr_reasons_for_staying_empty[maxsquare+4];
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void intelligent_allocate_ply_tables(void)
+{
+  Side side;
+
+  for (side = White; side!=nr_sides; ++side)
+    MovesRequired[side] = ply_allocate_table(maxply+1,sizeof MovesRequired[side][0]);
+
+  CapturesLeft = ply_allocate_table(maxply+1,sizeof CapturesLeft[0]);
+}
+
 typedef struct
 {
   Flags       spec[nr_squares_on_board];
@@ -405,21 +418,26 @@ static void GenerateBlackKing(slice_index si)
         }
       }
 
-      occupy_square(*bnp,King,king_flags);
-      being_solved.king_square[Black] = *bnp;
-      black[index_of_king].usage = piece_is_king;
+      if (parallel_claim_target_positions())
+      {
+        occupy_square(*bnp,King,king_flags);
+        being_solved.king_square[Black] = *bnp;
+        black[index_of_king].usage = piece_is_king;
+
+        init_guard_dirs(*bnp);
 
-      init_guard_dirs(*bnp);
+        if (goal_to_be_reached==goal_mate)
+        {
+          intelligent_mate_generate_checking_moves(si);
+          intelligent_mate_generate_doublechecking_moves(si);
+        }
+        else
+          pipe_solve_delegate(si);
 
-      if (goal_to_be_reached==goal_mate)
-      {
-        intelligent_mate_generate_checking_moves(si);
-        intelligent_mate_generate_doublechecking_moves(si);
-      }
-      else
-        pipe_solve_delegate(si);
+        empty_square(*bnp);
 
-      empty_square(*bnp);
+        parallel_target_positions_enumerated();
+      }
 
       intelligent_unreserve();
     }
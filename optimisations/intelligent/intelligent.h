@@ -32,7 +32,7 @@ extern PIECE target_position[MaxPieceId+1];
 enum { index_of_king = 0 };
 
 extern unsigned int MaxPiece[nr_sides];
-extern unsigned int CapturesLeft[maxply+1];
+extern unsigned int *CapturesLeft;
 
 extern boolean solutions_found;
 
@@ -44,7 +44,7 @@ extern unsigned int moves_to_white_prom[nr_squares_on_board];
 
 extern boolean testcastling;
 
-extern unsigned int MovesRequired[nr_sides][maxply+1];
+extern unsigned int *MovesRequired[nr_sides];
 
 extern unsigned int PieceId2index[MaxPieceId+1];
 
@@ -73,4 +73,8 @@ boolean is_line_empty(square start, square end, int dir);
  */
 boolean init_intelligent_mode(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void intelligent_allocate_ply_tables(void);
+
 #endif
@@ -13,7 +13,14 @@
 
 #include "debugging/assert.h"
 
-static unsigned int OpeningsRequired[maxply+1];
+static unsigned int *OpeningsRequired;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void goalreachable_guard_mate_allocate_ply_tables(void)
+{
+  OpeningsRequired = ply_allocate_table(maxply+1,sizeof OpeningsRequired[0]);
+}
 
 static boolean mate_isGoalReachable(void)
 {
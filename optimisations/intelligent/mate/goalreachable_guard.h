@@ -18,4 +18,8 @@
  */
 void goalreachable_guard_mate_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void goalreachable_guard_mate_allocate_ply_tables(void);
+
 #endif
@@ -14,6 +14,8 @@
 #include "optimisations/orthodox_check_directions.h"
 #include "optimisations/intelligent/count_nr_of_moves.h"
 #include "optimisations/intelligent/moves_left.h"
+#include "optimisations/intelligent/proof_backward.h"
+#include "options/options.h"
 #include "output/plaintext/plaintext.h"
 #include "output/plaintext/pieces.h"
 #include "position/effects/piece_movement.h"
@@ -22,9 +24,13 @@
 #include "debugging/trace.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 static boolean ProofFairy;
 
+/* use the backward search from the target position (option Bidirectional)? */
+static boolean is_backward_search_used;
+
 static unsigned int KingMoves[nr_sides][maxsquare];
 
 enum
@@ -676,6 +682,210 @@ static stip_length_type ArrangePawns(stip_length_type CapturesAllowed,
   return Diff;
 }
 
+/* The bounds computed by ArrangePawns() and ArrangePieces() for a side only
+ * depend on
+ * - the target position (and the blocked and captured officers derived from it)
+ * - the length being solved
+ * - the numbers of captures allowed and required
+ * - the pieces that are not yet on their target squares and the target
+ *   squares that are not yet occupied: those of the pawns of the side for
+ *   ArrangePawns(), those of the side and the pawns of both sides for
+ *   ArrangePieces() (because pawns on their target squares may block the way)
+ * The same such differences keep reappearing in proof game search
+ * (independently of what the other side does), so the bounds are remembered
+ * in direct mapped tables. The tables survive from one problem to the next
+ * and are only cleared if the target position or the holes change.
+ * Unlike the hash table (cf. optimisations/hash_cache.c), the tables are not
+ * kept in a file mapped with platform/mapped_file.h: their entries are only
+ * valid for one target position, and the officer bounds depend on the pawns
+ * blocking the way, so there is no square-to-square distance table that
+ * could be shared by all problems.
+ */
+enum
+{
+  nr_walk_planes = 3, /* King..Bishop fit into 3 bits */
+  nr_pawn_arrangements = 1<<12,
+  nr_piece_arrangements = 1<<14
+};
+
+typedef struct
+{
+    bitboard_type pawns_to_be_arranged[nr_sides];
+    bitboard_type proof_pawns[nr_sides];
+    bitboard_type officers_to_be_arranged[nr_walk_planes];
+    bitboard_type proof_officers;
+    stip_length_type length;
+    stip_length_type captures_allowed;
+    stip_length_type captures_required;
+    Side side;
+} arrangement_key_type;
+
+typedef struct
+{
+    arrangement_key_type key;
+    boolean is_used;
+    stip_length_type moves;
+    stip_length_type captures_required;
+} arrangement_type;
+
+static arrangement_type pawn_arrangements[nr_pawn_arrangements];
+static arrangement_type piece_arrangements[nr_piece_arrangements];
+
+/* differences between the position being solved and the target position */
+static bitboard_type pawns_to_be_arranged[nr_sides];
+static bitboard_type proof_pawns[nr_sides];
+static bitboard_type officers_to_be_arranged[nr_sides][nr_walk_planes];
+static bitboard_type proof_officers[nr_sides];
+
+/* target position and holes that the tables were filled for */
+static piece_walk_type target_walks[nr_squares_on_board];
+static Flags target_colours[nr_squares_on_board];
+static boolean target_holes[nr_squares_on_board];
+
+static void add_walk_to_planes(piece_walk_type walk,
+                               bitboard_type bit,
+                               bitboard_type planes[nr_walk_planes])
+{
+  assert(walk<=Bishop);
+  if (walk&1)
+    planes[0] |= bit;
+  if (walk&2)
+    planes[1] |= bit;
+  if (walk&4)
+    planes[2] |= bit;
+}
+
+static void forget_arrangements_if_target_or_holes_changed(void)
+{
+  boolean changed = false;
+  unsigned int i;
+
+  for (i = 0; boardnum[i]; ++i)
+  {
+    square const sq = boardnum[i];
+    piece_walk_type const walk = proofgames_target_position.board[sq];
+    Flags const colours = proofgames_target_position.spec[sq]&COLOURFLAGS;
+    boolean const hole = is_square_blocked(sq);
+
+    if (walk!=target_walks[i] || colours!=target_colours[i] || hole!=target_holes[i])
+    {
+      target_walks[i] = walk;
+      target_colours[i] = colours;
+      target_holes[i] = hole;
+      changed = true;
+    }
+  }
+
+  if (changed)
+  {
+    memset(pawn_arrangements,0,sizeof pawn_arrangements);
+    memset(piece_arrangements,0,sizeof piece_arrangements);
+  }
+}
+
+static unsigned long hash_bitboard(unsigned long hash_value, bitboard_type bb)
+{
+  /* FNV-1a */
+  return (hash_value^(unsigned long)(bb^(bb>>32)))*16777619UL;
+}
+
+static unsigned long hash_arrangement_key(arrangement_key_type const *key)
+{
+  unsigned long result = 2166136261UL;
+  unsigned int i;
+
+  for (i = 0; i!=nr_sides; ++i)
+  {
+    result = hash_bitboard(result,key->pawns_to_be_arranged[i]);
+    result = hash_bitboard(result,key->proof_pawns[i]);
+  }
+  for (i = 0; i!=nr_walk_planes; ++i)
+    result = hash_bitboard(result,key->officers_to_be_arranged[i]);
+  result = hash_bitboard(result,key->proof_officers);
+  result = (result^key->length)*16777619UL;
+  result = (result^key->captures_allowed)*16777619UL;
+  result = (result^key->captures_required)*16777619UL;
+  result = (result^(unsigned long)key->side)*16777619UL;
+
+  return result;
+}
+
+/* Find the slot of an arrangement in a table
+ * @param table table of arrangements
+ * @param nr_slots number of slots of table (a power of 2)
+ * @param key key of the arrangement
+ * @return address of the slot; it is used iff the arrangement has been
+ *         remembered before
+ */
+static arrangement_type *find_arrangement(arrangement_type table[],
+                                          unsigned long nr_slots,
+                                          arrangement_key_type const *key)
+{
+  arrangement_type * const result = &table[hash_arrangement_key(key)&(nr_slots-1)];
+
+  if (result->is_used && memcmp(&result->key,key,sizeof *key)!=0)
+    result->is_used = false;
+
+  return result;
+}
+
+static stip_length_type ArrangePawnsMemoised(stip_length_type CapturesAllowed,
+                                             Side camp,
+                                             stip_length_type *CapturesRequired)
+{
+  arrangement_key_type key;
+  arrangement_type *arrangement;
+
+  memset(&key,0,sizeof key);
+  key.pawns_to_be_arranged[camp] = pawns_to_be_arranged[camp];
+  key.proof_pawns[camp] = proof_pawns[camp];
+  key.length = current_length;
+  key.captures_allowed = CapturesAllowed;
+  key.side = camp;
+
+  arrangement = find_arrangement(pawn_arrangements,nr_pawn_arrangements,&key);
+  if (!arrangement->is_used)
+  {
+    arrangement->key = key;
+    arrangement->is_used = true;
+    arrangement->captures_required = 0;
+    arrangement->moves = ArrangePawns(CapturesAllowed,
+                                      camp,
+                                      &arrangement->captures_required);
+  }
+
+  *CapturesRequired = arrangement->captures_required;
+  return arrangement->moves;
+}
+
+static stip_length_type ArrangePiecesMemoised(stip_length_type CapturesAllowed,
+                                              Side camp,
+                                              stip_length_type CapturesRequired)
+{
+  arrangement_key_type key;
+  arrangement_type *arrangement;
+
+  memset(&key,0,sizeof key);
+  memcpy(key.pawns_to_be_arranged,pawns_to_be_arranged,sizeof key.pawns_to_be_arranged);
+  memcpy(key.proof_pawns,proof_pawns,sizeof key.proof_pawns);
+  memcpy(key.officers_to_be_arranged,officers_to_be_arranged[camp],sizeof key.officers_to_be_arranged);
+  key.proof_officers = proof_officers[camp];
+  key.length = current_length;
+  key.captures_allowed = CapturesAllowed;
+  key.captures_required = CapturesRequired;
+  key.side = camp;
+
+  arrangement = find_arrangement(piece_arrangements,nr_piece_arrangements,&key);
+  if (!arrangement->is_used)
+  {
+    arrangement->key = key;
+    arrangement->is_used = true;
+    arrangement->moves = ArrangePieces(CapturesAllowed,camp,CapturesRequired);
+  }
+
+  return arrangement->moves;
+}
+
 static boolean FairyImpossible(void)
 {
   square const *bnp;
@@ -919,6 +1129,7 @@ static boolean Impossible(void)
   stip_length_type moves_left[nr_sides] = { MovesLeft[White], MovesLeft[Black] };
   stip_length_type to_be_captured[nr_sides];
   stip_length_type captures_required[nr_sides];
+  bitboard_type bit = 1;
   square    sq;
   unsigned int Nbr[nr_sides];
 
@@ -1068,7 +1279,13 @@ static boolean Impossible(void)
   PawnsToBeArranged[Black].Nbr = 0;
   PiecesToBeArranged[Black].Nbr= 0;
 
-  for (bnp = boardnum; *bnp; bnp++)
+  memset(pawns_to_be_arranged,0,sizeof pawns_to_be_arranged);
+  memset(proof_pawns,0,sizeof proof_pawns);
+  memset(officers_to_be_arranged,0,sizeof officers_to_be_arranged);
+  memset(proof_officers,0,sizeof proof_officers);
+
+  /* boardnum enumerates the squares in the order of the bitboard bits */
+  for (bnp = boardnum; *bnp; bnp++, bit <<= 1)
   {
     piece_walk_type const p1 = proofgames_target_position.board[*bnp];
     piece_walk_type const p2 = get_walk_of_piece_on_square(*bnp);
@@ -1168,20 +1385,30 @@ static boolean Impossible(void)
           break;
       }
 
+      if (p1==Pawn)
+        proof_pawns[side_target] |= bit;
+      else if (p1>King)
+        proof_officers[side_target] |= bit;
+
+      if (p2==Pawn)
+        pawns_to_be_arranged[side_current] |= bit;
+      else if (p2>King)
+        add_walk_to_planes(p2,bit,officers_to_be_arranged[side_current]);
+
       TraceValue("%u",PawnsToBeArranged[side_current].Nbr);
       TraceValue("%u",PiecesToBeArranged[side_current].Nbr);
       TraceEOL();
     }
   }
 
-  if (ArrangePawns(to_be_captured[Black],White,&captures_required[Black])>moves_left[White])
+  if (ArrangePawnsMemoised(to_be_captured[Black],White,&captures_required[Black])>moves_left[White])
   {
     TraceText("ArrangePawns(BlPieToBeCapt,White,&BlCapturesRequired)"
               ">white_moves_left\n");
     return true;
   }
 
-  if (ArrangePawns(to_be_captured[White],Black,&captures_required[White])>moves_left[Black])
+  if (ArrangePawnsMemoised(to_be_captured[White],Black,&captures_required[White])>moves_left[Black])
   {
     TraceValue("%u",moves_left[Black]);
     TraceEOL();
@@ -1190,18 +1417,18 @@ static boolean Impossible(void)
     return true;
   }
 
-  if (ArrangePieces(to_be_captured[Black],
-                    White,
-                    captures_required[Black])>moves_left[White])
+  if (ArrangePiecesMemoised(to_be_captured[Black],
+                            White,
+                            captures_required[Black])>moves_left[White])
   {
     TraceText("(ArrangePieces(BlPieToBeCapt,White,BlCapturesRequired)"
               ">white_moves_left\n");
     return true;
   }
 
-  if (ArrangePieces(to_be_captured[White],
-                    Black,
-                    captures_required[White])>moves_left[Black])
+  if (ArrangePiecesMemoised(to_be_captured[White],
+                            Black,
+                            captures_required[White])>moves_left[Black])
   {
     TraceText("ArrangePieces(WhPieToBeCapt,Black,WhCapturesRequired)"
               ">black_moves_left\n");
@@ -1212,6 +1439,23 @@ static boolean Impossible(void)
   return false;
 }
 
+/* Determine whether the backward search from the target position excludes
+ * the position reached
+ * @param just_moved side that has just moved
+ * @return true iff the position can't occur in a solution
+ */
+static boolean BackwardImpossible(Side just_moved)
+{
+  if (is_backward_search_used)
+  {
+    unsigned int const nr_plies_left = MovesLeft[White]+MovesLeft[Black];
+    Side const last_mover = nr_plies_left%2==0 ? just_moved : advers(just_moved);
+    return !proof_backward_is_placement_reachable(last_mover,nr_plies_left);
+  }
+  else
+    return false;
+}
+
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
  * @note assigns solve_result the length of solution found and written, i.e.:
@@ -1242,7 +1486,7 @@ void goalreachable_guard_proofgame_solve(slice_index si)
   TraceValue("%u",MovesLeft[just_moved]);
   TraceEOL();
 
-  pipe_this_move_doesnt_solve_if(si,Impossible());
+  pipe_this_move_doesnt_solve_if(si,Impossible() || BackwardImpossible(just_moved));
 
   ++MovesLeft[just_moved];
   TraceValue("%u",MovesLeft[SLICE_STARTER(si)]);
@@ -1514,6 +1758,27 @@ static void InitialiseIntelligentSide(Side side)
   TraceFunctionResultEnd();
 }
 
+/* Is the backward search from the target position sound, i.e. are all the
+ * moves that the forward search may play orthodox?
+ */
+static boolean is_backward_search_sound(void)
+{
+  unsigned int c;
+
+  if (ProofFairy)
+    return false;
+
+  for (c = 0; c!=CondCount; ++c)
+    if (CondFlag[c] && c!=noiprom)
+      return false;
+
+  for (c = 0; c!=ExtraCondCount; ++c)
+    if (ExtraCondFlag[c])
+      return false;
+
+  return true;
+}
+
 static void InitialiseIntelligent(void)
 {
   TraceFunctionEntry(__func__);
@@ -1524,6 +1789,12 @@ static void InitialiseIntelligent(void)
   InitialiseIntelligentSide(White);
   InitialiseIntelligentSide(Black);
 
+  forget_arrangements_if_target_or_holes_changed();
+
+  is_backward_search_used = OptFlag[bidirectional] && is_backward_search_sound();
+  if (is_backward_search_used)
+    proof_backward_init();
+
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
@@ -0,0 +1,647 @@
+#include "optimisations/intelligent/proof_backward.h"
+#include "position/position.h"
+#include "solving/proofgames.h"
+#include "debugging/trace.h"
+
+#include "debugging/assert.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* The backward search uses its own compact board, indexed by
+ * file+nr_files_on_board*row, and a compact piece encoding: the orthodox
+ * walk, plus black_piece for black pieces.
+ */
+enum
+{
+  nr_retro_squares = nr_files_on_board*nr_rows_on_board,
+  black_piece = 8,
+  nr_piece_codes = 16,
+
+  max_nr_retro_plies = 16,
+  max_frontier_size = 1<<18,
+  nr_slots = 1<<20,
+  max_nr_positions = nr_slots/2
+};
+
+typedef struct
+{
+    unsigned char square[nr_retro_squares];
+} retro_board_type;
+
+typedef struct
+{
+    unsigned long long key;  /* 0 means: empty slot */
+    unsigned int nr_plies;   /* bit n set: reached by n retro plies */
+} retro_slot_type;
+
+static unsigned long long piece_keys[nr_piece_codes][nr_retro_squares];
+static unsigned long long last_mover_keys[nr_sides];
+
+static retro_slot_type *slots;
+static unsigned long nr_positions;
+
+static retro_board_type *frontier;
+static retro_board_type *next_frontier;
+static unsigned long frontier_size;
+static unsigned long next_frontier_size;
+static boolean is_next_frontier_complete;
+
+/* board that the backward search was made from */
+static retro_board_type target;
+
+/* material of the start position (the game array unless in a=>b), indexed
+ * like retraction_state_type::nr_pieces */
+static unsigned int start_nr_pieces[nr_piece_codes];
+
+/* for each last mover: are we ready to answer queries, and for how many
+ * plies do we know all the placements? */
+static boolean is_searched[nr_sides];
+static unsigned int nr_plies_searched[nr_sides];
+
+static unsigned long long next_random(unsigned long long *state)
+{
+  /* splitmix64 */
+  unsigned long long z = (*state += 0x9E3779B97F4A7C15ULL);
+  z = (z^(z>>30))*0xBF58476D1CE4E5B9ULL;
+  z = (z^(z>>27))*0x94D049BB133111EBULL;
+  return z^(z>>31);
+}
+
+static void init_keys(void)
+{
+  unsigned long long state = 0;
+  unsigned int code;
+  unsigned int sq;
+
+  for (code = 0; code!=nr_piece_codes; ++code)
+    for (sq = 0; sq!=nr_retro_squares; ++sq)
+      piece_keys[code][sq] = code==0 ? 0 : next_random(&state);
+
+  last_mover_keys[White] = next_random(&state);
+  last_mover_keys[Black] = next_random(&state);
+}
+
+static unsigned char encode_piece(piece_walk_type walk, Flags spec)
+{
+  if (walk==Empty)
+    return 0;
+  else
+  {
+    assert(walk>=King && walk<=Bishop);
+    return (unsigned char)(walk | (TSTFLAG(spec,Black) ? black_piece : 0));
+  }
+}
+
+static void encode_position(position const *pos, retro_board_type *board)
+{
+  unsigned int i;
+
+  for (i = 0; i!=nr_retro_squares; ++i)
+    board->square[i] = encode_piece(pos->board[boardnum[i]],pos->spec[boardnum[i]]);
+}
+
+static unsigned long long calc_key(retro_board_type const *board,
+                                   Side last_mover)
+{
+  unsigned long long result = last_mover_keys[last_mover];
+  unsigned int i;
+
+  for (i = 0; i!=nr_retro_squares; ++i)
+    result ^= piece_keys[board->square[i]][i];
+
+  return result;
+}
+
+static retro_slot_type *find_slot(unsigned long long key)
+{
+  unsigned long i;
+
+  /* 0 identifies empty slots */
+  if (key==0)
+    key = 1;
+
+  i = (unsigned long)key & (nr_slots-1);
+
+  while (slots[i].key!=0 && slots[i].key!=key)
+    i = (i+1) & (nr_slots-1);
+
+  return slots+i;
+}
+
+/* Remember that a placement has been reached by a number of retro plies
+ * @return false iff the placement had already been reached by that number
+ */
+static boolean remember(unsigned long long key, unsigned int nr_plies)
+{
+  retro_slot_type * const slot = find_slot(key);
+  unsigned int const bit = 1u<<nr_plies;
+
+  if (slot->key==0)
+  {
+    slot->key = key==0 ? 1 : key;
+    slot->nr_plies = bit;
+    ++nr_positions;
+    return true;
+  }
+  else if ((slot->nr_plies&bit)==0)
+  {
+    slot->nr_plies |= bit;
+    return true;
+  }
+  else
+    return false;
+}
+
+/* The board being retracted, together with its key and material, which are
+ * kept up to date while pieces are moved back */
+typedef struct
+{
+    retro_board_type board;
+    unsigned long long key;
+    unsigned int nr_pieces[nr_piece_codes];
+    Side retractor;
+    unsigned int nr_plies;
+} retraction_state_type;
+
+static void init_retraction_state(retraction_state_type *state,
+                                  retro_board_type const *board,
+                                  Side last_mover)
+{
+  unsigned int i;
+
+  state->board = *board;
+  state->key = calc_key(board,last_mover);
+  memset(state->nr_pieces,0,sizeof state->nr_pieces);
+  for (i = 0; i!=nr_retro_squares; ++i)
+    ++state->nr_pieces[board->square[i]];
+}
+
+static void set_square(retraction_state_type *state, int sq, unsigned char piece)
+{
+  unsigned char const before = state->board.square[sq];
+
+  state->key ^= piece_keys[before][sq]^piece_keys[piece][sq];
+  --state->nr_pieces[before];
+  ++state->nr_pieces[piece];
+  state->board.square[sq] = piece;
+}
+
+/* Is the material of a side compatible with a game starting from the start
+ * position (with all promotions having been made by its own pawns)? */
+static boolean is_material_possible(retraction_state_type const *state,
+                                    unsigned char colour)
+{
+  unsigned int const * const nr = state->nr_pieces+colour;
+  unsigned int const * const nr_start = start_nr_pieces+colour;
+  unsigned int total = 0;
+  unsigned int total_start = 0;
+  unsigned int promoted = 0;
+  piece_walk_type walk;
+
+  for (walk = King; walk<=Bishop; ++walk)
+  {
+    total += nr[walk];
+    total_start += nr_start[walk];
+    if (walk!=King && walk!=Pawn && nr[walk]>nr_start[walk])
+      promoted += nr[walk]-nr_start[walk];
+  }
+
+  return total<=total_start && nr[Pawn]+promoted<=nr_start[Pawn];
+}
+
+static void add_to_next_frontier(retraction_state_type const *state)
+{
+  if (is_next_frontier_complete
+      && is_material_possible(state,0)
+      && is_material_possible(state,black_piece)
+      && remember(state->key,state->nr_plies))
+  {
+    if (next_frontier_size==max_frontier_size || nr_positions>=max_nr_positions)
+      is_next_frontier_complete = false;
+    else
+    {
+      next_frontier[next_frontier_size] = state->board;
+      ++next_frontier_size;
+    }
+  }
+}
+
+static int file_of(int sq)
+{
+  return sq%nr_files_on_board;
+}
+
+static int row_of(int sq)
+{
+  return sq/nr_files_on_board;
+}
+
+static boolean is_on_retro_board(int file, int row)
+{
+  return file>=0 && file<nr_files_on_board && row>=0 && row<nr_rows_on_board;
+}
+
+/* Add a retraction, and the retractions that additionally uncapture a piece
+ * of the opponent on the arrival square
+ * @param may_uncapture may the retraction uncapture?
+ * @param must_uncapture must the retraction uncapture?
+ */
+static void add_retraction(retraction_state_type *state,
+                           int arrival,
+                           boolean may_uncapture,
+                           boolean must_uncapture)
+{
+  assert(state->board.square[arrival]==0);
+
+  if (!must_uncapture)
+    add_to_next_frontier(state);
+
+  if (may_uncapture)
+  {
+    unsigned char const colour = state->retractor==White ? black_piece : 0;
+    boolean const may_be_pawn = row_of(arrival)!=0 && row_of(arrival)!=nr_rows_on_board-1;
+    piece_walk_type walk;
+
+    for (walk = Pawn; walk<=Bishop; ++walk)
+      if (walk!=Pawn || may_be_pawn)
+      {
+        set_square(state,arrival,(unsigned char)(walk|colour));
+        add_to_next_frontier(state);
+      }
+
+    set_square(state,arrival,0);
+  }
+}
+
+/* Move the piece on arrival back to departure (if that is empty) and add the
+ * result */
+static void retract_to(retraction_state_type *state,
+                       int arrival, int departure,
+                       unsigned char piece_before,
+                       boolean may_uncapture,
+                       boolean must_uncapture)
+{
+  if (state->board.square[departure]==0)
+  {
+    unsigned char const piece_after = state->board.square[arrival];
+    set_square(state,departure,piece_before);
+    set_square(state,arrival,0);
+    add_retraction(state,arrival,may_uncapture,must_uncapture);
+    set_square(state,arrival,piece_after);
+    set_square(state,departure,0);
+  }
+}
+
+static void retract_leaper(retraction_state_type *state,
+                           int sq,
+                           int const vectors[][2], unsigned int nr_vectors)
+{
+  unsigned int i;
+
+  for (i = 0; i!=nr_vectors; ++i)
+  {
+    int const file = file_of(sq)+vectors[i][0];
+    int const row = row_of(sq)+vectors[i][1];
+    if (is_on_retro_board(file,row))
+      retract_to(state,sq,file+nr_files_on_board*row,state->board.square[sq],true,false);
+  }
+}
+
+static void retract_rider(retraction_state_type *state,
+                          int sq,
+                          int const vectors[][2], unsigned int nr_vectors)
+{
+  unsigned int i;
+
+  for (i = 0; i!=nr_vectors; ++i)
+  {
+    int file = file_of(sq)+vectors[i][0];
+    int row = row_of(sq)+vectors[i][1];
+    while (is_on_retro_board(file,row)
+           && state->board.square[file+nr_files_on_board*row]==0)
+    {
+      retract_to(state,sq,file+nr_files_on_board*row,state->board.square[sq],true,false);
+      file += vectors[i][0];
+      row += vectors[i][1];
+    }
+  }
+}
+
+static int const king_vectors[][2] = {
+  { 1, 0 }, { 1, 1 }, { 0, 1 }, { -1, 1 }, { -1, 0 }, { -1, -1 }, { 0, -1 }, { 1, -1 }
+};
+static int const knight_vectors[][2] = {
+  { 2, 1 }, { 1, 2 }, { -1, 2 }, { -2, 1 }, { -2, -1 }, { -1, -2 }, { 1, -2 }, { 2, -1 }
+};
+static int const rook_vectors[][2] = {
+  { 1, 0 }, { 0, 1 }, { -1, 0 }, { 0, -1 }
+};
+static int const bishop_vectors[][2] = {
+  { 1, 1 }, { -1, 1 }, { -1, -1 }, { 1, -1 }
+};
+
+/* Retract castling, moving king and rook from their squares after castling
+ * back to their initial squares */
+static void retract_castling(retraction_state_type *state,
+                             int base,
+                             int file_king, int file_rook,
+                             int file_rook_initial,
+                             int file_between)
+{
+  unsigned char const colour = state->retractor==White ? 0 : black_piece;
+  unsigned char const king = (unsigned char)(King|colour);
+  unsigned char const rook = (unsigned char)(Rook|colour);
+
+  if (state->board.square[base+file_king]==king
+      && state->board.square[base+file_rook]==rook
+      && state->board.square[base+file_e]==0
+      && state->board.square[base+file_rook_initial]==0
+      && state->board.square[base+file_between]==0)
+  {
+    set_square(state,base+file_king,0);
+    set_square(state,base+file_rook,0);
+    set_square(state,base+file_e,king);
+    set_square(state,base+file_rook_initial,rook);
+    add_to_next_frontier(state);
+    set_square(state,base+file_e,0);
+    set_square(state,base+file_rook_initial,0);
+    set_square(state,base+file_king,king);
+    set_square(state,base+file_rook,rook);
+  }
+}
+
+static void retract_pawn(retraction_state_type *state, int sq)
+{
+  int const dir = state->retractor==White ? 1 : -1;
+  int const relative_row = state->retractor==White ? row_of(sq) : nr_rows_on_board-1-row_of(sq);
+  int const file = file_of(sq);
+  int const back = sq-dir*nr_files_on_board;
+  unsigned char const pawn = state->board.square[sq];
+  int df;
+
+  /* a pawn on its second row hasn't moved */
+  if (relative_row<=1)
+    return;
+
+  retract_to(state,sq,back,pawn,false,false);
+
+  if (relative_row==3 && state->board.square[back]==0)
+    retract_to(state,sq,back-dir*nr_files_on_board,pawn,false,false);
+
+  for (df = -1; df<=1; df += 2)
+    if (file+df>=0 && file+df<nr_files_on_board)
+    {
+      int const departure = back+df;
+
+      retract_to(state,sq,departure,pawn,true,true);
+
+      if (relative_row==5)
+      {
+        /* en passant: the captured pawn was on back, and it had passed sq
+         * coming from sq+dir*nr_files_on_board */
+        int const double_step_departure = sq+dir*nr_files_on_board;
+        if (state->board.square[back]==0
+            && state->board.square[departure]==0
+            && state->board.square[double_step_departure]==0)
+        {
+          set_square(state,departure,pawn);
+          set_square(state,sq,0);
+          set_square(state,back,(unsigned char)(pawn^black_piece));
+          add_to_next_frontier(state);
+          set_square(state,back,0);
+          set_square(state,sq,pawn);
+          set_square(state,departure,0);
+        }
+      }
+    }
+}
+
+static void retract_promotion(retraction_state_type *state, int sq)
+{
+  int const dir = state->retractor==White ? 1 : -1;
+  unsigned char const colour = state->retractor==White ? 0 : black_piece;
+  unsigned char const pawn = (unsigned char)(Pawn|colour);
+  int const back = sq-dir*nr_files_on_board;
+  int const file = file_of(sq);
+  int df;
+
+  retract_to(state,sq,back,pawn,false,false);
+
+  for (df = -1; df<=1; df += 2)
+    if (file+df>=0 && file+df<nr_files_on_board)
+      retract_to(state,sq,back+df,pawn,true,true);
+}
+
+/* Generate the retractions of a side and add them to the next frontier */
+static void retract(retraction_state_type *state)
+{
+  unsigned char const colour = state->retractor==White ? 0 : black_piece;
+  int const base_row = state->retractor==White ? 0 : nr_rows_on_board-1;
+  int const base = nr_files_on_board*base_row;
+  int const last_row = nr_rows_on_board-1-base_row;
+  int sq;
+
+  for (sq = 0; sq!=nr_retro_squares; ++sq)
+  {
+    unsigned char const piece = state->board.square[sq];
+    if (piece!=0 && (piece&black_piece)==colour)
+    {
+      piece_walk_type const walk = (piece_walk_type)(piece&~black_piece);
+
+      switch (walk)
+      {
+        case King:
+          retract_leaper(state,sq,king_vectors,8);
+          if (sq==base+file_g)
+            retract_castling(state,base,file_g,file_f,file_h,file_h);
+          else if (sq==base+file_c)
+            retract_castling(state,base,file_c,file_d,file_a,file_b);
+          break;
+
+        case Pawn:
+          retract_pawn(state,sq);
+          break;
+
+        case Knight:
+          retract_leaper(state,sq,knight_vectors,8);
+          break;
+
+        case Rook:
+          retract_rider(state,sq,rook_vectors,4);
+          break;
+
+        case Bishop:
+          retract_rider(state,sq,bishop_vectors,4);
+          break;
+
+        case Queen:
+          retract_rider(state,sq,rook_vectors,4);
+          retract_rider(state,sq,bishop_vectors,4);
+          break;
+
+        default:
+          assert(0);
+          break;
+      }
+
+      if (walk!=King && walk!=Pawn && row_of(sq)==last_row)
+        retract_promotion(state,sq);
+    }
+  }
+}
+
+static boolean allocate(void)
+{
+  if (slots==0)
+  {
+    slots = calloc(nr_slots,sizeof slots[0]);
+    frontier = malloc(max_frontier_size*sizeof frontier[0]);
+    next_frontier = malloc(max_frontier_size*sizeof next_frontier[0]);
+
+    if (slots==0 || frontier==0 || next_frontier==0)
+    {
+      free(slots);
+      free(frontier);
+      free(next_frontier);
+      slots = 0;
+      frontier = 0;
+      next_frontier = 0;
+    }
+  }
+
+  return slots!=0;
+}
+
+/* Retract plies from the target position until the frontier doesn't fit into
+ * memory any more
+ * @param last_mover side that makes the last move of the proof game
+ */
+static void search_backward(Side last_mover)
+{
+  TraceFunctionEntry(__func__);
+  TraceEnumerator(Side,last_mover);
+  TraceFunctionParamListEnd();
+
+  is_searched[last_mover] = true;
+  nr_plies_searched[last_mover] = 0;
+
+  if (allocate())
+  {
+    retraction_state_type state;
+    Side retractor = last_mover;
+    unsigned int nr_plies = 0;
+
+    init_retraction_state(&state,&target,last_mover);
+    state.nr_plies = 0;
+    next_frontier_size = 0;
+    is_next_frontier_complete = true;
+    add_to_next_frontier(&state);
+
+    while (is_next_frontier_complete
+           && next_frontier_size>0
+           && nr_plies<max_nr_retro_plies)
+    {
+      retro_board_type * const tmp = frontier;
+      unsigned long i;
+
+      nr_plies_searched[last_mover] = nr_plies;
+
+      frontier = next_frontier;
+      frontier_size = next_frontier_size;
+      next_frontier = tmp;
+      next_frontier_size = 0;
+
+      ++nr_plies;
+      for (i = 0; i!=frontier_size && is_next_frontier_complete; ++i)
+      {
+        init_retraction_state(&state,&frontier[i],last_mover);
+        state.retractor = retractor;
+        state.nr_plies = nr_plies;
+        retract(&state);
+      }
+
+      retractor = advers(retractor);
+    }
+
+    if (is_next_frontier_complete)
+      nr_plies_searched[last_mover] = nr_plies;
+  }
+
+  TraceValue("%u",nr_plies_searched[last_mover]);
+  TraceValue("%lu",nr_positions);
+  TraceEOL();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Prepare the backward search for the problem about to be solved
+ */
+void proof_backward_init(void)
+{
+  retro_board_type board;
+  retro_board_type start;
+  unsigned int nr_pieces[nr_piece_codes] = { 0 };
+  unsigned int i;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (last_mover_keys[White]==0)
+    init_keys();
+
+  encode_position(&proofgames_target_position,&board);
+
+  encode_position(&proofgames_start_position,&start);
+  for (i = 0; i!=nr_retro_squares; ++i)
+    ++nr_pieces[start.square[i]];
+
+  if (memcmp(&board,&target,sizeof board)!=0
+      || memcmp(nr_pieces,start_nr_pieces,sizeof nr_pieces)!=0)
+  {
+    target = board;
+    memcpy(start_nr_pieces,nr_pieces,sizeof nr_pieces);
+    is_searched[White] = false;
+    is_searched[Black] = false;
+    if (slots!=0)
+      memset(slots,0,nr_slots*sizeof slots[0]);
+    nr_positions = 0;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Determine whether the placement of the position being solved can occur
+ * in a proof game a certain number of plies before its end
+ * @param last_mover side that makes the last move of the proof game
+ * @param nr_plies_left number of plies still to be played
+ * @return false iff the position can be excluded
+ */
+boolean proof_backward_is_placement_reachable(Side last_mover,
+                                              unsigned int nr_plies_left)
+{
+  boolean result = true;
+
+  TraceFunctionEntry(__func__);
+  TraceEnumerator(Side,last_mover);
+  TraceFunctionParam("%u",nr_plies_left);
+  TraceFunctionParamListEnd();
+
+  if (!is_searched[last_mover])
+    search_backward(last_mover);
+
+  /* a retraction of nr_plies_searched[last_mover]+1 plies may have been
+   * interrupted, but its placements may already have been remembered */
+  if (nr_plies_left<=nr_plies_searched[last_mover])
+  {
+    retro_board_type board;
+    encode_position(&being_solved,&board);
+    result = (find_slot(calc_key(&board,last_mover))->nr_plies & (1u<<nr_plies_left))!=0;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
@@ -0,0 +1,32 @@
+#if !defined(OPTIMISATIONS_INTELLIGENT_PROOF_BACKWARD_H)
+#define OPTIMISATIONS_INTELLIGENT_PROOF_BACKWARD_H
+
+#include "position/side.h"
+#include "utilities/boolean.h"
+
+/* This module implements the backward half of a bidirectional search for
+ * orthodox proof games and a=>b problems (option Bidirectional).
+ * Starting from the target position, retro moves are generated ply by ply,
+ * and the placements reached after each number of retro plies are
+ * remembered in a hash set, as long as the backward frontier fits into
+ * memory.
+ * The forward search meets this frontier: a position with n plies left
+ * can only lead to the target position if its placement was reached by n
+ * retro plies. The retro moves are generated generously (e.g. legality of
+ * the retracted positions isn't checked), so no solution is ever lost.
+ */
+
+/* Prepare the backward search for the problem about to be solved
+ */
+void proof_backward_init(void);
+
+/* Determine whether the placement of the position being solved can occur
+ * in a proof game a certain number of plies before its end
+ * @param last_mover side that makes the last move of the proof game
+ * @param nr_plies_left number of plies still to be played
+ * @return false iff the position can be excluded
+ */
+boolean proof_backward_is_placement_reachable(Side last_mover,
+                                              unsigned int nr_plies_left);
+
+#endif
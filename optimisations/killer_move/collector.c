@@ -4,6 +4,7 @@
 #include "stipulation/branch.h"
 #include "stipulation/battle_play/branch.h"
 #include "optimisations/killer_move/killer_move.h"
+#include "optimisations/killer_move/history.h"
 #include "solving/pipe.h"
 #include "debugging/trace.h"
 
@@ -16,6 +17,9 @@ static void remember_killer_move(void)
 
   killer_moves[nbply] = move_generation_stack[CURRMOVE_OF_PLY(nbply)];
 
+  if (history_heuristic_is_enabled())
+    history_heuristic_remember_cutoff();
+
   TraceValue("%u",nbply);
   TraceSquare(killer_moves[nbply].departure);
   TraceSquare(killer_moves[nbply].arrival);
@@ -0,0 +1,220 @@
+#include "optimisations/killer_move/history.h"
+#include "optimisations/killer_move/killer_move.h"
+#include "position/board.h"
+#include "position/position.h"
+#include "solving/move_effect_journal.h"
+#include "solving/machinery/slack_length.h"
+#include "solving/move_generator.h"
+#include "solving/ply.h"
+#include "solving/pipe.h"
+#include "stipulation/pipe.h"
+#include "debugging/trace.h"
+
+#include "debugging/assert.h"
+#include <stdlib.h>
+#include <string.h>
+
+static boolean is_enabled;
+
+/* history scores are kept per walk of the moving piece - the same squares
+ * mean different moves for a rook and for a knight or a grasshopper
+ */
+static unsigned long history[nr_sides][nr_piece_walks][nr_squares_on_board][nr_squares_on_board];
+
+static move_generation_elmt countermoves[nr_sides][nr_squares_on_board][nr_squares_on_board];
+
+/* side whose moves are currently being sorted */
+static Side sorting_side;
+
+/* Enable or disable the history heuristic
+ * @param enabled true iff the heuristic is to be used
+ */
+void history_heuristic_enable(boolean enabled)
+{
+  is_enabled = enabled;
+}
+
+/* Determine whether the history heuristic is enabled
+ * @return true iff the heuristic is to be used
+ */
+boolean history_heuristic_is_enabled(void)
+{
+  return is_enabled;
+}
+
+/* Forget the history and the countermoves learnt so far
+ */
+void history_heuristic_reset(void)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  memset(history,0,sizeof history);
+  memset(countermoves,0,sizeof countermoves);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Moves without regular departure and arrival squares (e.g. null moves) are
+ * not recorded
+ */
+static boolean is_recordable(move_generation_elmt const *move)
+{
+  return is_on_board(move->departure) && is_on_board(move->arrival);
+}
+
+/* Map a square of the board to 0..nr_squares_on_board-1
+ */
+static unsigned int board_index(square s)
+{
+  int const offset = s-square_a1;
+  return (unsigned int)(offset/onerow*nr_files_on_board + offset%onerow);
+}
+
+/* Determine the walk that the piece moving in ply nbply had before the move
+ * @return the walk; Empty if the move doesn't consist in a piece movement
+ */
+static piece_walk_type get_walk_of_moved_piece(void)
+{
+  move_effect_journal_index_type const base = move_effect_journal_base[nbply];
+  move_effect_journal_index_type const movement = base+move_effect_journal_index_offset_movement;
+
+  if (move_effect_journal[movement].type==move_effect_piece_movement)
+    return move_effect_journal[movement].u.piece_movement.moving;
+  else
+    return Empty;
+}
+
+/* Remember that the move just played in ply nbply has caused a cutoff
+ */
+void history_heuristic_remember_cutoff(void)
+{
+  move_generation_elmt const * const move = &move_generation_stack[CURRMOVE_OF_PLY(nbply)];
+  Side const side = trait[nbply];
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (is_recordable(move))
+  {
+    unsigned long const depth = (solve_nr_remaining>slack_length
+                                 ? solve_nr_remaining-slack_length
+                                 : 1);
+    piece_walk_type const walk = get_walk_of_moved_piece();
+    ply const parent = parent_ply[nbply];
+    move_generation_elmt const * const answered = &move_generation_stack[CURRMOVE_OF_PLY(parent)];
+
+    if (walk!=Empty)
+      history[side][walk][board_index(move->departure)][board_index(move->arrival)] += depth*depth;
+
+    if (trait[parent]!=side && is_recordable(answered))
+      countermoves[side][board_index(answered->departure)][board_index(answered->arrival)] = *move;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Allocate a STHistoryPrioriser slice.
+ * @return index of allocated slice
+ */
+slice_index alloc_history_prioriser_slice(void)
+{
+  slice_index result;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  result = alloc_pipe(STHistoryPrioriser);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+static unsigned long get_history_score(move_generation_elmt const *move)
+{
+  if (is_recordable(move))
+  {
+    piece_walk_type const walk = get_walk_of_piece_on_square(move->departure);
+    return history[sorting_side][walk][board_index(move->departure)][board_index(move->arrival)];
+  }
+  else
+    return 0;
+}
+
+/* moves are tried from the top of the move generation stack downwards */
+static int compare_history_scores(void const *a, void const *b)
+{
+  unsigned long const score_a = get_history_score(a);
+  unsigned long const score_b = get_history_score(b);
+
+  if (score_a<score_b)
+    return -1;
+  else if (score_a>score_b)
+    return +1;
+  else
+    return 0;
+}
+
+static boolean is_same_move(move_generation_elmt const *move1,
+                            move_generation_elmt const *move2)
+{
+  return (move1->departure==move2->departure
+          && move1->arrival==move2->arrival);
+}
+
+static void priorise(move_generation_elmt const *move)
+{
+  numecoup i;
+
+  for (i = CURRMOVE_OF_PLY(nbply); i>MOVEBASE_OF_PLY(nbply); --i)
+    if (is_same_move(&move_generation_stack[i],move))
+    {
+      move_generator_priorise(i);
+      break;
+    }
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void history_prioriser_solve(slice_index si)
+{
+  numecoup const base = MOVEBASE_OF_PLY(nbply)+1;
+  numecoup const top = CURRMOVE_OF_PLY(nbply)+1;
+  ply const parent = parent_ply[nbply];
+  move_generation_elmt const * const answered = &move_generation_stack[CURRMOVE_OF_PLY(parent)];
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  sorting_side = trait[nbply];
+  qsort(&move_generation_stack[base],
+        top-base,
+        sizeof move_generation_stack[0],
+        &compare_history_scores);
+
+  if (trait[parent]!=sorting_side && is_recordable(answered))
+    priorise(&countermoves[sorting_side][board_index(answered->departure)][board_index(answered->arrival)]);
+
+  priorise(&killer_moves[nbply]);
+
+  pipe_solve_delegate(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,58 @@
+#if !defined(OPTIMISATION_KILLER_MOVE_HISTORY_H)
+#define OPTIMISATION_KILLER_MOVE_HISTORY_H
+
+#include "solving/machinery/solve.h"
+
+/* This module implements the history heuristic and countermoves for
+ * ordering moves in battle play (option History).
+ * Each time a move causes a cutoff (an attack solves or a defense refutes),
+ * - the history score of its side, the walk of the moving piece and its
+ *   departure and arrival squares is increased by the square of the
+ *   remaining length
+ * - it is remembered as the countermove of the opponent's move that it
+ *   answers
+ * The tables are kept until the next twin, i.e. across sibling subtrees and
+ * across the lengths tried by the iterative deepening of battle play.
+ * STHistoryPrioriser slices then try the killer move first, then the
+ * countermove, then the other moves in the order of their history scores.
+ */
+
+/* Enable or disable the history heuristic
+ * @param enabled true iff the heuristic is to be used
+ */
+void history_heuristic_enable(boolean enabled);
+
+/* Determine whether the history heuristic is enabled
+ * @return true iff the heuristic is to be used
+ */
+boolean history_heuristic_is_enabled(void);
+
+/* Forget the history and the countermoves learnt so far
+ */
+void history_heuristic_reset(void);
+
+/* Remember that the move just played in ply nbply has caused a cutoff
+ */
+void history_heuristic_remember_cutoff(void);
+
+/* Allocate a STHistoryPrioriser slice.
+ * @return index of allocated slice
+ */
+slice_index alloc_history_prioriser_slice(void);
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void history_prioriser_solve(slice_index si);
+
+#endif
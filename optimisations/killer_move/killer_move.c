@@ -1,21 +1,29 @@
 #include "optimisations/killer_move/killer_move.h"
 #include "stipulation/proxy.h"
 #include "stipulation/battle_play/branch.h"
-#include "solving/fork_on_remaining.h"
 #include "solving/move_generator.h"
 #include "optimisations/killer_move/prioriser.h"
 #include "optimisations/killer_move/collector.h"
-#include "optimisations/killer_move/final_defense_move.h"
+#include "optimisations/killer_move/staged_defense.h"
+#include "optimisations/killer_move/history.h"
+#include "options/options.h"
 #include "debugging/trace.h"
 
 #include "debugging/assert.h"
 
-move_generation_elmt killer_moves[maxply+1];
+move_generation_elmt *killer_moves;
 
 /* for which Side(s) is the optimisation currently enabled? */
 static boolean enabled[nr_sides] = { false };
 
-/* Reset the enabled state of the optimisation of final defense moves
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void killer_move_allocate_ply_tables(void)
+{
+  killer_moves = ply_allocate_table(maxply+1,sizeof killer_moves[0]);
+}
+
+/* Reset the enabled state of the killer move optimisation
  */
 void reset_killer_move_optimisation(void)
 {
@@ -29,7 +37,7 @@ void reset_killer_move_optimisation(void)
   TraceFunctionResultEnd();
 }
 
-/* Disable the optimisation of final defense moves for defense by a side
+/* Disable the killer move optimisation for defense by a side
  * @param side side for which to disable the optimisation
  */
 void disable_killer_move_optimisation(Side side)
@@ -44,32 +52,16 @@ void disable_killer_move_optimisation(Side side)
   TraceFunctionResultEnd();
 }
 
-static void remember_goal(slice_index si, stip_structure_traversal *st)
-{
-  Goal * const goal = st->param;
-
-  TraceFunctionEntry(__func__);
-  TraceFunctionParam("%u",si);
-  TraceFunctionParamListEnd();
-
-  *goal = SLICE_U(si).goal_handler.goal;
-
-  TraceFunctionExit(__func__);
-  TraceFunctionResultEnd();
-}
-
 typedef struct
 {
     boolean are_we_at_root_level;
-    boolean are_we_generating;
-    stip_length_type lower_limit;
-} final_defense_moves_iteration_state;
+    slice_index found_optimiser;
+} staged_defense_iteration_state;
 
-static
-void optimise_final_defense_moves_move_generator(slice_index si,
-                                                 stip_structure_traversal *st)
+static void stage_defense_move_generator(slice_index si,
+                                         stip_structure_traversal *st)
 {
-  final_defense_moves_iteration_state const * const state = st->param;
+  staged_defense_iteration_state * const state = st->param;
   Side const defender = SLICE_STARTER(si);
 
   TraceFunctionEntry(__func__);
@@ -78,26 +70,22 @@ void optimise_final_defense_moves_move_generator(slice_index si,
 
   assert(defender!=no_side);
 
-  stip_traverse_structure_children_pipe(si,st);
+  state->found_optimiser = no_slice;
 
+  stip_traverse_structure_children(si,st);
+
+  /* only stage the generation if the moves are not reordered by an optimiser
+   * that requires all the moves of the ply, e.g. the few moves prioriser or
+   * the history prioriser (which would only order the moves of each stage) */
   if (st->activity==stip_traversal_activity_testing
       && !state->are_we_at_root_level
-      && state->lower_limit==0
       && st->context==stip_traversal_context_defense
-      && enabled[defender])
-  {
-    stip_structure_traversal st_nested;
-    Goal goal = { no_goal, initsquare };
+      && enabled[defender]
+      && state->found_optimiser!=no_slice
+      && SLICE_TYPE(state->found_optimiser)==STKillerMovePrioriser)
+    killer_move_stage_defense_move_generator(si);
 
-    stip_structure_traversal_init_nested(&st_nested,st,&goal);
-    stip_structure_traversal_override_single(&st_nested,
-                                             STGoalReachedTester,
-                                             &remember_goal);
-    stip_traverse_structure(si,&st_nested);
-
-    if (goal.type!=no_goal)
-      killer_move_optimise_final_defense_move(si,st);
-  }
+  state->found_optimiser = no_slice;
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
@@ -105,7 +93,7 @@ void optimise_final_defense_moves_move_generator(slice_index si,
 
 static void remember_end_of_root(slice_index si, stip_structure_traversal *st)
 {
-  final_defense_moves_iteration_state * const state = st->param;
+  staged_defense_iteration_state * const state = st->param;
   boolean const save_root = state->are_we_at_root_level;
 
   TraceFunctionEntry(__func__);
@@ -121,100 +109,91 @@ static void remember_end_of_root(slice_index si, stip_structure_traversal *st)
   TraceFunctionResultEnd();
 }
 
-static void remember_generating(slice_index si, stip_structure_traversal *st)
+static void remember_staging_optimiser(slice_index si,
+                                       stip_structure_traversal *st)
 {
-  final_defense_moves_iteration_state * const state = st->param;
+  staged_defense_iteration_state * const state = st->param;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParam("%p",(void *)st);
   TraceFunctionParamListEnd();
 
-  state->are_we_generating = true;
-  state->lower_limit = 0;
   stip_traverse_structure_children_pipe(si,st);
-  state->are_we_generating = false;
+  state->found_optimiser = si;
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
 
-static void remember_not_generating(slice_index si, stip_structure_traversal *st)
+static void forget_staging_optimiser(slice_index si,
+                                     stip_structure_traversal *st)
 {
-  final_defense_moves_iteration_state * const state = st->param;
-  stip_length_type const save_lower_limit = state->lower_limit;
+  staged_defense_iteration_state * const state = st->param;
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParam("%p",(void *)st);
   TraceFunctionParamListEnd();
 
-  state->are_we_generating = false;
-  stip_traverse_structure_children_pipe(si,st);
-  state->are_we_generating = true;
-  state->lower_limit = save_lower_limit;
-
-  TraceFunctionExit(__func__);
-  TraceFunctionResultEnd();
-}
-
-static void remember_lower_move_limit(slice_index si, stip_structure_traversal *st)
-{
-  TraceFunctionEntry(__func__);
-  TraceFunctionParam("%u",si);
-  TraceFunctionParamListEnd();
-
-  stip_traverse_structure_children_pipe(SLICE_NEXT2(si),st);
-
-  {
-    final_defense_moves_iteration_state * const state = st->param;
-    stip_length_type const save_lower_limit = state->lower_limit;
-    state->lower_limit = SLICE_U(si).fork_on_remaining.threshold;
-    stip_traverse_structure_children_pipe(SLICE_NEXT1(si),st);
-    state->lower_limit = save_lower_limit;
-  }
+  stip_traverse_structure_children(si,st);
+  state->found_optimiser = no_slice;
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
 
-static structure_traversers_visitor const final_defense_move_optimisers[] =
+static structure_traversers_visitor const defense_move_stagers[] =
 {
-  { STEndOfRoot,           &remember_end_of_root                        },
-  { STGeneratingMoves,     &remember_generating                         },
-  { STDonePriorisingMoves, &remember_not_generating                     },
-  { STForkOnRemaining,     &remember_lower_move_limit                   },
-  { STMoveGenerator,       &optimise_final_defense_moves_move_generator }
+  { STEndOfRoot,                &remember_end_of_root                  },
+  { STRefutationsSolver,        &stip_traverse_structure_children_pipe },
+  { STOpponentMovesCounterFork, &stip_traverse_structure_children_pipe },
+  { STBackHomeFinderFork,       &stip_traverse_structure_children_pipe },
+  { STNot,                      &stip_structure_visitor_noop           },
+  { STMoveGenerator,            &stage_defense_move_generator          }
 };
 
 enum
 {
-  nr_final_defense_move_optimisers = (sizeof final_defense_move_optimisers
-                                      / sizeof final_defense_move_optimisers[0])
+  nr_defense_move_stagers = (sizeof defense_move_stagers
+                             / sizeof defense_move_stagers[0])
 };
 
-/* Instrument stipulation with killer move slices
+/* Instrument stipulation with the staged generation of defenses
  * @param si identifies slice where to start
  */
-static void optimise_final_defense_move_with_killer_moves(slice_index si)
+static void stage_defense_move_generation(slice_index si)
 {
   stip_structure_traversal st;
-  final_defense_moves_iteration_state state = { true, false, 0 };
+  staged_defense_iteration_state state = { true, no_slice };
 
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
 
   stip_structure_traversal_init(&st,&state);
+  stip_structure_traversal_override_by_function(&st,
+                                                slice_function_move_reordering_optimiser,
+                                                &remember_staging_optimiser);
+  stip_structure_traversal_override_by_function(&st,
+                                                slice_function_move_generator,
+                                                &forget_staging_optimiser);
   stip_structure_traversal_override(&st,
-                                    final_defense_move_optimisers,
-                                    nr_final_defense_move_optimisers);
+                                    defense_move_stagers,
+                                    nr_defense_move_stagers);
   stip_traverse_structure(si,&st);
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
 
+static slice_index alloc_prioriser_slice(void)
+{
+  return (history_heuristic_is_enabled()
+          ? alloc_history_prioriser_slice()
+          : alloc_killer_move_prioriser_slice());
+}
+
 static void substitute_killermove_machinery(slice_index si,
                                             stip_structure_traversal *st)
 {
@@ -239,7 +218,7 @@ static void substitute_killermove_machinery(slice_index si,
     {
       slice_index const prototypes[] =
       {
-          alloc_killer_move_prioriser_slice(),
+          alloc_prioriser_slice(),
           alloc_killer_attack_collector_slice()
       };
       enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
@@ -249,7 +228,7 @@ static void substitute_killermove_machinery(slice_index si,
     {
       slice_index const prototypes[] =
       {
-          alloc_killer_move_prioriser_slice(),
+          alloc_prioriser_slice(),
           alloc_killer_defense_collector_slice()
       };
       enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
@@ -360,9 +339,13 @@ void solving_optimise_with_killer_moves(slice_index si)
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
 
+  history_heuristic_enable(OptFlag[movehistory]);
+  if (history_heuristic_is_enabled())
+    history_heuristic_reset();
+
   solving_impose_starter(si,SLICE_STARTER(si));
-  optimise_final_defense_move_with_killer_moves(si);
   optimise_move_generators(si);
+  stage_defense_move_generation(si);
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
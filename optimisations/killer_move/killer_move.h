@@ -5,7 +5,7 @@
 #include "solving/move_generator.h"
 #include "solving/ply.h"
 
-extern move_generation_elmt killer_moves[maxply+1];
+extern move_generation_elmt *killer_moves;
 
 /* Reset the enabled state of the optimisation
  */
@@ -21,4 +21,8 @@ void disable_killer_move_optimisation(Side);
  */
 void solving_optimise_with_killer_moves(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void killer_move_allocate_ply_tables(void);
+
 #endif
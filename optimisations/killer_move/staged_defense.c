@@ -0,0 +1,109 @@
+#include "optimisations/killer_move/staged_defense.h"
+#include "position/position.h"
+#include "stipulation/pipe.h"
+#include "solving/has_solution_type.h"
+#include "solving/single_piece_move_generator.h"
+#include "solving/pipe.h"
+#include "optimisations/killer_move/killer_move.h"
+#include "debugging/trace.h"
+
+#include "debugging/assert.h"
+
+/* Optimise a STMoveGenerator slice for finding refutations by generating the
+ * defenses in stages
+ * @param si identifies slice to be optimised
+ */
+void killer_move_stage_defense_move_generator(slice_index si)
+{
+  Side const defender = SLICE_STARTER(si);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  assert(SLICE_TYPE(si)==STMoveGenerator);
+
+  {
+    slice_index const staged = alloc_pipe(STKillerMoveStagedDefense);
+    slice_index const generator = alloc_single_piece_move_generator_slice();
+
+    pipe_substitute(si,staged);
+    SLICE_STARTER(si) = defender;
+
+    pipe_append(si,generator);
+    SLICE_STARTER(generator) = defender;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Try the defenses of one piece
+ * @param si slice index
+ * @param sq_departure position of the piece
+ * @param result the result of the defenses tried so far
+ * @return the result including the defenses of the piece
+ */
+static stip_length_type defend_with_piece(slice_index si,
+                                          square sq_departure,
+                                          stip_length_type result)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceSquare(sq_departure);
+  TraceFunctionParam("%u",result);
+  TraceFunctionParamListEnd();
+
+  init_single_piece_move_generator(sq_departure);
+  pipe_solve_delegate(si);
+
+  if (solve_result==previous_move_is_illegal || solve_result>result)
+    result = solve_result;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void killer_move_staged_defense_solve(slice_index si)
+{
+  Side const defender = SLICE_STARTER(si);
+  square const killer_pos = killer_moves[nbply+1].departure;
+  stip_length_type result = immobility_on_next_move;
+  square const *bnp;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceSquare(killer_pos);
+  TraceFunctionParamListEnd();
+
+  if (TSTFLAG(being_solved.spec[killer_pos],defender))
+    result = defend_with_piece(si,killer_pos,result);
+
+  for (bnp = boardnum;
+       result!=previous_move_is_illegal
+       && result<=MOVE_HAS_SOLVED_LENGTH()
+       && *bnp!=initsquare;
+       ++bnp)
+    if (*bnp!=killer_pos && TSTFLAG(being_solved.spec[*bnp],defender))
+      result = defend_with_piece(si,*bnp,result);
+
+  solve_result = result;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -1,24 +1,23 @@
-#if !defined(OPTIMISATION_KILLER_MOVE_FINAL_DEFENSE_MOVE_H)
-#define OPTIMISATION_KILLER_MOVE_FINAL_DEFENSE_MOVE_H
+#if !defined(OPTIMISATION_KILLER_MOVE_STAGED_DEFENSE_H)
+#define OPTIMISATION_KILLER_MOVE_STAGED_DEFENSE_H
 
 #include "solving/machinery/solve.h"
 #include "stipulation/structure_traversal.h"
 
 /* This module provides functionality dealing with the defending side
- * in STKillerMoveFinalDefenseMove stipulation slices.
- * These provide an optimisation in stipulations where a defense move
- * leads to a goal (e.g. selfmate): if we have a "killer" piece, its
- * moves will be prefered when looking for refutations in the final
- * move.
+ * in STKillerMoveStagedDefense stipulation slices.
+ * These provide an optimisation when looking for refutations: instead of
+ * generating all defenses before trying the first one, the defenses are
+ * generated in stages, first those of the "killer" piece, then those of the
+ * other pieces one piece at a time. Once a refutation is found, the moves
+ * of the remaining pieces are not generated at all.
  */
 
-/* Optimise a STMoveGenerator slice for defending against a goal
+/* Optimise a STMoveGenerator slice for finding refutations by generating the
+ * defenses in stages
  * @param si identifies slice to be optimised
- * @param st structure holding traversal that led to the generator to be
- *        optimised
  */
-void killer_move_optimise_final_defense_move(slice_index si,
-                                             stip_structure_traversal *st);
+void killer_move_stage_defense_move_generator(slice_index si);
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
@@ -33,6 +32,6 @@ void killer_move_optimise_final_defense_move(slice_index si,
  *            n+3 no solution found in next branch
  *            (with n denominating solve_nr_remaining)
  */
-void killer_move_final_defense_move_solve(slice_index si);
+void killer_move_staged_defense_solve(slice_index si);
 
 #endif
@@ -38,8 +38,16 @@ void dont_try_observing_with_non_existing_walk_both_sides(slice_index si)
   TraceFunctionResultEnd();
 }
 
-static boolean observation_by_rook_tested[maxply+1];
-static boolean observation_by_bishop_tested[maxply+1];
+static boolean *observation_by_rook_tested;
+static boolean *observation_by_bishop_tested;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void observation_optimisations_allocate_ply_tables(void)
+{
+  observation_by_rook_tested = ply_allocate_table(maxply+1,sizeof observation_by_rook_tested[0]);
+  observation_by_bishop_tested = ply_allocate_table(maxply+1,sizeof observation_by_bishop_tested[0]);
+}
 
 /* Initialise counters used for determining whether observations by queen
  * can be optimised away because of observations by rook+bishop
@@ -38,4 +38,8 @@ boolean is_observation_trivially_validated(Side side);
  */
 void optimise_is_square_observed(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void observation_optimisations_allocate_ply_tables(void);
+
 #endif
@@ -0,0 +1,403 @@
+#include "optimisations/orthodox_legal_moves.h"
+#include "conditions/conditions.h"
+#include "options/options.h"
+#include "stipulation/goals/goals.h"
+#include "position/position.h"
+#include "position/bitboard.h"
+#include "position/pieceid.h"
+#include "pieces/pieces.h"
+#include "stipulation/pipe.h"
+#include "stipulation/slice_insertion.h"
+#include "solving/pipe.h"
+#include "debugging/trace.h"
+
+#include "debugging/assert.h"
+
+/* the riders (beside Queen) that move along the rays */
+static piece_walk_type const ray_rider[nr_bitboard_rays] = {
+  Rook, Rook, Bishop, Bishop,
+  Rook, Rook, Bishop, Bishop
+};
+
+/* last move of each ply whose legality has been established */
+static numecoup *top_known_legal;
+
+/* the analysis of the position of the current ply */
+static Side side_checking;
+static square king_square;
+static bitboard_type evasion_squares;
+static bitboard_type pinned_pieces;
+static bitboard_type pin_lines[nr_squares_on_board];
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void orthodox_legal_moves_allocate_ply_tables(void)
+{
+  top_known_legal = ply_allocate_table(maxply+1,sizeof top_known_legal[0]);
+}
+
+/* Find the nearest square of a ray that is occupied
+ * @param ray identifies the ray
+ * @param index bit index of the start square of the ray
+ * @param occupied the occupied squares
+ * @return bit index of the nearest occupied square; nr_squares_on_board if
+ *         there is none
+ */
+static unsigned int find_nearest_on_ray(bitboard_ray_type ray,
+                                        unsigned int index,
+                                        bitboard_type occupied)
+{
+  bitboard_type const blockers = bitboard_rays[ray][index] & occupied;
+
+  if (blockers==0)
+    return nr_squares_on_board;
+  else if (ray<bitboard_ray_down)
+    return bitboard_lowest_index(blockers);
+  else
+    return bitboard_highest_index(blockers);
+}
+
+/* Determine the squares of a ray up to and including some square
+ * @param ray identifies the ray
+ * @param from bit index of the start square of the ray (not included)
+ * @param to bit index of the last square
+ */
+static bitboard_type ray_segment(bitboard_ray_type ray,
+                                 unsigned int from, unsigned int to)
+{
+  return bitboard_rays[ray][from] & ~bitboard_rays[ray][to];
+}
+
+static boolean is_rider_of_ray(unsigned int index, bitboard_ray_type ray)
+{
+  square const s = bitboard_square_of_index(index);
+  piece_walk_type const p = get_walk_of_piece_on_square(s);
+  return ((p==ray_rider[ray] || p==Queen)
+          && TSTFLAG(being_solved.spec[s],side_checking));
+}
+
+static boolean is_pawn_observing(square sq_departure)
+{
+  return (get_walk_of_piece_on_square(sq_departure)==Pawn
+          && TSTFLAG(being_solved.spec[sq_departure],side_checking));
+}
+
+/* Determine the leapers (incl. king and pawns) of side_checking observing a
+ * square
+ * @param sq_target the square
+ * @return bitboard of the observing leapers
+ */
+static bitboard_type find_leaping_observers(square sq_target)
+{
+  unsigned int const index = bitboard_index_of_square(sq_target);
+  bitboard_type candidates = ((bitboard_king_steps[index]
+                               & being_solved_bitboards.by_walk[King])
+                              | (bitboard_knight_leaps[index]
+                                 & being_solved_bitboards.by_walk[Knight]));
+  bitboard_type result = 0;
+
+  while (candidates!=0)
+  {
+    unsigned int const i = bitboard_lowest_index(candidates);
+    if (TSTFLAG(being_solved.spec[bitboard_square_of_index(i)],side_checking))
+      result |= 1ULL<<i;
+    candidates &= candidates-1;
+  }
+
+  if (TSTFLAG(sq_spec(sq_target),
+              side_checking==White ? CapturableByWhPawnSq : CapturableByBlPawnSq))
+  {
+    numvec const dir_forward = side_checking==White ? dir_up : dir_down;
+    square const sq_right = sq_target-dir_forward-dir_right;
+    square const sq_left = sq_target-dir_forward-dir_left;
+
+    if (is_pawn_observing(sq_right))
+      result |= 1ULL<<bitboard_index_of_square(sq_right);
+    if (is_pawn_observing(sq_left))
+      result |= 1ULL<<bitboard_index_of_square(sq_left);
+  }
+
+  return result;
+}
+
+/* Determine the pinned pieces and the evasion squares of the side at the move
+ * in the current ply
+ */
+static void analyse_position(void)
+{
+  Side const side = trait[nbply];
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  side_checking = advers(side);
+  king_square = being_solved.king_square[side];
+  evasion_squares = ~0ULL;
+  pinned_pieces = 0;
+
+  if (king_square!=initsquare)
+  {
+    unsigned int const index = bitboard_index_of_square(king_square);
+    bitboard_type const occupied = being_solved_bitboards.occupied;
+    bitboard_type leapers = find_leaping_observers(king_square);
+    bitboard_ray_type ray;
+
+    /* a checking leaper has to be captured */
+    while (leapers!=0)
+    {
+      evasion_squares &= leapers & -leapers;
+      leapers &= leapers-1;
+    }
+
+    for (ray = 0; ray!=nr_bitboard_rays; ++ray)
+    {
+      unsigned int const first = find_nearest_on_ray(ray,index,occupied);
+      if (first!=nr_squares_on_board)
+      {
+        square const sq_first = bitboard_square_of_index(first);
+        if (is_rider_of_ray(first,ray))
+          /* a checking rider has to be captured or intercepted */
+          evasion_squares &= ray_segment(ray,index,first);
+        else if (TSTFLAG(being_solved.spec[sq_first],side))
+        {
+          unsigned int const second = find_nearest_on_ray(ray,first,occupied);
+          if (second!=nr_squares_on_board && is_rider_of_ray(second,ray))
+          {
+            pinned_pieces |= 1ULL<<first;
+            pin_lines[first] = ray_segment(ray,index,second);
+          }
+        }
+      }
+    }
+  }
+
+  TraceSquare(king_square);
+  TraceValue("%llx",evasion_squares);
+  TraceValue("%llx",pinned_pieces);
+  TraceEOL();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Determine whether the king mustn't move to a square, i.e. whether the square
+ * is observed by side_checking with the king removed from the board
+ * @param sq_arrival the square
+ */
+static boolean is_king_danger_square(square sq_arrival)
+{
+  unsigned int const index = bitboard_index_of_square(sq_arrival);
+  bitboard_type const occupied = (being_solved_bitboards.occupied
+                                  & ~(1ULL<<bitboard_index_of_square(king_square)));
+  bitboard_ray_type ray;
+
+  if (find_leaping_observers(sq_arrival)!=0)
+    return true;
+
+  for (ray = 0; ray!=nr_bitboard_rays; ++ray)
+  {
+    unsigned int const first = find_nearest_on_ray(ray,index,occupied);
+    if (first!=nr_squares_on_board && is_rider_of_ray(first,ray))
+      return true;
+  }
+
+  return false;
+}
+
+/* Determine whether the legality of a move can be established before it is
+ * played
+ * @param n index of the move in the move generation stack
+ */
+static boolean is_legality_decidable(numecoup n)
+{
+  square const sq_capture = move_generation_stack[n].capture;
+  return (move_generation_stack[n].departure!=nullsquare /* null move */
+          && (sq_capture==move_generation_stack[n].arrival
+              || sq_capture==no_capture
+              || sq_capture==pawn_multistep));
+}
+
+static boolean is_not_illegal(numecoup n)
+{
+  square const sq_departure = move_generation_stack[n].departure;
+  square const sq_arrival = move_generation_stack[n].arrival;
+
+  if (!is_legality_decidable(n))
+    return true;
+  else if (sq_departure==king_square)
+    return !is_king_danger_square(sq_arrival);
+  else
+  {
+    unsigned int const index_departure = bitboard_index_of_square(sq_departure);
+    bitboard_type const arrival = 1ULL<<bitboard_index_of_square(sq_arrival);
+
+    return ((evasion_squares&arrival)!=0
+            && ((pinned_pieces&(1ULL<<index_departure))==0
+                || (pin_lines[index_departure]&arrival)!=0));
+  }
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void orthodox_remove_illegal_moves_solve(slice_index si)
+{
+  numecoup const save_top_known_legal = top_known_legal[nbply];
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  assert(are_board_bitboards_up_to_date());
+
+  analyse_position();
+  move_generator_filter_moves(MOVEBASE_OF_PLY(nbply),&is_not_illegal);
+  top_known_legal[nbply] = CURRMOVE_OF_PLY(nbply);
+
+  pipe_solve_delegate(si);
+
+  top_known_legal[nbply] = save_top_known_legal;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Determine whether a move of the current ply is known to be legal since it has
+ * survived the removal of illegal moves
+ * @param n index of the move in the move generation stack
+ * @return true iff the move doesn't have to be tested for self-check
+ */
+boolean orthodox_legal_moves_is_move_known_legal(numecoup n)
+{
+  return n<=top_known_legal[nbply] && is_legality_decidable(n);
+}
+
+/* Determine whether a problem is orthodox enough for the removal of illegal
+ * moves
+ */
+static boolean is_problem_orthodox(void)
+{
+  unsigned int c;
+
+  if (piece_walk_may_exist_fairy
+      || (some_pieces_flags&PieSpMask)!=0)
+    return false;
+
+  for (c = 0; c!=CondCount; ++c)
+    if (CondFlag[c] && c!=noiprom)
+      return false;
+
+  for (c = 0; c!=ExtraCondCount; ++c)
+    if (ExtraCondFlag[c])
+      return false;
+
+  /* the move numbers written include illegal moves */
+  if (OptFlag[movenbr])
+    return false;
+
+  return true;
+}
+
+/* Reaching some goals doesn't require the move to be legal (e.g. the mating
+ * side of a double mate is in check itself)
+ */
+static void remember_goal_accepting_selfcheck(slice_index si,
+                                              stip_structure_traversal *st)
+{
+  boolean * const is_selfcheck_accepted = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  switch (SLICE_U(si).goal_handler.goal.type)
+  {
+    case goal_doublemate:
+    case goal_countermate:
+    case goal_dblstale:
+    case goal_autostale:
+    case goal_automate:
+      *is_selfcheck_accepted = true;
+      break;
+
+    default:
+      stip_traverse_structure_children(si,st);
+      break;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static boolean is_selfcheck_accepted_by_goal(slice_index si)
+{
+  boolean result = false;
+  stip_structure_traversal st;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  stip_structure_traversal_init(&st,&result);
+  stip_structure_traversal_override_single(&st,
+                                           STGoalReachedTester,
+                                           &remember_goal_accepting_selfcheck);
+  stip_traverse_structure(si,&st);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+static void insert_remover(slice_index si, stip_structure_traversal *st)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  stip_traverse_structure_children(si,st);
+
+  {
+    slice_index const prototype = alloc_pipe(STOrthodoxRemoveIllegalMoves);
+    slice_insertion_insert_contextually(si,st->context,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the solving machinery with the removal of illegal moves if the
+ * problem is orthodox
+ * @param si identifies the root slice of the solving machinery
+ */
+void solving_optimise_with_orthodox_legal_moves(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (is_problem_orthodox() && !is_selfcheck_accepted_by_goal(si))
+  {
+    stip_structure_traversal st;
+
+    stip_structure_traversal_init(&st,0);
+    stip_structure_traversal_override_single(&st,
+                                             STDoneGeneratingMoves,
+                                             &insert_remover);
+    stip_traverse_structure(si,&st);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,50 @@
+#if !defined(OPTIMISATIONS_ORTHODOX_LEGAL_MOVES_H)
+#define OPTIMISATIONS_ORTHODOX_LEGAL_MOVES_H
+
+#include "solving/machinery/solve.h"
+#include "solving/move_generator.h"
+
+/* This module implements the generation of legal moves only in orthodox
+ * problems (no fairy conditions or pieces).
+ * Once per ply, the pinned pieces and the squares where a piece has to arrive
+ * for evading a check are determined. Moves that would expose the own king
+ * are removed right after the generation; the remaining moves don't have to be
+ * tested for self-check by STSelfCheckGuard after having been played.
+ * King moves are decided by testing whether the arrival square is observed with
+ * the king removed from the board. En passant captures and castlings are left
+ * to STSelfCheckGuard.
+ */
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void orthodox_remove_illegal_moves_solve(slice_index si);
+
+/* Determine whether a move of the current ply is known to be legal since it has
+ * survived the removal of illegal moves
+ * @param n index of the move in the move generation stack
+ * @return true iff the move doesn't have to be tested for self-check
+ */
+boolean orthodox_legal_moves_is_move_known_legal(numecoup n);
+
+/* Instrument the solving machinery with the removal of illegal moves if the
+ * problem is orthodox
+ * @param si identifies the root slice of the solving machinery
+ */
+void solving_optimise_with_orthodox_legal_moves(slice_index si);
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void orthodox_legal_moves_allocate_ply_tables(void);
+
+#endif
@@ -2,8 +2,24 @@
 #include "solving/find_square_observer_tracking_back_from_target.h"
 #include "pieces/walks/pawns/en_passant.h"
 #include "position/position.h"
+#include "position/bitboard.h"
 #include "debugging/trace.h"
 #include "pieces/pieces.h"
+#include "debugging/assert.h"
+
+enum
+{
+  nr_rays_per_rider = 4
+};
+
+static bitboard_ray_type const rook_rays[nr_rays_per_rider] = {
+  bitboard_ray_up, bitboard_ray_right, bitboard_ray_down, bitboard_ray_left
+};
+
+static bitboard_ray_type const bishop_rays[nr_rays_per_rider] = {
+  bitboard_ray_up_left, bitboard_ray_up_right,
+  bitboard_ray_down_right, bitboard_ray_down_left
+};
 
 static vec_index_type leapers_check_ortho(Side side_checking,
                                           square sq_king,
@@ -128,11 +144,76 @@ vec_index_type pawn_check_ortho(Side side_checking, square sq_king)
   return result;
 }
 
+/* Determine whether some squares contain a piece of a side
+ * @param squares bitboard of the squares
+ * @param side the side
+ * @return true iff one of the squares contains a piece of side
+ */
+static boolean is_piece_of_side_on(bitboard_type squares, Side side)
+{
+  while (squares!=0)
+  {
+    square const s = bitboard_square_of_index(bitboard_lowest_index(squares));
+    if (TSTFLAG(being_solved.spec[s],side))
+      return true;
+    squares &= squares-1;
+  }
+
+  return false;
+}
+
+/* Count the riders of a side that observe a square along some rays
+ * @param side_checking the side
+ * @param sq_target the square
+ * @param rays the rays (starting at sq_target)
+ * @param walk the walk of the riders (beside Queen)
+ * @param stop_at_first stop counting as soon as one observer is found?
+ * @return number of observers found
+ */
+static unsigned int count_rider_observers(Side side_checking,
+                                          square sq_target,
+                                          bitboard_ray_type const rays[nr_rays_per_rider],
+                                          piece_walk_type walk,
+                                          boolean stop_at_first)
+{
+  unsigned int const index = bitboard_index_of_square(sq_target);
+  bitboard_type const riders = (being_solved_bitboards.by_walk[walk]
+                                | being_solved_bitboards.by_walk[Queen]);
+  unsigned int result = 0;
+  unsigned int i;
+
+  assert(is_on_board(sq_target));
+  assert(are_board_bitboards_up_to_date());
+
+  for (i = 0; i!=nr_rays_per_rider; ++i)
+    if ((bitboard_rays[rays[i]][index]&riders)!=0)
+    {
+      square const sq_departure = bitboard_find_end_of_line(index,rays[i]);
+      piece_walk_type const p = get_walk_of_piece_on_square(sq_departure);
+      if ((p==walk || p==Queen) && TSTFLAG(being_solved.spec[sq_departure],side_checking))
+      {
+        TraceWalk(p);TraceSquare(sq_departure);TraceEOL();
+        ++result;
+        if (stop_at_first)
+          break;
+      }
+    }
+
+  return result;
+}
+
 boolean is_square_observed_ortho(Side side_checking,
                                  square sq_target)
 {
+  unsigned int const index = bitboard_index_of_square(sq_target);
+
+  assert(is_on_board(sq_target));
+  assert(are_board_bitboards_up_to_date());
+
   if (being_solved.number_of_pieces[side_checking][King]>0
-      && king_check_ortho(side_checking,sq_target))
+      && is_piece_of_side_on(bitboard_king_steps[index]
+                             & being_solved_bitboards.by_walk[King],
+                             side_checking))
     return true;
 
   if (being_solved.number_of_pieces[side_checking][Pawn]>0
@@ -140,40 +221,20 @@ boolean is_square_observed_ortho(Side side_checking,
     return true;
 
   if (being_solved.number_of_pieces[side_checking][Knight]>0
-      && knight_check_ortho(side_checking,sq_target))
+      && is_piece_of_side_on(bitboard_knight_leaps[index]
+                             & being_solved_bitboards.by_walk[Knight],
+                             side_checking))
     return true;
 
-  if (being_solved.number_of_pieces[side_checking][Queen]>0
-      || being_solved.number_of_pieces[side_checking][Rook]>0)
-  {
-    vec_index_type k;
-    for (k= vec_rook_end; k>=vec_rook_start; k--)
-    {
-      square const sq_departure = find_end_of_line(sq_target,vec[k]);
-      piece_walk_type const p = get_walk_of_piece_on_square(sq_departure);
-      if ((p==Rook || p==Queen) && TSTFLAG(being_solved.spec[sq_departure],side_checking))
-      {
-        TraceWalk(p);TraceSquare(sq_departure);TraceEOL();
-        return true;
-      }
-    }
-  }
+  if ((being_solved.number_of_pieces[side_checking][Queen]>0
+       || being_solved.number_of_pieces[side_checking][Rook]>0)
+      && count_rider_observers(side_checking,sq_target,rook_rays,Rook,true)>0)
+    return true;
 
-  if (being_solved.number_of_pieces[side_checking][Queen]>0
-      || being_solved.number_of_pieces[side_checking][Bishop]>0)
-  {
-    vec_index_type k;
-    for (k= vec_bishop_start; k<=vec_bishop_end; k++)
-    {
-      square const sq_departure = find_end_of_line(sq_target,vec[k]);
-      piece_walk_type const p = get_walk_of_piece_on_square(sq_departure);
-      if ((p==Bishop || p==Queen) && TSTFLAG(being_solved.spec[sq_departure],side_checking))
-      {
-        TraceWalk(p);TraceSquare(sq_departure);TraceEOL();
-        return true;
-      }
-    }
-  }
+  if ((being_solved.number_of_pieces[side_checking][Queen]>0
+       || being_solved.number_of_pieces[side_checking][Bishop]>0)
+      && count_rider_observers(side_checking,sq_target,bishop_rays,Bishop,true)>0)
+    return true;
 
   {
     piece_walk_type const *pcheck;
@@ -235,29 +296,11 @@ unsigned int count_interceptable_orthodox_checks(Side side_checking, square sq_t
 
   if (being_solved.number_of_pieces[side_checking][Queen]>0
       || being_solved.number_of_pieces[side_checking][Rook]>0)
-  {
-    vec_index_type k;
-    for (k= vec_rook_end; k>=vec_rook_start; k--)
-    {
-      square const sq_departure = find_end_of_line(sq_target,vec[k]);
-      piece_walk_type const p = get_walk_of_piece_on_square(sq_departure);
-      if ((p==Rook || p==Queen) && TSTFLAG(being_solved.spec[sq_departure],side_checking))
-        ++result;
-    }
-  }
+    result += count_rider_observers(side_checking,sq_target,rook_rays,Rook,false);
 
   if (being_solved.number_of_pieces[side_checking][Queen]>0
       || being_solved.number_of_pieces[side_checking][Bishop]>0)
-  {
-    vec_index_type k;
-    for (k= vec_bishop_start; k<=vec_bishop_end; k++)
-    {
-      square const sq_departure = find_end_of_line(sq_target,vec[k]);
-      piece_walk_type const p = get_walk_of_piece_on_square(sq_departure);
-      if ((p==Bishop || p==Queen) && TSTFLAG(being_solved.spec[sq_departure],side_checking))
-        ++result;
-    }
-  }
+    result += count_rider_observers(side_checking,sq_target,bishop_rays,Bishop,false);
 
   return result;
 }
@@ -0,0 +1,324 @@
+#include "optimisations/shared_hash_table.h"
+#include "platform/worker.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef unsigned long long fingerprint_type;
+
+/* An entry of the table. Both members are written and read with a single
+ * access each, but there is no guarantee that a reader sees both members
+ * written by the same writer.
+ */
+typedef struct
+{
+    fingerprint_type volatile check; /* fingerprint XOR data */
+    fingerprint_type volatile data;  /* epoch in the upper half */
+} entry_type;
+
+enum
+{
+  nr_entries_per_bucket = 4
+};
+
+/* with 8 byte fingerprints, a bucket fills a 64 byte cache line */
+typedef struct
+{
+    entry_type entry[nr_entries_per_bucket];
+} bucket_type;
+
+static bucket_type *buckets;
+static fingerprint_type nr_buckets;
+static size_t table_size;
+
+/* is the table in shared memory, or private to the current process? */
+static boolean is_memory_shared;
+
+/* Clearing a table of several Gigabytes takes a considerable amount of time;
+ * we therefore tag the entries with the number of the "epoch" in which they
+ * were written and clear the table by starting a new epoch.
+ * Epoch 0 denotes the entries of the freshly allocated table.
+ * The number of the latest epoch is kept behind the buckets (i.e. in shared
+ * memory if the table is shared),
+ * so that processes that clear the table concurrently (e.g. the workers
+ * enumerating target positions in intelligent mode) start different epochs
+ * and don't see each other's entries.
+ */
+enum
+{
+  epoch_shift = 32
+};
+static fingerprint_type const max_epoch = (1ULL<<epoch_shift)-1;
+static fingerprint_type current_epoch = 1;
+static unsigned long volatile *latest_epoch;
+
+static unsigned long nr_entered;
+
+/* Calculate the fingerprint of a key, and the hash that determines its bucket
+ * @param key the key
+ * @param bucket_hash where to store the hash that determines the bucket
+ * @return fingerprint
+ * @note the two hashes are calculated independently, so that all 64 bits of
+ *       the fingerprint distinguish the keys that share a bucket
+ */
+static fingerprint_type calc_fingerprint(BCMemValue const *key,
+                                         fingerprint_type *bucket_hash)
+{
+  /* FNV-1a, and a variant with different basis and multiplier */
+  fingerprint_type result = 0xcbf29ce484222325ULL;
+  fingerprint_type other = 0x84222325cbf29ce4ULL;
+  unsigned int i;
+
+  for (i = 0; i!=key->Leng; ++i)
+  {
+    result ^= key->Data[i];
+    result *= 0x100000001b3ULL;
+    other ^= key->Data[i];
+    other *= 0x9e3779b97f4a7c15ULL;
+  }
+
+  /* distribute the influence of the last bytes over all bits */
+  result ^= result>>33;
+  result *= 0xff51afd7ed558ccdULL;
+  result ^= result>>33;
+
+  other ^= other>>33;
+  other *= 0xc4ceb9fe1a85ec53ULL;
+  other ^= other>>33;
+
+  *bucket_hash = other;
+
+  return result;
+}
+
+static bucket_type *find_bucket(fingerprint_type bucket_hash)
+{
+  return &buckets[bucket_hash & (nr_buckets-1)];
+}
+
+static boolean is_entry_empty(entry_type const *entry)
+{
+  return (entry->data>>epoch_shift)!=current_epoch;
+}
+
+static boolean read_entry(entry_type const *entry,
+                          fingerprint_type fingerprint,
+                          shared_hash_table_data_type *data)
+{
+  fingerprint_type const entry_data = entry->data;
+  fingerprint_type const entry_check = entry->check;
+
+  if ((entry_data>>epoch_shift)==current_epoch
+      && (entry_check^entry_data)==fingerprint)
+  {
+    *data = (shared_hash_table_data_type)entry_data;
+    return true;
+  }
+  else
+    return false;
+}
+
+static void write_entry(entry_type *entry,
+                        fingerprint_type fingerprint,
+                        shared_hash_table_data_type data)
+{
+  fingerprint_type const entry_data = (current_epoch<<epoch_shift) | data;
+  entry->check = fingerprint^entry_data;
+  entry->data = entry_data;
+}
+
+static bucket_type *allocate_buckets(size_t size)
+{
+  if (is_memory_shared)
+    return platform_allocate_shared_memory(size);
+  else
+    /* the memory of a private table has to be zeroed as well */
+    return calloc(1,size);
+}
+
+static void free_buckets(void)
+{
+  if (is_memory_shared)
+    platform_free_shared_memory(buckets,table_size+sizeof *latest_epoch);
+  else
+    free(buckets);
+
+  buckets = 0;
+  latest_epoch = 0;
+}
+
+/* Allocate the table. If the requested amount of memory isn't available,
+ * reduce the amount until allocation succeeds.
+ * @param nr_kilos number of kilo-bytes to allocate
+ * @param is_shared true iff the table is to be shared with workers
+ * @return number of kilo-bytes actually allocated
+ * @note a table that is to be shared must be allocated before workers are
+ *       started
+ * @note a table allocated earlier is freed
+ */
+unsigned long shared_hash_table_allocate(unsigned long nr_kilos,
+                                         boolean is_shared)
+{
+  size_t const one_kilo = 1<<10;
+  unsigned long result = 0;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%lu",nr_kilos);
+  TraceFunctionParam("%u",is_shared);
+  TraceFunctionParamListEnd();
+
+  if (buckets!=0)
+    free_buckets();
+
+  is_memory_shared = is_shared;
+
+  if (nr_kilos > (((size_t) -1)/one_kilo))
+    nr_kilos = (((size_t) -1)/one_kilo);
+
+  /* we need a power of 2 buckets */
+  nr_buckets = 1;
+  while (nr_buckets*2*sizeof(bucket_type)<=nr_kilos*one_kilo)
+    nr_buckets *= 2;
+
+  while (nr_buckets*sizeof(bucket_type)>=one_kilo)
+  {
+    table_size = (size_t)nr_buckets*sizeof(bucket_type);
+    buckets = allocate_buckets(table_size+sizeof *latest_epoch);
+    if (buckets==0)
+      nr_buckets /= 2;
+    else
+    {
+      latest_epoch = (unsigned long volatile *)(buckets+nr_buckets);
+      *latest_epoch = current_epoch;
+      result = (unsigned long)(table_size/one_kilo);
+      break;
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%lu",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Determine whether the table has been successfully allocated
+ * @return true iff the table has been allocated
+ */
+boolean shared_hash_table_is_allocated(void)
+{
+  return buckets!=0;
+}
+
+/* Remove all entries from the table
+ */
+void shared_hash_table_clear(void)
+{
+  assert(buckets!=0);
+
+  if (is_memory_shared)
+    current_epoch = platform_increment_shared_counter(latest_epoch);
+  else
+    current_epoch = ++*latest_epoch;
+  if (current_epoch>max_epoch)
+  {
+    memset(buckets,0,table_size);
+    current_epoch = 1;
+    *latest_epoch = current_epoch;
+  }
+
+  nr_entered = 0;
+}
+
+/* Determine the number of entries that the table can hold
+ * @return number of entries
+ */
+unsigned long shared_hash_table_capacity(void)
+{
+  return (unsigned long)(nr_buckets*nr_entries_per_bucket);
+}
+
+/* Determine the number of entries entered into the table by the current
+ * process since the table was last cleared
+ * @return number of entries
+ */
+unsigned long shared_hash_table_nr_entered(void)
+{
+  return nr_entered;
+}
+
+/* Look up a key
+ * @param key the key
+ * @param data where to store the data of the entry if the key is found
+ * @return true iff the key was found
+ */
+boolean shared_hash_table_lookup(BCMemValue const *key,
+                                 shared_hash_table_data_type *data)
+{
+  fingerprint_type bucket_hash;
+  fingerprint_type const fingerprint = calc_fingerprint(key,&bucket_hash);
+  bucket_type const * const bucket = find_bucket(bucket_hash);
+  unsigned int i;
+
+  for (i = 0; i!=nr_entries_per_bucket; ++i)
+    if (read_entry(&bucket->entry[i],fingerprint,data))
+      return true;
+
+  return false;
+}
+
+/* Store the data for a key, entering the key if it isn't there yet
+ * @param key the key
+ * @param data data to be stored
+ * @param valuation used for deciding which entry to replace if the bucket is
+ *                  full
+ * @return true iff an entry for a different key had to be replaced
+ */
+boolean shared_hash_table_store(BCMemValue const *key,
+                                shared_hash_table_data_type data,
+                                shared_hash_table_valuation_type valuation)
+{
+  fingerprint_type bucket_hash;
+  fingerprint_type const fingerprint = calc_fingerprint(key,&bucket_hash);
+  bucket_type * const bucket = find_bucket(bucket_hash);
+  shared_hash_table_data_type stored;
+  unsigned int i;
+
+  for (i = 0; i!=nr_entries_per_bucket; ++i)
+    if (read_entry(&bucket->entry[i],fingerprint,&stored))
+    {
+      write_entry(&bucket->entry[i],fingerprint,data);
+      return false;
+    }
+
+  for (i = 0; i!=nr_entries_per_bucket; ++i)
+    if (is_entry_empty(&bucket->entry[i]))
+    {
+      write_entry(&bucket->entry[i],fingerprint,data);
+      ++nr_entered;
+      return false;
+    }
+
+  {
+    /* the data member of an entry has always been written as a whole, so we
+     * can evaluate it even if the entry is being overwritten */
+    unsigned int victim = 0;
+    unsigned int victim_value = (*valuation)((shared_hash_table_data_type)bucket->entry[0].data);
+
+    for (i = 1; i!=nr_entries_per_bucket; ++i)
+    {
+      unsigned int const value = (*valuation)((shared_hash_table_data_type)bucket->entry[i].data);
+      if (value<victim_value)
+      {
+        victim = i;
+        victim_value = value;
+      }
+    }
+
+    write_entry(&bucket->entry[victim],fingerprint,data);
+    ++nr_entered;
+  }
+
+  return true;
+}
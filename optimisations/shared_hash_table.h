@@ -0,0 +1,89 @@
+#if !defined(OPTIMISATIONS_SHARED_HASH_TABLE_H)
+#define OPTIMISATIONS_SHARED_HASH_TABLE_H
+
+#include "DHT/dhtbcmem.h"
+#include "utilities/boolean.h"
+
+/* This module implements a hash table of fixed size that can be shared between
+ * the workers solving a problem in parallel (cf. platform/worker.h).
+ *
+ * The table doesn't store the keys themselves, but a 64 bit fingerprint of
+ * each key. It is organised in buckets the size of a typical cache line; each
+ * key can only be stored in one bucket, which is determined by a second hash
+ * of the key. A lookup therefore only confuses two keys if both their
+ * fingerprints and their buckets are equal. The keys found are not verified
+ * otherwise - there is no room for the keys themselves in the entries.
+ *
+ * Accesses are not locked; instead, each entry holds the XOR of fingerprint
+ * and data in addition to the data, so that an entry that is being
+ * overwritten by a different process is recognised as not matching rather
+ * than delivering wrong data.
+ *
+ * If the bucket of a key is full, the least valuable entry of the bucket is
+ * replaced.
+ *
+ * A single process can use the table as well (command line option
+ * -compacthash): at 16 bytes per entry, it holds several times more positions
+ * than the dynamic hash table (cf. DHT/dht.h) in the same amount of memory.
+ */
+
+typedef unsigned int shared_hash_table_data_type;
+
+/* Determine how valuable an entry of the table is
+ * @param data data of the entry
+ * @return value; the entry with the lowest value of a bucket is replaced
+ */
+typedef unsigned int (*shared_hash_table_valuation_type)(shared_hash_table_data_type data);
+
+/* Allocate the table. If the requested amount of memory isn't available,
+ * reduce the amount until allocation succeeds.
+ * @param nr_kilos number of kilo-bytes to allocate
+ * @param is_shared true iff the table is to be shared with workers
+ * @return number of kilo-bytes actually allocated
+ * @note a table that is to be shared must be allocated before workers are
+ *       started
+ * @note a table allocated earlier is freed
+ */
+unsigned long shared_hash_table_allocate(unsigned long nr_kilos,
+                                         boolean is_shared);
+
+/* Determine whether the table has been successfully allocated
+ * @return true iff the table has been allocated
+ */
+boolean shared_hash_table_is_allocated(void);
+
+/* Remove all entries from the table
+ */
+void shared_hash_table_clear(void);
+
+/* Determine the number of entries that the table can hold
+ * @return number of entries
+ */
+unsigned long shared_hash_table_capacity(void);
+
+/* Determine the number of entries entered into the table by the current
+ * process since the table was last cleared
+ * @return number of entries
+ */
+unsigned long shared_hash_table_nr_entered(void);
+
+/* Look up a key
+ * @param key the key
+ * @param data where to store the data of the entry if the key is found
+ * @return true iff the key was found
+ */
+boolean shared_hash_table_lookup(BCMemValue const *key,
+                                 shared_hash_table_data_type *data);
+
+/* Store the data for a key, entering the key if it isn't there yet
+ * @param key the key
+ * @param data data to be stored
+ * @param valuation used for deciding which entry to replace if the bucket is
+ *                  full
+ * @return true iff an entry for a different key had to be replaced
+ */
+boolean shared_hash_table_store(BCMemValue const *key,
+                                shared_hash_table_data_type data,
+                                shared_hash_table_valuation_type valuation);
+
+#endif
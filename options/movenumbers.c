@@ -7,6 +7,8 @@
 #include "solving/check.h"
 #include "solving/pipe.h"
 #include "options/movenumbers/restart_guard_intelligent.h"
+#include "options/movenumbers/checkpoint.h"
+#include "options/options.h"
 #include "output/output.h"
 #include "output/plaintext/plaintext.h"
 #include "output/plaintext/protocol.h"
@@ -19,17 +21,25 @@
 
 /* number of current move at root level
  */
-static unsigned int MoveNbr[maxply+1];
+static unsigned int *MoveNbr;
 
 /* number of first move at root level to be considered
  * we use the parent ply as index because the ply number of the parent ply of the
  * root branch is always known, while the ply of the root branch isn't known ahead
  * of playing it in all cases.
  */
-static unsigned int RestartNbr[maxply+1];
+static unsigned int *RestartNbr;
 
 static boolean restart_deep;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void move_numbers_allocate_ply_tables(void)
+{
+  MoveNbr = ply_allocate_table(maxply+1,sizeof MoveNbr[0]);
+  RestartNbr = ply_allocate_table(maxply+1,sizeof RestartNbr[0]);
+}
+
 static void write_history_recursive(ply ply)
 {
   if (ply>ply_retro_move+1)
@@ -64,6 +74,8 @@ void reset_restart_number(void)
     MoveNbr[ply] = 1;
   }
 
+  RestartNbr[ply_retro_move] = checkpoint_start_problem();
+
   restart_deep = false;
 }
 
@@ -72,6 +84,25 @@ unsigned int get_restart_number(void)
   return RestartNbr[ply_retro_move];
 }
 
+/* Retrieve the number of the next move at a root level ply
+ * @param ply identifies the ply
+ * @return the move number
+ */
+unsigned int move_numbers_get_next(ply ply)
+{
+  return MoveNbr[ply];
+}
+
+/* Set the number of the next move at a root level ply, e.g. after the moves
+ * have been played by a different process
+ * @param ply identifies the ply
+ * @param nr the move number
+ */
+void move_numbers_set_next(ply ply, unsigned int nr)
+{
+  MoveNbr[ply] = nr;
+}
+
 /* Interpret maxmem command line parameter value
  * @param commandLineValue value of -maxmem command line parameter
  */
@@ -106,7 +137,7 @@ boolean read_restart_number(char const *optionValue)
 
 static void WriteMoveNbr(slice_index si)
 {
-  if (MoveNbr[nbply]>=RestartNbr[parent_ply[nbply]])
+  if (OptFlag[movenbr] && MoveNbr[nbply]>=RestartNbr[parent_ply[nbply]])
   {
     protocol_fprintf(stdout,"\n%3u  (", MoveNbr[nbply]);
     output_plaintext_write_move(&output_plaintext_engine,
@@ -137,11 +168,27 @@ static void WriteMoveNbr(slice_index si)
  */
 void restart_guard_solve(slice_index si)
 {
+  boolean const is_root = parent_ply[nbply]==ply_retro_move;
+  boolean is_solved_before_checkpoint = false;
+
   TraceFunctionEntry(__func__);
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
 
-  WriteMoveNbr(si);
+  if (is_root)
+  {
+    /* the guard of each phase is solved for the first time when the phase
+     * starts */
+    if (SLICE_U(si).value_handler.value==0)
+      SLICE_U(si).value_handler.value = checkpoint_start_phase();
+
+    is_solved_before_checkpoint =
+        checkpoint_is_root_move_solved((unsigned int)SLICE_U(si).value_handler.value,
+                                       MoveNbr[nbply]);
+  }
+
+  if (!is_solved_before_checkpoint)
+    WriteMoveNbr(si);
 
   ++MoveNbr[nbply];
 
@@ -149,7 +196,13 @@ void restart_guard_solve(slice_index si)
   TraceValue("%u",MoveNbr[nbply]);
   TraceValue("%u",RestartNbr[nbply]);
   TraceEOL();
-  pipe_this_move_doesnt_solve_if(si,MoveNbr[nbply]<=RestartNbr[parent_ply[nbply]]);
+  pipe_this_move_doesnt_solve_if(si,
+                                 is_solved_before_checkpoint
+                                 || MoveNbr[nbply]<=RestartNbr[parent_ply[nbply]]);
+
+  if (is_root)
+    checkpoint_root_move_done((unsigned int)SLICE_U(si).value_handler.value,
+                              MoveNbr[nbply]);
 
   MoveNbr[nbply+1] = 0;
 
@@ -205,6 +258,16 @@ void restart_guard_nested_solve(slice_index si)
   TraceFunctionResultEnd();
 }
 
+static slice_index alloc_restart_guard(void)
+{
+  slice_index const result = alloc_pipe(STRestartGuard);
+
+  /* number of the phase that the guard belongs to; 0 until it is solved */
+  SLICE_U(result).value_handler.value = 0;
+
+  return result;
+}
+
 static void insert_guard_attack(slice_index si, stip_structure_traversal *st)
 {
   TraceFunctionEntry(__func__);
@@ -212,7 +275,7 @@ static void insert_guard_attack(slice_index si, stip_structure_traversal *st)
   TraceFunctionParamListEnd();
 
   {
-    slice_index const prototype = alloc_pipe(STRestartGuard);
+    slice_index const prototype = alloc_restart_guard();
     slice_insertion_insert(si,&prototype,1);
   }
 
@@ -246,7 +309,7 @@ static void insert_guard_help(slice_index si, stip_structure_traversal *st)
       if (restart_deep)
       {
         slice_index const prototypes[] = {
-            alloc_pipe(STRestartGuard),
+            alloc_restart_guard(),
             alloc_pipe(STRestartGuardNested),
             alloc_pipe(STRestartGuardNested)
         };
@@ -254,13 +317,14 @@ static void insert_guard_help(slice_index si, stip_structure_traversal *st)
       }
       else
       {
-        slice_index const prototype = alloc_pipe(STRestartGuard);
+        slice_index const prototype = alloc_restart_guard();
         slice_insertion_insert(si,&prototype,1);
       }
     }
   }
-  else
+  else if (OptFlag[movenbr])
   {
+    /* checkpoints aren't supported in intelligent mode */
     slice_index const prototypes[] = {
         alloc_restart_guard_intelligent(),
         alloc_intelligent_target_counter()
@@ -27,6 +27,19 @@ unsigned int get_restart_number(void);
  */
 boolean read_restart_number(char const *optionValue);
 
+/* Retrieve the number of the next move at a root level ply
+ * @param ply identifies the ply
+ * @return the move number
+ */
+unsigned int move_numbers_get_next(ply ply);
+
+/* Set the number of the next move at a root level ply, e.g. after the moves
+ * have been played by a different process
+ * @param ply identifies the ply
+ * @param nr the move number
+ */
+void move_numbers_set_next(ply ply, unsigned int nr);
+
 /* Instrument stipulation with STRestartGuard slices
  * @param si identifies slice where to start
  */
@@ -48,4 +61,8 @@ void solving_insert_restart_guards(slice_index si);
 void restart_guard_solve(slice_index si);
 void restart_guard_nested_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void move_numbers_allocate_ply_tables(void);
+
 #endif
@@ -0,0 +1,307 @@
+#include "options/movenumbers/checkpoint.h"
+#include "optimisations/hash.h"
+#include "input/plaintext/token.h"
+#include "platform/maxtime.h"
+#include "platform/timer.h"
+#include "solving/parallel/workers.h"
+#include "solving/parallel/partition.h"
+#include "solving/parallel/twins.h"
+#include "solving/machinery/twin.h"
+#include "debugging/trace.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+enum
+{
+  /* saving a big hash table takes a while */
+  min_seconds_between_table_saves = 600
+};
+
+static char *path;
+static char *new_path;
+
+static unsigned int nr_problems_started;
+
+/* twins and phases (e.g. set play, the halves of a duplex) are numbered from 1
+ * within a problem resp. a twin */
+static twin_id_type first_twin_id;
+static unsigned int current_twin;
+static unsigned int nr_phases_started;
+
+static boolean is_resuming;
+static unsigned int resumed_problem;
+static unsigned int resumed_twin;
+static unsigned int resumed_phase;
+static unsigned int resumed_next_move_nbr;
+static unsigned long long resumed_input_fingerprint;
+
+static unsigned long long time_of_last_table_save;
+
+/* Write checkpoints to a file
+ * @param file_path path of the checkpoint file
+ */
+void checkpoint_set_file(char const *file_path)
+{
+  size_t const length = strlen(file_path);
+
+  free(path);
+  free(new_path);
+
+  path = malloc(length+1);
+  new_path = malloc(length+4+1);
+
+  if (path==0 || new_path==0)
+  {
+    free(path);
+    free(new_path);
+    path = 0;
+    new_path = 0;
+  }
+  else
+  {
+    strcpy(path,file_path);
+    sprintf(new_path,"%s.new",file_path);
+  }
+}
+
+/* Resume solving from a checkpoint file, and continue writing checkpoints
+ * to it
+ * @param file_path path of the checkpoint file
+ * @return true iff the checkpoint could be read
+ */
+boolean checkpoint_resume(char const *file_path)
+{
+  boolean result = false;
+  FILE * const file = fopen(file_path,"r");
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%s",file_path);
+  TraceFunctionParamListEnd();
+
+  if (file!=0)
+  {
+    if (fscanf(file,
+               " Popeye checkpoint problem %u twin %u phase %u move %u input %llx",
+               &resumed_problem,
+               &resumed_twin,
+               &resumed_phase,
+               &resumed_next_move_nbr,
+               &resumed_input_fingerprint)==5
+        && resumed_problem>0 && resumed_twin>0 && resumed_phase>0
+        && resumed_next_move_nbr>0)
+    {
+      is_resuming = true;
+      result = true;
+    }
+
+    fclose(file);
+  }
+
+  checkpoint_set_file(file_path);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Determine whether checkpoints are written
+ * @return true iff checkpoints are written
+ * @note checkpoints aren't supported when solving in parallel
+ */
+boolean checkpoint_is_enabled(void)
+{
+  return (path!=0
+          && parallel_get_nr_workers()<=1
+          && parallel_get_nr_twin_workers()<=1
+          && !parallel_is_partitioned());
+}
+
+static void write_checkpoint(unsigned int phase, unsigned int next_move_nbr)
+{
+  FILE * const file = fopen(new_path,"w");
+
+  if (file!=0)
+  {
+    boolean const is_written = fprintf(file,
+                                       "Popeye checkpoint\n"
+                                       "problem %u\n"
+                                       "twin %u\n"
+                                       "phase %u\n"
+                                       "move %u\n"
+                                       "input %016llx\n",
+                                       nr_problems_started,
+                                       current_twin,
+                                       phase,
+                                       next_move_nbr,
+                                       InputGetFingerprint())>0;
+
+    /* some platforms refuse to rename to an existing file */
+    if (fclose(file)==0 && is_written)
+    {
+      remove(path);
+      if (rename(new_path,path)!=0)
+        remove(new_path);
+    }
+    else
+      remove(new_path);
+  }
+}
+
+/* Report the start of a problem
+ * @return number of root moves of the problem to be skipped because they
+ *         have been solved before the checkpoint; the root moves of the
+ *         problem where solving is resumed are skipped by
+ *         checkpoint_is_root_move_solved()
+ */
+unsigned int checkpoint_start_problem(void)
+{
+  unsigned int result = 0;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  ++nr_problems_started;
+  first_twin_id = twin_id;
+  current_twin = 1;
+  nr_phases_started = 0;
+
+  if (checkpoint_is_enabled())
+  {
+    if (is_resuming)
+    {
+      if (nr_problems_started<resumed_problem)
+        result = UINT_MAX;
+      else if (nr_problems_started==resumed_problem)
+      {
+        if (resumed_twin==1 && resumed_phase==1 && resumed_next_move_nbr==1)
+          is_resuming = false;
+      }
+      else
+        is_resuming = false;
+    }
+
+    if (!is_resuming)
+      write_checkpoint(1,1);
+
+    time_of_last_table_save = platform_read_fine_clock();
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Report the start of a phase (e.g. set play, one half of a duplex) of the
+ * current twin, i.e. that its first move at root level is about to be solved
+ * @return number of the phase within the twin
+ */
+unsigned int checkpoint_start_phase(void)
+{
+  unsigned int const twin = (unsigned int)(twin_id-first_twin_id)+1;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (twin!=current_twin)
+  {
+    current_twin = twin;
+    nr_phases_started = 0;
+  }
+
+  ++nr_phases_started;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",nr_phases_started);
+  TraceFunctionResultEnd();
+  return nr_phases_started;
+}
+
+/* Determine whether a move at root level has been solved before the checkpoint
+ * that solving is resumed from
+ * @param phase phase of the current twin as returned by checkpoint_start_phase()
+ * @param move_nbr number of the move
+ * @return true iff the move is to be skipped
+ * @note earlier twins and phases are skipped as a whole, later ones are solved
+ *       in full
+ */
+boolean checkpoint_is_root_move_solved(unsigned int phase, unsigned int move_nbr)
+{
+  boolean result = false;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",phase);
+  TraceFunctionParam("%u",move_nbr);
+  TraceFunctionParamListEnd();
+
+  if (is_resuming
+      && nr_problems_started==resumed_problem
+      && checkpoint_is_enabled())
+  {
+    if (current_twin<resumed_twin)
+      result = true;
+    else if (current_twin==resumed_twin)
+    {
+      if (phase<resumed_phase)
+        result = true;
+      else if (phase==resumed_phase)
+        result = move_nbr<resumed_next_move_nbr;
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Report that a move at root level has been solved or skipped
+ * @param phase phase of the current twin as returned by checkpoint_start_phase()
+ * @param next_move_nbr number of the next move at root level
+ */
+void checkpoint_root_move_done(unsigned int phase, unsigned int next_move_nbr)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",phase);
+  TraceFunctionParam("%u",next_move_nbr);
+  TraceFunctionParamListEnd();
+
+  if (!checkpoint_is_enabled())
+  {
+    /* nothing */
+  }
+  else
+  {
+    if (is_resuming
+        && nr_problems_started==resumed_problem
+        && !checkpoint_is_root_move_solved(phase,next_move_nbr-1))
+    {
+      /* we have skipped what was solved before the checkpoint */
+      is_resuming = false;
+      if (InputGetFingerprint()!=resumed_input_fingerprint)
+        fprintf(stderr,
+                "checkpoint file %s doesn't seem to belong to this input\n",
+                path);
+    }
+
+    if (!is_resuming && !platform_has_maxtime_elapsed())
+    {
+      unsigned long long const now = platform_read_fine_clock();
+      if (now-time_of_last_table_save
+          >=min_seconds_between_table_saves*1000000000ULL)
+      {
+        hash_save_to_cache();
+        time_of_last_table_save = now;
+      }
+
+      write_checkpoint(phase,next_move_nbr);
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
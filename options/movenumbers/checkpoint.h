@@ -0,0 +1,68 @@
+#if !defined(OPTIONS_MOVENUMBERS_CHECKPOINT_H)
+#define OPTIONS_MOVENUMBERS_CHECKPOINT_H
+
+#include "utilities/boolean.h"
+
+/* This module implements checkpoints of long solving runs (command line
+ * options -checkpoint and -resume).
+ * After each move at root level, the numbers of the problem, of the twin and
+ * of the phase (e.g. set play, one half of a duplex) being solved and the
+ * number of the next move at root level (as written by option movenumbers)
+ * are written to the checkpoint file. If the contents of the
+ * hash table are cached (command line option -hashcache), the table is saved
+ * to the cache file every now and then as well.
+ * A run resumed from a checkpoint skips the problems, twins, phases and root
+ * moves that have already been solved, i.e. it behaves as if option start had
+ * been used in the phase where solving was interrupted; the hash table is
+ * preloaded from the cache file.
+ */
+
+/* Write checkpoints to a file
+ * @param file_path path of the checkpoint file
+ */
+void checkpoint_set_file(char const *file_path);
+
+/* Resume solving from a checkpoint file, and continue writing checkpoints
+ * to it
+ * @param file_path path of the checkpoint file
+ * @return true iff the checkpoint could be read
+ */
+boolean checkpoint_resume(char const *file_path);
+
+/* Determine whether checkpoints are written
+ * @return true iff checkpoints are written
+ * @note checkpoints aren't supported when solving in parallel
+ */
+boolean checkpoint_is_enabled(void);
+
+/* Report the start of a problem
+ * @return number of root moves of the problem to be skipped because they
+ *         have been solved before the checkpoint; the root moves of the
+ *         problem where solving is resumed are skipped by
+ *         checkpoint_is_root_move_solved()
+ */
+unsigned int checkpoint_start_problem(void);
+
+/* Report the start of a phase (e.g. set play, one half of a duplex) of the
+ * current twin, i.e. that its first move at root level is about to be solved
+ * @return number of the phase within the twin
+ */
+unsigned int checkpoint_start_phase(void);
+
+/* Determine whether a move at root level has been solved before the checkpoint
+ * that solving is resumed from
+ * @param phase phase of the current twin as returned by checkpoint_start_phase()
+ * @param move_nbr number of the move
+ * @return true iff the move is to be skipped
+ * @note earlier twins and phases are skipped as a whole, later ones are solved
+ *       in full
+ */
+boolean checkpoint_is_root_move_solved(unsigned int phase, unsigned int move_nbr);
+
+/* Report that a move at root level has been solved or skipped
+ * @param phase phase of the current twin as returned by checkpoint_start_phase()
+ * @param next_move_nbr number of the next move at root level
+ */
+void checkpoint_root_move_done(unsigned int phase, unsigned int next_move_nbr);
+
+#endif
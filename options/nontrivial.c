@@ -21,7 +21,14 @@ unsigned int max_nr_nontrivial;
 
 /* Lengths of threats of the various move levels
  */
-static unsigned int non_trivial_count[maxply+1];
+static unsigned int *non_trivial_count;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void nontrivial_allocate_ply_tables(void)
+{
+  non_trivial_count = ply_allocate_table(maxply+1,sizeof non_trivial_count[0]);
+}
 
 /* Reset the non-trivial optimisation setting to off
  */
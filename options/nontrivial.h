@@ -65,4 +65,8 @@ void max_nr_nontrivial_guard_solve(slice_index si);
  */
 void max_nr_nontrivial_counter_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void nontrivial_allocate_ply_tables(void);
+
 #endif
@@ -43,8 +43,10 @@ typedef enum
   goal_is_end,     /* 33 */
   degeneratetree,  /* 34 */
   nullmoves,       /* 35 */
+  movehistory,     /* 36 */
+  bidirectional,   /* 37 */
 
-  OptCount         /* 35 */
+  OptCount         /* 38 */
 } Opt;
 
 extern boolean OptFlag[OptCount];
@@ -652,7 +652,9 @@ static char const * const OptString[LanguageCount][OptCount] =
   /*32*/  "RoquesMutuellementExclusifs",
   /*33*/  "ButEstFin",
   /*34*/  "optionnonpubliee",
-  /*35*/  "CoupsVides"
+  /*35*/  "CoupsVides",
+  /*36*/  "Historique",
+  /*37*/  "Bidirectionnel"
   },{
   /* Deutsch German Allemand */
   /* 0*/  "Widerlegung",
@@ -690,7 +692,9 @@ static char const * const OptString[LanguageCount][OptCount] =
   /*32*/  "RochadenGegenseitigAusschliessend",
   /*33*/  "ZielIstEnde",
   /*34*/  "nichtpublizierteoption",
-  /*35*/  "NullZuege"
+  /*35*/  "NullZuege",
+  /*36*/  "Historie",
+  /*37*/  "Bidirektional"
   },{
   /* English Anglais Englisch */
   /* 0*/  "Defence",
@@ -728,7 +732,9 @@ static char const * const OptString[LanguageCount][OptCount] =
   /*32*/  "CastlingMutuallyExclusive",
   /*33*/  "GoalIsEnd",
   /*34*/  "unpublishedoption",
-  /*35*/  "NullMoves"
+  /*35*/  "NullMoves",
+  /*36*/  "History",
+  /*37*/  "Bidirectional"
   }
 };
 
@@ -12,7 +12,14 @@
 
 /* Number of move inversions up to the current move
  */
-boolean is_end_of_intro_series[maxply+1];
+boolean *is_end_of_intro_series;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void output_plaintext_line_end_of_intro_series_marker_allocate_ply_tables(void)
+{
+  is_end_of_intro_series = ply_allocate_table(maxply+1,sizeof is_end_of_intro_series[0]);
+}
 
 /* Allocate a STOutputPlaintextLineEndOfIntroSeriesMarker slice.
  * @return index of allocated slice
@@ -11,7 +11,7 @@
 /* Number of move inversions up to the current move.
  * Exposed for read-only access only
  */
-extern boolean is_end_of_intro_series[maxply+1];
+extern boolean *is_end_of_intro_series;
 
 
 /* Allocate a STOutputPlaintextLineEndOfIntroSeriesMarker slice.
@@ -34,4 +34,8 @@ slice_index alloc_output_plaintext_line_end_of_intro_series_marker_slice(void);
  */
 void output_plaintext_line_end_of_intro_series_marker_solve(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void output_plaintext_line_end_of_intro_series_marker_allocate_ply_tables(void);
+
 #endif
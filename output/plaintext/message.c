@@ -15,6 +15,9 @@
 
 static boolean is_variable_output_suppressed = false;
 
+/* has the last error message left a line of standard error unterminated? */
+static boolean is_error_line_open = false;
+
 #if defined(DEBUG)
 #       define  DBG(x) fprintf x
 #else
@@ -55,7 +58,15 @@ static void output_plaintext_error_message_va_list(message_id_t id, va_list args
 #if !defined(QUIET)
   if (id<MsgCount)
   {
-    protocol_vfprintf(stderr,output_message_get(id),args);
+    /* keep the message in place if stdout and stderr go to the same file */
+    char const * const text = output_message_get(id);
+    size_t const length = strlen(text);
+
+    fflush(stdout);
+    protocol_vfprintf(stderr,text,args);
+
+    if (length>0)
+      is_error_line_open = text[length-1]!='\n';
   }
   else
     output_plaintext_error_message(InternalError,id);
@@ -119,9 +130,22 @@ void output_plaintext_input_error_message(message_id_t n, ...)
   output_plaintext_error_message(OffendingItem,InputLine);
   protocol_fputc('\n',stderr);
   protocol_fflush(stderr);
+  is_error_line_open = false;
 #endif
 }
 
+/* Terminate the line of standard error left unterminated by an error message
+ * (if any), so that the next text written there starts a line of its own
+ */
+void output_plaintext_error_start_line(void)
+{
+  if (is_error_line_open)
+  {
+    protocol_fputc('\n',stderr);
+    is_error_line_open = false;
+  }
+}
+
 static void format_time(void)
 {
   unsigned long msec;
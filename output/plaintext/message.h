@@ -43,6 +43,11 @@ void output_plaintext_fatal_message(message_id_t id);
  */
 void output_plaintext_input_error_message(message_id_t n, ...);
 
+/* Terminate the line of standard error left unterminated by an error message
+ * (if any), so that the next text written there starts a line of its own
+ */
+void output_plaintext_error_start_line(void);
+
 /* Issue a solving time indication
  * @param header text printed before the time
  * @param trail text printed after the time
@@ -5,8 +5,15 @@
 
 #include <stdarg.h>
 #include <stdio.h>
+#include <string.h>
+
+enum
+{
+  max_filename_length = 256
+};
 
 static FILE *TraceFile;
+static char TraceFileName[max_filename_length+1];
 static char const *open_mode = "a";
 
 /* Remember for this run's proptocol (if any) to overwrite (rather than append
@@ -30,6 +37,8 @@ FILE *protocol_open(char const *filename)
 
   TraceFile = fopen(filename,open_mode);
 
+  strncpy(TraceFileName,filename,max_filename_length);
+
   return TraceFile;
 }
 
@@ -42,6 +51,14 @@ FILE *protocol_get(void)
   return TraceFile;
 }
 
+/* Get the name of the most recently opened protocol file
+ * @return the name; 0 if no protocol file has been opened
+ */
+char const *protocol_get_filename(void)
+{
+  return TraceFileName[0]==0 ? 0 : TraceFileName;
+}
+
 /* If a protocol file is open, close it.
  * @return the return value of fclose if a protocol file was closed, 0 otherwise
  */
@@ -56,6 +73,23 @@ int protocol_close(void)
   return ret;
 }
 
+/* Stop writing to the current protocol file (if any) without closing it,
+ * e.g. in a worker process that shares the file with the master process.
+ */
+void protocol_detach(void)
+{
+  TraceFile = NULL;
+}
+
+/* Resume writing to a protocol file after protocol_detach()
+ * @param file the protocol file as returned by protocol_get() before
+ *             detaching
+ */
+void protocol_attach(FILE *file)
+{
+  TraceFile = file;
+}
+
 /* like putchar().
  * If a trace file is active, output goes to the trace file as well
  * @return the result of writing to *regular
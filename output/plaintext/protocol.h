@@ -26,11 +26,27 @@ FILE *protocol_open(char const *filename);
  */
 FILE *protocol_get(void);
 
+/* Get the name of the most recently opened protocol file
+ * @return the name; 0 if no protocol file has been opened
+ */
+char const *protocol_get_filename(void);
+
 /* If a protocol file is open, close it.
  * @return the return value of fclose if a protocol file was closed, 0 otherwise
  */
 int protocol_close(void);
 
+/* Stop writing to the current protocol file (if any) without closing it,
+ * e.g. in a worker process that shares the file with the master process.
+ */
+void protocol_detach(void);
+
+/* Resume writing to a protocol file after protocol_detach()
+ * @param file the protocol file as returned by protocol_get() before
+ *             detaching
+ */
+void protocol_attach(FILE *file);
+
 /* like putchar().
  * If a trace file is active, output goes to the trace file as well
  * @return the result of writing to *regular
@@ -12,6 +12,7 @@
 #include "solving/pipe.h"
 #include "solving/duplex.h"
 #include "stipulation/pipe.h"
+#include "debugging/trace.h"
 #include "debugging/assert.h"
 
 #include <stdio.h>
@@ -464,3 +465,44 @@ slice_index output_plaintext_alloc_twin_intro_writer_builder(void)
   TraceFunctionResultEnd();
   return result;
 }
+
+static void remove_intro_writer(slice_index si, stip_structure_traversal *st)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  stip_traverse_structure_children(si,st);
+
+  water_line = move_effect_journal_base[ply_twinning+1];
+  pipe_remove(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Remove the intro writers of the current twin without writing anything,
+ * e.g. because the twin's intro is written by another process
+ * @param si identifies the slice where to start removing
+ */
+void output_plaintext_remove_twin_intro_writers(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    stip_structure_traversal st;
+    stip_structure_traversal_init(&st,0);
+    stip_structure_traversal_override_single(&st,
+                                             STOutputPlaintextZeropositionIntroWriter,
+                                             &remove_intro_writer);
+    stip_structure_traversal_override_single(&st,
+                                             STOutputPlaintextTwinIntroWriter,
+                                             &remove_intro_writer);
+    stip_traverse_structure(si,&st);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -50,4 +50,10 @@ void output_plaintext_twin_intro_writer_builder_solve(slice_index si);
 
 slice_index output_plaintext_alloc_twin_intro_writer_builder(void);
 
+/* Remove the intro writers of the current twin without writing anything,
+ * e.g. because the twin's intro is written by another process
+ * @param si identifies the slice where to start removing
+ */
+void output_plaintext_remove_twin_intro_writers(slice_index si);
+
 #endif
@@ -14,14 +14,11 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-enum
-{
-  stack_size = max_nr_promotions_per_ply*maxply+1
-};
+#define stack_size (max_nr_promotions_per_ply*maxply+1)
 
 static unsigned int stack_pointer;
 
-static square change_into_chameleon_where[stack_size];
+static square *change_into_chameleon_where;
 
 static move_effect_journal_index_type horizon;
 
@@ -29,6 +26,13 @@ piece_walk_type chameleon_walk_sequence[nr_piece_walks];
 
 twin_id_type explicit_chameleon_squence_set_in_twin;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void chameleon_allocate_ply_tables(void)
+{
+  change_into_chameleon_where = ply_allocate_table(stack_size,sizeof change_into_chameleon_where[0]);
+}
+
 static void reset_sequence(chameleon_sequence_type* sequence)
 {
   piece_walk_type p;
@@ -83,4 +83,8 @@ void chameleon_chess_arriving_adjuster_solve(slice_index si);
  */
 void chameleon_chess_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void chameleon_allocate_ply_tables(void);
+
 #endif
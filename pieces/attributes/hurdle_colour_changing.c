@@ -27,17 +27,21 @@ typedef enum
 
 static colour_changing_hopper_existance_type promote_walk_into[nr_piece_walks];
 
-enum
-{
-  stack_size = max_nr_promotions_per_ply*maxply+1
-};
+#define stack_size (max_nr_promotions_per_ply*maxply+1)
 
-static boolean next_prom_to_changing_happening[stack_size];
+static boolean *next_prom_to_changing_happening;
 
 static unsigned int stack_pointer;
 
 static move_effect_journal_index_type horizon;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hurdle_colour_change_allocate_ply_tables(void)
+{
+  next_prom_to_changing_happening = ply_allocate_table(stack_size,sizeof next_prom_to_changing_happening[0]);
+}
+
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
  * @note assigns solve_result the length of solution found and written, i.e.:
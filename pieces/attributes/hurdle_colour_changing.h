@@ -55,4 +55,8 @@ void hurdle_colour_changer_solve(slice_index si);
  */
 void solving_insert_hurdle_colour_changers(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hurdle_colour_change_allocate_ply_tables(void);
+
 #endif
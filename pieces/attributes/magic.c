@@ -38,7 +38,7 @@ typedef struct
 
 static magicview_type magicviews[magicviews_size];
 
-static unsigned int magic_views_top[maxply + 1];
+static unsigned int *magic_views_top;
 
 static ply stack_pointer;
 
@@ -97,8 +97,17 @@ boolean magic_is_piece_supported(piece_walk_type p)
     }
 }
 
-static boolean are_we_finding_magic_views[maxply+1];
-static unsigned int prev_observation_context[maxply+1];
+static boolean *are_we_finding_magic_views;
+static unsigned int *prev_observation_context;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void magic_allocate_ply_tables(void)
+{
+  magic_views_top = ply_allocate_table(maxply+1,sizeof magic_views_top[0]);
+  are_we_finding_magic_views = ply_allocate_table(maxply+1,sizeof are_we_finding_magic_views[0]);
+  prev_observation_context = ply_allocate_table(maxply+1,sizeof prev_observation_context[0]);
+}
 
 static void identify_straight_line(void)
 {
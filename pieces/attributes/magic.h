@@ -49,4 +49,8 @@ void magic_pieces_recolorer_solve(slice_index si);
  */
 void solving_insert_magic_pieces_recolorers(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void magic_allocate_ply_tables(void);
+
 #endif
@@ -20,7 +20,7 @@
 boolean revelation_status_is_uninitialised;
 unsigned int nr_potential_revelations;
 revelation_status_type revelation_status[nr_squares_on_board];
-move_effect_journal_index_type top_before_revelations[maxply+1];
+move_effect_journal_index_type *top_before_revelations;
 motivation_type motivation[MaxPieceId+1];
 
 motivation_type const motivation_null = {
@@ -31,6 +31,13 @@ motivation_type const motivation_null = {
 static PieceIdType top_visible_piece_id;
 static PieceIdType top_invisible_piece_id;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void total_invisible_revelations_allocate_ply_tables(void)
+{
+  top_before_revelations = ply_allocate_table(maxply+1,sizeof top_before_revelations[0]);
+}
+
 void initialise_invisible_piece_ids(PieceIdType last_visible_piece_id)
 {
   top_visible_piece_id = last_visible_piece_id;
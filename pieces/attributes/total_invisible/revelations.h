@@ -29,7 +29,7 @@ extern motivation_type const motivation_null;
 extern boolean revelation_status_is_uninitialised;
 extern unsigned int nr_potential_revelations;
 extern revelation_status_type revelation_status[nr_squares_on_board];
-extern move_effect_journal_index_type top_before_revelations[maxply+1];
+extern move_effect_journal_index_type *top_before_revelations;
 
 void initialise_invisible_piece_ids(PieceIdType last_visible_piece_id);
 
@@ -89,4 +89,8 @@ void test_and_execute_revelations(move_effect_journal_index_type curr);
  */
 void total_invisible_reveal_after_mating_move(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void total_invisible_revelations_allocate_ply_tables(void);
+
 #endif
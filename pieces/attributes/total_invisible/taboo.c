@@ -11,7 +11,14 @@
 
 #include <stdlib.h>
 
-static unsigned int nr_taboos_for_current_move_in_ply[maxply+1][nr_sides][maxsquare+1];
+static unsigned int (*nr_taboos_for_current_move_in_ply)[nr_sides][maxsquare+1];
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void total_invisible_taboo_allocate_ply_tables(void)
+{
+  nr_taboos_for_current_move_in_ply = ply_allocate_table(maxply+1,sizeof nr_taboos_for_current_move_in_ply[0]);
+}
 
 static boolean is_move_by_invisible(square from, Side side, ply ply)
 {
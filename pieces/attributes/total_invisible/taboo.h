@@ -65,4 +65,8 @@ boolean is_taboo_violation_acceptable(square first_taboo_violation);
 
 square find_taboo_violation(void);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void total_invisible_taboo_allocate_ply_tables(void);
+
 #endif
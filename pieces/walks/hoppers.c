@@ -6,7 +6,14 @@
 
 #include <stdlib.h>
 
-hoppper_moves_auxiliary_type hoppper_moves_auxiliary[toppile+1];
+hoppper_moves_auxiliary_type *hoppper_moves_auxiliary;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hoppers_allocate_ply_tables(void)
+{
+  hoppper_moves_auxiliary = ply_allocate_table(toppile+1,sizeof hoppper_moves_auxiliary[0]);
+}
 
 /* push current move, all while remembering the current hurdle and move direction
  * @param idx_dir index into vec
@@ -16,7 +16,7 @@ typedef struct
     square sq_hurdle;
 } hoppper_moves_auxiliary_type;
 
-extern hoppper_moves_auxiliary_type hoppper_moves_auxiliary[toppile+1];
+extern hoppper_moves_auxiliary_type *hoppper_moves_auxiliary;
 
 /* push current move, all while remembering the current hurdle and move direction
  * @param idx_dir index into vec
@@ -125,4 +125,8 @@ void nonstop_orix_generate_moves(void);
 
 boolean nonstop_orix_check(validator_id evaluate);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hoppers_allocate_ply_tables(void);
+
 #endif
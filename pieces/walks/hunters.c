@@ -15,7 +15,14 @@ static unsigned int nrhuntertypes;
 
 typedef boolean (*direction_validator_type)(numecoup n);
 
-static direction_validator_type direction_validator[maxply+1];
+static direction_validator_type *direction_validator;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hunters_allocate_ply_tables(void)
+{
+  direction_validator = ply_allocate_table(maxply+1,sizeof direction_validator[0]);
+}
 
 /* Look up an existing hunter type combining two specific walks
  * @param away away walk type of the hunter type we look for
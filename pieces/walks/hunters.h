@@ -48,4 +48,8 @@ boolean hunter_enforce_observer_direction(slice_index si);
  */
 void solving_initialise_hunters(slice_index root);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void hunters_allocate_ply_tables(void);
+
 #endif
@@ -15,13 +15,21 @@
 
 #include "debugging/assert.h"
 
-square en_passant_multistep_over[maxply+1];
+square *en_passant_multistep_over;
 
-unsigned int en_passant_top[maxply+1];
+unsigned int *en_passant_top;
 
 square en_passant_retro_squares[en_passant_retro_capacity];
 unsigned int en_passant_nr_retro_squares;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void en_passant_allocate_ply_tables(void)
+{
+  en_passant_multistep_over = ply_allocate_table(maxply+1,sizeof en_passant_multistep_over[0]);
+  en_passant_top = ply_allocate_table(maxply+1,sizeof en_passant_top[0]);
+}
+
 /* Determine whether the retro information concernng en passant is consistent
  * @return true iff the informatoin is consistent
  */
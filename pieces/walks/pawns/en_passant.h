@@ -9,9 +9,9 @@
 /* This module provides implements en passant captures
  */
 
-extern square en_passant_multistep_over[maxply+1];
+extern square *en_passant_multistep_over;
 
-extern unsigned int en_passant_top[maxply+1];
+extern unsigned int *en_passant_top;
 
 enum
 {
@@ -149,4 +149,8 @@ void en_passant_adjuster_solve(slice_index si);
  */
 void en_passant_initialise_solving(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void en_passant_allocate_ply_tables(void);
+
 #endif
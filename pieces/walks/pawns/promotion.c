@@ -10,16 +10,21 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-enum
-{
-  stack_size = max_nr_promotions_per_ply*maxply+1
-};
+#define stack_size (max_nr_promotions_per_ply*maxply+1)
 
 static unsigned int stack_pointer;
 
-static pieces_pawns_promotion_sequence_type promotion_stack[stack_size];
+static pieces_pawns_promotion_sequence_type *promotion_stack;
+
+move_effect_journal_index_type *promotion_horizon;
 
-move_effect_journal_index_type promotion_horizon[maxply+1];
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void promotion_allocate_ply_tables(void)
+{
+  promotion_stack = ply_allocate_table(stack_size,sizeof promotion_stack[0]);
+  promotion_horizon = ply_allocate_table(maxply+1,sizeof promotion_horizon[0]);
+}
 
 /* Order in which the slice types for promotion execution appear
  */
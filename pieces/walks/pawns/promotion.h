@@ -17,7 +17,7 @@ enum
 };
 
 /* effects up to this index have been consumed for pawn promotions */
-extern move_effect_journal_index_type promotion_horizon[maxply+1];
+extern move_effect_journal_index_type *promotion_horizon;
 
 /* Find the last square occupied by a piece since we last checked.
  * @param base index of move effects that have already been dealt with
@@ -81,4 +81,8 @@ void promotion_insert_slice_sequence(slice_index si,
                                      slice_type insertion_point,
                                      slice_inserter_contextual_type inserter);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void promotion_allocate_ply_tables(void);
+
 #endif
@@ -0,0 +1,19 @@
+#if !defined(PLATFORM_DIRECTORY_H)
+#define PLATFORM_DIRECTORY_H
+
+/* Functions for listing the contents of a directory.
+ */
+
+/* Read the names of the entries of a directory
+ * @param path path of the directory
+ * @return alphabetically sorted array of the names, terminated by 0;
+ *         0 if the directory can't be read
+ */
+char **platform_read_directory(char const *path);
+
+/* Free the names delivered by platform_read_directory()
+ * @param names return value of platform_read_directory()
+ */
+void platform_free_directory(char **names);
+
+#endif
@@ -94,3 +94,13 @@ void StopTimer(unsigned long *seconds, unsigned long *msec)
 }
 
 #endif /* !__GNUC__ */
+
+/* Read a clock suitable for measuring short durations
+ * @return number of nanoseconds since some arbitrary point in time
+ * @note the clock may be considerably less precise than a nanosecond
+ */
+unsigned long long platform_read_fine_clock(void)
+{
+  /* there are implementations with CLOCKS_PER_SEC of type double! */
+  return (unsigned long long)((double)clock()*(1.0e9/(double)CLOCKS_PER_SEC));
+}
@@ -0,0 +1,23 @@
+#include "platform/directory.h"
+
+#include <stddef.h>
+
+/* Fallback for platforms that don't support listing directories.
+ */
+
+/* Read the names of the entries of a directory
+ * @param path path of the directory
+ * @return alphabetically sorted array of the names, terminated by 0;
+ *         0 if the directory can't be read
+ */
+char **platform_read_directory(char const *path)
+{
+  return NULL;
+}
+
+/* Free the names delivered by platform_read_directory()
+ * @param names return value of platform_read_directory()
+ */
+void platform_free_directory(char **names)
+{
+}
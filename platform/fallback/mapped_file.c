@@ -0,0 +1,54 @@
+#include "platform/mapped_file.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Fallback for platforms that don't support mapping files into memory; the
+ * entire contents are read into allocated memory instead.
+ */
+
+/* Make the contents of a file available for reading
+ * @param path path of the file
+ * @param size where to store the size of the file
+ * @return address of the contents; 0 if the file can't be accessed or is empty
+ */
+void const *platform_map_file(char const *path, size_t *size)
+{
+  void *result = 0;
+  FILE * const file = fopen(path,"rb");
+
+  if (file!=0)
+  {
+    if (fseek(file,0,SEEK_END)==0)
+    {
+      long const length = ftell(file);
+      if (length>0 && fseek(file,0,SEEK_SET)==0)
+      {
+        result = malloc((size_t)length);
+        if (result!=0)
+        {
+          if (fread(result,1,(size_t)length,file)==(size_t)length)
+            *size = (size_t)length;
+          else
+          {
+            free(result);
+            result = 0;
+          }
+        }
+      }
+    }
+
+    fclose(file);
+  }
+
+  return result;
+}
+
+/* Release the contents of a file made available by platform_map_file()
+ * @param contents address returned by platform_map_file()
+ * @param size size of the file as delivered by platform_map_file()
+ */
+void platform_unmap_file(void const *contents, size_t size)
+{
+  free((void *)contents);
+}
@@ -0,0 +1,98 @@
+#include "platform/worker.h"
+#include "debugging/assert.h"
+
+/* Fallback for platforms that don't support workers; solving is done by the
+ * master process alone.
+ */
+
+/* Allocate memory to be shared between the current process and the workers
+ * that it will start.
+ * @param size number of bytes to be allocated
+ * @return address of zero-initialised memory; 0 if allocation failed
+ */
+void *platform_allocate_shared_memory(size_t size)
+{
+  return 0;
+}
+
+/* Free memory allocated by platform_allocate_shared_memory()
+ * @param mem address returned by platform_allocate_shared_memory()
+ * @param size size passed to platform_allocate_shared_memory()
+ */
+void platform_free_shared_memory(void *mem, size_t size)
+{
+}
+
+/* Start a worker
+ * @param output file to redirect the worker's standard output to
+ * @return see platform_worker_start_result
+ * @note stdout should be flushed before invokation
+ */
+platform_worker_start_result platform_start_worker(FILE *output)
+{
+  return platform_worker_start_failed;
+}
+
+/* Wait for all workers started by the current process to terminate
+ * @return true iff all workers have terminated regularly
+ */
+boolean platform_wait_for_workers(void)
+{
+  return true;
+}
+
+/* Wait for any one of the workers started by the current process to terminate
+ * @return false iff there is no worker left to wait for
+ */
+boolean platform_wait_for_any_worker(void)
+{
+  return false;
+}
+
+/* Redirect the standard output and standard error of the current process
+ * to a file, e.g. for writing them in a particular order with the output of
+ * workers later
+ * @param output file to redirect to; 0 to undo the redirection
+ * @return true iff the redirection has succeeded
+ */
+boolean platform_redirect_output(FILE *output)
+{
+  return output==0;
+}
+
+/* Terminate the current worker after flushing its output
+ * @note doesn't return
+ */
+void platform_end_worker(void)
+{
+  assert(0);
+}
+
+/* Determine the current position in the worker's output
+ * @return number of bytes written to the worker's output so far
+ */
+long platform_worker_output_position(void)
+{
+  assert(0);
+  return 0;
+}
+
+/* Atomically set a flag in shared memory
+ * @param flag address of the flag
+ * @return true iff the flag wasn't set before, i.e. iff the caller has set it
+ */
+boolean platform_test_and_set_shared_flag(int volatile *flag)
+{
+  assert(0);
+  return false;
+}
+
+/* Atomically increment a counter in shared memory
+ * @param counter address of the counter
+ * @return the value of the counter after the increment
+ */
+unsigned long platform_increment_shared_counter(unsigned long volatile *counter)
+{
+  assert(0);
+  return 0;
+}
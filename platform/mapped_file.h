@@ -0,0 +1,25 @@
+#if !defined(PLATFORM_MAPPED_FILE_H)
+#define PLATFORM_MAPPED_FILE_H
+
+#include <stddef.h>
+
+/* Functions for accessing the contents of a file as memory.
+ * Platforms that support it map the file into the address space, so that
+ * only the parts of the file that are actually accessed are read from disk;
+ * the other platforms read the entire file into allocated memory.
+ */
+
+/* Make the contents of a file available for reading
+ * @param path path of the file
+ * @param size where to store the size of the file
+ * @return address of the contents; 0 if the file can't be accessed or is empty
+ */
+void const *platform_map_file(char const *path, size_t *size);
+
+/* Release the contents of a file made available by platform_map_file()
+ * @param contents address returned by platform_map_file()
+ * @param size size of the file as delivered by platform_map_file()
+ */
+void platform_unmap_file(void const *contents, size_t size);
+
+#endif
@@ -18,6 +18,10 @@ maxmem_kilos_type const nothing_requested = ULONG_MAX;
  */
 static maxmem_kilos_type amountMemoryRequested = ULONG_MAX;
 
+/* Amount of memory requested when the memory was allocated
+ */
+static maxmem_kilos_type amountMemoryDimensioned = ULONG_MAX;
+
 /* Amount of memory actually allocated
  */
 static maxmem_kilos_type amountMemoryAllocated;
@@ -30,6 +34,15 @@ void platform_request_memory(maxmem_kilos_type requested)
   amountMemoryRequested = requested;
 }
 
+/* Retrieve the amount of memory requested
+ * @return number of kilo-bytes requested; nothing_requested if there was no
+ *         request
+ */
+maxmem_kilos_type platform_get_requested_memory(void)
+{
+  return amountMemoryRequested;
+}
+
 /* Allocate memory for the hash table, based on the -maxmem command
  * line value (if any) and information retrieved from the operating
  * system.
@@ -40,6 +53,8 @@ static boolean dimensionHashtable(void)
 {
   boolean result = true;
 
+  amountMemoryDimensioned = amountMemoryRequested;
+
   if (amountMemoryRequested==nothing_requested)
   {
     maxmem_kilos_type amountMemoryGuessed = platform_guess_reasonable_maxmemory();
@@ -62,6 +77,19 @@ void hashtable_dimensioner_solve(slice_index si)
     puts("Couldn't allocate the requested amount of memory");
 }
 
+/* Allocate the hash table memory again if a different amount of memory has
+ * been requested since it was last allocated
+ * @return false iff the requested amount of memory can't be allocated
+ */
+boolean platform_redimension_hashtable(void)
+{
+  if (amountMemoryRequested==amountMemoryDimensioned)
+    return amountMemoryRequested==nothing_requested
+           || amountMemoryAllocated>=amountMemoryRequested;
+  else
+    return dimensionHashtable();
+}
+
 /* Retrieve amount of memory actually allocated
  * @return amount
  */
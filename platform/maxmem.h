@@ -22,6 +22,18 @@ unsigned long platform_guess_reasonable_maxmemory(void);
  */
 void platform_request_memory(maxmem_kilos_type requested);
 
+/* Retrieve the amount of memory requested
+ * @return number of kilo-bytes requested; nothing_requested if there was no
+ *         request
+ */
+maxmem_kilos_type platform_get_requested_memory(void);
+
+/* Allocate the hash table memory again if a different amount of memory has
+ * been requested since it was last allocated
+ * @return false iff the requested amount of memory can't be allocated
+ */
+boolean platform_redimension_hashtable(void);
+
 void hashtable_dimensioner_solve(slice_index si);
 
 /* Retrieve amount of memory actually allocated
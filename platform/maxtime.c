@@ -75,6 +75,14 @@ void platform_set_commandline_maxtime(maxtime_type commandlineValue)
   maxTimeCommandLine = commandlineValue;
 }
 
+/* Retrieve the value of the -maxtime command line parameter
+ * @return the value; 0 if none was given
+ */
+maxtime_type platform_get_commandline_maxtime(void)
+{
+  return maxTimeCommandLine;
+}
+
 /* Reset the value of the maxtime option.
  * To be called whenever the value set with option maxtime becomes obsolete.
  */
@@ -11,6 +11,11 @@ typedef unsigned int maxtime_type;
  */
 void platform_set_commandline_maxtime(maxtime_type commandlineValue);
 
+/* Retrieve the value of the -maxtime command line parameter
+ * @return the value; 0 if none was given
+ */
+maxtime_type platform_get_commandline_maxtime(void);
+
 /* Reset the value of the maxtime option.
  * To be called whenever the value set with option maxtime becomes obsolete.
  */
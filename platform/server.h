@@ -0,0 +1,50 @@
+#if !defined(PLATFORM_SERVER_H)
+#define PLATFORM_SERVER_H
+
+#include "utilities/boolean.h"
+
+#include <stdio.h>
+
+/* Functions for the communication of a long-lived solving server with its
+ * clients (cf. input/server.h).
+ * Requests are either read from standard input (and the results written to
+ * standard output) or from connections to a Unix domain socket. While a
+ * request is being solved, whatever is written to standard output is captured
+ * so that it can be sent to the client as the result of the request.
+ * Platforms that don't support serving fail to open the channel.
+ */
+
+/* Open the channel over which requests are received
+ * @param socket_path path of the Unix domain socket to listen at; 0 for
+ *                    reading requests from standard input
+ * @return true iff the channel could be opened
+ */
+boolean platform_server_open(char const *socket_path);
+
+/* Close the channel opened by platform_server_open()
+ */
+void platform_server_close(void);
+
+/* Wait for the next client
+ * @param requests where to store the stream to read the client's requests from
+ * @param results where to store the stream to write the results to
+ * @return false iff there won't be any more clients
+ */
+boolean platform_server_accept(FILE **requests, FILE **results);
+
+/* Terminate the communication with the client accepted last
+ */
+void platform_server_hang_up(void);
+
+/* Start capturing what is written to standard output
+ * @return true iff capturing could be started
+ */
+boolean platform_server_start_capturing(void);
+
+/* Stop capturing what is written to standard output
+ * @return temporary file holding the captured output, positioned at its
+ *         beginning; to be closed with platform_close_tmpfile()
+ */
+FILE *platform_server_stop_capturing(void);
+
+#endif
@@ -29,6 +29,12 @@ void StartTimer(void);
  */
 void StopTimer(unsigned long *seconds, unsigned long *msec);
 
+/* Read a clock suitable for measuring short durations
+ * @return number of nanoseconds since some arbitrary point in time
+ * @note the clock may be considerably less precise than a nanosecond
+ */
+unsigned long long platform_read_fine_clock(void);
+
 void timer_starter_solve(slice_index si);
 
 #endif /* PYTIME_H */
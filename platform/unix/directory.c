@@ -0,0 +1,89 @@
+#include "platform/directory.h"
+
+#include <sys/types.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int compare_names(void const *a, void const *b)
+{
+  char const * const *name_a = a;
+  char const * const *name_b = b;
+  return strcmp(*name_a,*name_b);
+}
+
+/* Read the names of the entries of a directory
+ * @param path path of the directory
+ * @return alphabetically sorted array of the names, terminated by 0;
+ *         0 if the directory can't be read
+ */
+char **platform_read_directory(char const *path)
+{
+  DIR * const dir = opendir(path);
+  char **result = 0;
+
+  if (dir!=0)
+  {
+    size_t nr_names = 0;
+    size_t capacity = 16;
+    struct dirent *entry;
+
+    result = malloc(capacity*sizeof result[0]);
+
+    while (result!=0 && (entry = readdir(dir))!=0)
+    {
+      char * const name = malloc(strlen(entry->d_name)+1);
+      if (name==0)
+      {
+        result[nr_names] = 0;
+        platform_free_directory(result);
+        result = 0;
+      }
+      else
+      {
+        strcpy(name,entry->d_name);
+        result[nr_names++] = name;
+
+        /* keep room for the terminating 0 */
+        if (nr_names+1==capacity)
+        {
+          char ** const enlarged = realloc(result,2*capacity*sizeof result[0]);
+          if (enlarged==0)
+          {
+            result[nr_names] = 0;
+            platform_free_directory(result);
+            result = 0;
+          }
+          else
+          {
+            result = enlarged;
+            capacity *= 2;
+          }
+        }
+      }
+    }
+
+    if (result!=0)
+    {
+      result[nr_names] = 0;
+      qsort(result,nr_names,sizeof result[0],&compare_names);
+    }
+
+    closedir(dir);
+  }
+
+  return result;
+}
+
+/* Free the names delivered by platform_read_directory()
+ * @param names return value of platform_read_directory()
+ */
+void platform_free_directory(char **names)
+{
+  char **name;
+
+  for (name = names; *name!=0; ++name)
+    free(*name);
+
+  free(names);
+}
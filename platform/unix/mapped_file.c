@@ -0,0 +1,45 @@
+#include "platform/mapped_file.h"
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/* Make the contents of a file available for reading
+ * @param path path of the file
+ * @param size where to store the size of the file
+ * @return address of the contents; 0 if the file can't be accessed or is empty
+ */
+void const *platform_map_file(char const *path, size_t *size)
+{
+  void *result = 0;
+  int const fd = open(path,O_RDONLY);
+
+  if (fd>=0)
+  {
+    struct stat st;
+    if (fstat(fd,&st)==0 && st.st_size>0)
+    {
+      result = mmap(0,(size_t)st.st_size,PROT_READ,MAP_SHARED,fd,0);
+      if (result==MAP_FAILED)
+        result = 0;
+      else
+        *size = (size_t)st.st_size;
+    }
+
+    /* the mapping remains valid after the file is closed */
+    close(fd);
+  }
+
+  return result;
+}
+
+/* Release the contents of a file made available by platform_map_file()
+ * @param contents address returned by platform_map_file()
+ * @param size size of the file as delivered by platform_map_file()
+ */
+void platform_unmap_file(void const *contents, size_t size)
+{
+  munmap((void *)contents,size);
+}
@@ -1,3 +1,7 @@
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* for clock_gettime() */
+#endif
+
 #include "platform/timer.h"
 #include <time.h>
 
@@ -28,3 +32,19 @@ void StopTimer(unsigned long *seconds, unsigned long *msec)
 
   *seconds = (unsigned long)(stopTime-startTime);
 }
+
+/* Read a clock suitable for measuring short durations
+ * @return number of nanoseconds since some arbitrary point in time
+ * @note the clock may be considerably less precise than a nanosecond
+ */
+unsigned long long platform_read_fine_clock(void)
+{
+#if defined(CLOCK_MONOTONIC)
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC,&now);
+  return (unsigned long long)now.tv_sec*1000000000ULL + (unsigned long long)now.tv_nsec;
+#else
+  /* there are implementations with CLOCKS_PER_SEC of type double! */
+  return (unsigned long long)((double)clock()*(1.0e9/(double)CLOCKS_PER_SEC));
+#endif
+}
@@ -0,0 +1,243 @@
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* for fileno(), fdopen() and the socket interface */
+#endif
+
+#include "platform/server.h"
+#include "platform/tmpfile.h"
+#include "debugging/assert.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <errno.h>
+#include <signal.h>
+#include <string.h>
+
+static char const *listening_path;
+static int listening_socket = -1;
+
+/* when serving standard input: has the one and only "client" been accepted? */
+static boolean is_stdin_accepted;
+
+/* when serving standard input: file descriptor of the original standard
+ * output; standard output itself is redirected to standard error so that
+ * nothing but results reaches the client */
+static int original_stdout = -1;
+
+static FILE *client_requests;
+static FILE *client_results;
+
+static FILE *capture;
+static int uncaptured_stdout = -1;
+
+static boolean open_socket(char const *socket_path)
+{
+  struct sockaddr_un address;
+  struct stat status;
+
+  if (strlen(socket_path)>=sizeof address.sun_path)
+  {
+    fprintf(stderr,"socket path too long: %s\n",socket_path);
+    return false;
+  }
+
+  /* remove the socket left behind by a previous server, but nothing else */
+  if (stat(socket_path,&status)==0 && S_ISSOCK(status.st_mode))
+    unlink(socket_path);
+
+  listening_socket = socket(AF_UNIX,SOCK_STREAM,0);
+  if (listening_socket<0)
+  {
+    perror(__func__);
+    return false;
+  }
+
+  memset(&address,0,sizeof address);
+  address.sun_family = AF_UNIX;
+  strcpy(address.sun_path,socket_path);
+
+  if (bind(listening_socket,(struct sockaddr *)&address,sizeof address)!=0
+      || listen(listening_socket,SOMAXCONN)!=0)
+  {
+    perror(socket_path);
+    close(listening_socket);
+    listening_socket = -1;
+    return false;
+  }
+
+  /* a client that hangs up early mustn't take the server down */
+  signal(SIGPIPE,SIG_IGN);
+
+  listening_path = socket_path;
+  return true;
+}
+
+/* Open the channel over which requests are received
+ * @param socket_path path of the Unix domain socket to listen at; 0 for
+ *                    reading requests from standard input
+ * @return true iff the channel could be opened
+ */
+boolean platform_server_open(char const *socket_path)
+{
+  if (socket_path==0)
+  {
+    fflush(stdout);
+    original_stdout = dup(STDOUT_FILENO);
+    if (original_stdout<0 || dup2(STDERR_FILENO,STDOUT_FILENO)<0)
+    {
+      perror(__func__);
+      return false;
+    }
+    else
+    {
+      is_stdin_accepted = false;
+      return true;
+    }
+  }
+  else
+    return open_socket(socket_path);
+}
+
+/* Close the channel opened by platform_server_open()
+ */
+void platform_server_close(void)
+{
+  if (listening_socket>=0)
+  {
+    close(listening_socket);
+    listening_socket = -1;
+    unlink(listening_path);
+  }
+
+  if (original_stdout>=0)
+  {
+    fflush(stdout);
+    dup2(original_stdout,STDOUT_FILENO);
+    close(original_stdout);
+    original_stdout = -1;
+  }
+}
+
+/* Wait for the next client
+ * @param requests where to store the stream to read the client's requests from
+ * @param results where to store the stream to write the results to
+ * @return false iff there won't be any more clients
+ */
+boolean platform_server_accept(FILE **requests, FILE **results)
+{
+  int requests_descriptor;
+  int results_descriptor;
+
+  assert(client_requests==0);
+  assert(client_results==0);
+
+  if (listening_socket<0)
+  {
+    if (is_stdin_accepted)
+      return false;
+
+    is_stdin_accepted = true;
+    requests_descriptor = dup(STDIN_FILENO);
+    results_descriptor = dup(original_stdout);
+  }
+  else
+  {
+    do
+    {
+      requests_descriptor = accept(listening_socket,0,0);
+    } while (requests_descriptor<0 && errno==EINTR);
+
+    results_descriptor = requests_descriptor<0 ? -1 : dup(requests_descriptor);
+  }
+
+  if (requests_descriptor>=0)
+    client_requests = fdopen(requests_descriptor,"r");
+  if (results_descriptor>=0)
+    client_results = fdopen(results_descriptor,"w");
+
+  if (client_requests==0 || client_results==0)
+  {
+    perror(__func__);
+    if (client_requests==0 && requests_descriptor>=0)
+      close(requests_descriptor);
+    if (client_results==0 && results_descriptor>=0)
+      close(results_descriptor);
+    platform_server_hang_up();
+    return false;
+  }
+  else
+  {
+    *requests = client_requests;
+    *results = client_results;
+    return true;
+  }
+}
+
+/* Terminate the communication with the client accepted last
+ */
+void platform_server_hang_up(void)
+{
+  if (client_requests!=0)
+  {
+    fclose(client_requests);
+    client_requests = 0;
+  }
+
+  if (client_results!=0)
+  {
+    fclose(client_results);
+    client_results = 0;
+  }
+}
+
+/* Start capturing what is written to standard output
+ * @return true iff capturing could be started
+ */
+boolean platform_server_start_capturing(void)
+{
+  assert(capture==0);
+
+  fflush(stdout);
+
+  capture = platform_open_tmpfile();
+  if (capture==0)
+    return false;
+
+  uncaptured_stdout = dup(STDOUT_FILENO);
+  if (uncaptured_stdout<0 || dup2(fileno(capture),STDOUT_FILENO)<0)
+  {
+    perror(__func__);
+    if (uncaptured_stdout>=0)
+      close(uncaptured_stdout);
+    platform_close_tmpfile(capture);
+    capture = 0;
+    return false;
+  }
+
+  return true;
+}
+
+/* Stop capturing what is written to standard output
+ * @return temporary file holding the captured output, positioned at its
+ *         beginning; to be closed with platform_close_tmpfile()
+ */
+FILE *platform_server_stop_capturing(void)
+{
+  FILE * const result = capture;
+
+  assert(capture!=0);
+
+  fflush(stdout);
+  dup2(uncaptured_stdout,STDOUT_FILENO);
+  close(uncaptured_stdout);
+  uncaptured_stdout = -1;
+  capture = 0;
+
+  /* the output was written through a different stream, but the file position
+   * is shared */
+  fseek(result,0,SEEK_SET);
+
+  return result;
+}
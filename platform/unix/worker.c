@@ -0,0 +1,260 @@
+#if !defined(_DEFAULT_SOURCE)
+#define _DEFAULT_SOURCE /* for MAP_ANONYMOUS */
+#endif
+
+#include "platform/worker.h"
+#include "debugging/assert.h"
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/* workers are only supported if we can atomically access shared memory */
+#if defined(__GNUC__) && defined(MAP_ANONYMOUS)
+#define WORKERS_SUPPORTED 1
+#else
+#define WORKERS_SUPPORTED 0
+#endif
+
+enum
+{
+  max_nr_workers = 256
+};
+
+static pid_t worker_pids[max_nr_workers];
+static unsigned int nr_workers;
+
+/* Allocate memory to be shared between the current process and the workers
+ * that it will start.
+ * @param size number of bytes to be allocated
+ * @return address of zero-initialised memory; 0 if allocation failed
+ */
+void *platform_allocate_shared_memory(size_t size)
+{
+#if WORKERS_SUPPORTED
+  void * const result = mmap(0,size,
+                             PROT_READ|PROT_WRITE,MAP_SHARED|MAP_ANONYMOUS,
+                             -1,0);
+  return result==MAP_FAILED ? 0 : result;
+#else
+  return 0;
+#endif
+}
+
+/* Free memory allocated by platform_allocate_shared_memory()
+ * @param mem address returned by platform_allocate_shared_memory()
+ * @param size size passed to platform_allocate_shared_memory()
+ */
+void platform_free_shared_memory(void *mem, size_t size)
+{
+#if WORKERS_SUPPORTED
+  munmap(mem,size);
+#endif
+}
+
+/* Start a worker
+ * @param output file to redirect the worker's standard output to
+ * @return see platform_worker_start_result
+ * @note stdout should be flushed before invokation
+ */
+platform_worker_start_result platform_start_worker(FILE *output)
+{
+#if WORKERS_SUPPORTED
+  if (nr_workers<max_nr_workers)
+  {
+    /* alarms aren't inherited by child processes */
+    unsigned int const remaining_seconds = alarm(0);
+    pid_t const pid = fork();
+
+    if (remaining_seconds>0)
+      alarm(remaining_seconds);
+
+    if (pid==0)
+    {
+      nr_workers = 0;
+      if (dup2(fileno(output),STDOUT_FILENO)==-1)
+        _exit(EXIT_FAILURE);
+      else
+        return platform_worker_running;
+    }
+    else if (pid>0)
+    {
+      worker_pids[nr_workers] = pid;
+      ++nr_workers;
+      return platform_worker_started;
+    }
+  }
+#endif
+
+  return platform_worker_start_failed;
+}
+
+/* Wait for all workers started by the current process to terminate
+ * @return true iff all workers have terminated regularly
+ */
+boolean platform_wait_for_workers(void)
+{
+  boolean result = true;
+  unsigned int i;
+
+  for (i = 0; i!=nr_workers; ++i)
+  {
+    int status;
+    pid_t pid;
+
+    do
+    {
+      pid = waitpid(worker_pids[i],&status,0);
+    } while (pid==-1 && errno==EINTR);
+
+    if (pid==-1
+        || !WIFEXITED(status)
+        || WEXITSTATUS(status)!=EXIT_SUCCESS)
+      result = false;
+  }
+
+  nr_workers = 0;
+
+  return result;
+}
+
+/* Wait for any one of the workers started by the current process to terminate
+ * @return false iff there is no worker left to wait for
+ */
+boolean platform_wait_for_any_worker(void)
+{
+  while (nr_workers>0)
+  {
+    int status;
+    pid_t const pid = wait(&status);
+
+    if (pid==-1)
+    {
+      if (errno!=EINTR)
+      {
+        nr_workers = 0;
+        break;
+      }
+    }
+    else
+    {
+      unsigned int i;
+      for (i = 0; i!=nr_workers; ++i)
+        if (worker_pids[i]==pid)
+        {
+          --nr_workers;
+          worker_pids[i] = worker_pids[nr_workers];
+          return true;
+        }
+    }
+  }
+
+  return false;
+}
+
+/* Redirect the standard output and standard error of the current process
+ * to a file, e.g. for writing them in a particular order with the output of
+ * workers later
+ * @param output file to redirect to; 0 to undo the redirection
+ * @return true iff the redirection has succeeded
+ */
+boolean platform_redirect_output(FILE *output)
+{
+  static int original_stdout = -1;
+  static int original_stderr = -1;
+
+  fflush(stdout);
+  fflush(stderr);
+
+  if (output==0)
+  {
+    if (original_stdout!=-1)
+    {
+      dup2(original_stdout,STDOUT_FILENO);
+      dup2(original_stderr,STDERR_FILENO);
+      close(original_stdout);
+      close(original_stderr);
+      original_stdout = -1;
+      original_stderr = -1;
+    }
+
+    return true;
+  }
+  else
+  {
+    if (original_stdout==-1)
+    {
+      original_stdout = dup(STDOUT_FILENO);
+      original_stderr = dup(STDERR_FILENO);
+      if (original_stdout==-1 || original_stderr==-1)
+      {
+        if (original_stdout!=-1)
+          close(original_stdout);
+        if (original_stderr!=-1)
+          close(original_stderr);
+        original_stdout = -1;
+        original_stderr = -1;
+        return false;
+      }
+    }
+
+    return (dup2(fileno(output),STDOUT_FILENO)!=-1
+            && dup2(fileno(output),STDERR_FILENO)!=-1);
+  }
+}
+
+/* Terminate the current worker after flushing its output
+ * @note doesn't return
+ */
+void platform_end_worker(void)
+{
+  /* don't use exit(), which would flush the stdio buffers inherited from the
+   * master */
+  _exit(fflush(stdout)==0 ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/* Determine the current position in the worker's output
+ * @return number of bytes written to the worker's output so far
+ */
+long platform_worker_output_position(void)
+{
+  fflush(stdout);
+  return (long)lseek(STDOUT_FILENO,0,SEEK_CUR);
+}
+
+/* Atomically set a flag in shared memory
+ * @param flag address of the flag
+ * @return true iff the flag wasn't set before, i.e. iff the caller has set it
+ */
+boolean platform_test_and_set_shared_flag(int volatile *flag)
+{
+#if WORKERS_SUPPORTED
+  return __sync_bool_compare_and_swap(flag,0,1);
+#else
+  /* we never get here since no worker could be started */
+  assert(0);
+  return false;
+#endif
+}
+
+/* Atomically increment a counter in shared memory
+ * @param counter address of the counter
+ * @return the value of the counter after the increment
+ */
+unsigned long platform_increment_shared_counter(unsigned long volatile *counter)
+{
+#if WORKERS_SUPPORTED
+  return __sync_add_and_fetch(counter,1);
+#else
+  /* we never get here since no shared memory could be allocated */
+  assert(0);
+  return 0;
+#endif
+}
@@ -0,0 +1,85 @@
+#if !defined(PLATFORM_WORKER_H)
+#define PLATFORM_WORKER_H
+
+#include "utilities/boolean.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+/* Functions for running parts of the solving process in worker processes
+ * that run in parallel to each other.
+ * A worker starts as a copy of the process that started it (the "master");
+ * communication between master and workers is restricted to memory allocated
+ * with platform_allocate_shared_memory() and the workers' standard output.
+ * Platforms that don't support workers fail to start them; callers are
+ * expected to fall back to doing the work themselves.
+ */
+
+typedef enum
+{
+  platform_worker_start_failed,
+  platform_worker_started,   /* we are the master, and the worker is running */
+  platform_worker_running    /* we are the worker */
+} platform_worker_start_result;
+
+/* Allocate memory to be shared between the current process and the workers
+ * that it will start.
+ * @param size number of bytes to be allocated
+ * @return address of zero-initialised memory; 0 if allocation failed
+ */
+void *platform_allocate_shared_memory(size_t size);
+
+/* Free memory allocated by platform_allocate_shared_memory()
+ * @param mem address returned by platform_allocate_shared_memory()
+ * @param size size passed to platform_allocate_shared_memory()
+ */
+void platform_free_shared_memory(void *mem, size_t size);
+
+/* Start a worker
+ * @param output file to redirect the worker's standard output to
+ * @return see platform_worker_start_result
+ * @note stdout should be flushed before invokation
+ */
+platform_worker_start_result platform_start_worker(FILE *output);
+
+/* Wait for all workers started by the current process to terminate
+ * @return true iff all workers have terminated regularly
+ */
+boolean platform_wait_for_workers(void);
+
+/* Wait for any one of the workers started by the current process to terminate
+ * @return false iff there is no worker left to wait for
+ */
+boolean platform_wait_for_any_worker(void);
+
+/* Redirect the standard output and standard error of the current process
+ * to a file, e.g. for writing them in a particular order with the output of
+ * workers later
+ * @param output file to redirect to; 0 to undo the redirection
+ * @return true iff the redirection has succeeded
+ */
+boolean platform_redirect_output(FILE *output);
+
+/* Terminate the current worker after flushing its output
+ * @note doesn't return
+ */
+void platform_end_worker(void);
+
+/* Determine the current position in the worker's output
+ * @return number of bytes written to the worker's output so far
+ */
+long platform_worker_output_position(void);
+
+/* Atomically set a flag in shared memory
+ * @param flag address of the flag
+ * @return true iff the flag wasn't set before, i.e. iff the caller has set it
+ */
+boolean platform_test_and_set_shared_flag(int volatile *flag);
+
+/* Atomically increment a counter in shared memory
+ * @param counter address of the counter
+ * @return the value of the counter after the increment
+ */
+unsigned long platform_increment_shared_counter(unsigned long volatile *counter);
+
+#endif
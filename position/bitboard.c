@@ -0,0 +1,135 @@
+#include "position/bitboard.h"
+#include "debugging/assert.h"
+
+bitboard_type bitboard_rays[nr_bitboard_rays][nr_squares_on_board];
+bitboard_type bitboard_king_steps[nr_squares_on_board];
+bitboard_type bitboard_knight_leaps[nr_squares_on_board];
+
+static numvec const ray_directions[nr_bitboard_rays] = {
+  dir_up,
+  dir_right,
+  dir_up+dir_left,
+  dir_up+dir_right,
+  dir_down,
+  dir_left,
+  dir_down+dir_right,
+  dir_down+dir_left
+};
+
+#if !defined(__GNUC__)
+
+/* Determine the index of the lowest set bit of a bitboard
+ * @param bb bitboard; must not be 0
+ * @return index
+ */
+unsigned int bitboard_lowest_index(bitboard_type bb)
+{
+  unsigned int result = 0;
+
+  assert(bb!=0);
+
+  while ((bb&0xffffffffULL)==0)
+  {
+    bb >>= 32;
+    result += 32;
+  }
+  while ((bb&1)==0)
+  {
+    bb >>= 1;
+    ++result;
+  }
+
+  return result;
+}
+
+/* Determine the index of the highest set bit of a bitboard
+ * @param bb bitboard; must not be 0
+ * @return index
+ */
+unsigned int bitboard_highest_index(bitboard_type bb)
+{
+  unsigned int result = 63;
+
+  assert(bb!=0);
+
+  while ((bb&0xffffffff00000000ULL)==0)
+  {
+    bb <<= 32;
+    result -= 32;
+  }
+  while ((bb&0x8000000000000000ULL)==0)
+  {
+    bb <<= 1;
+    --result;
+  }
+
+  return result;
+}
+
+#endif
+
+/* Find the first occupied square on a ray
+ * @param index bit index of the start square of the ray
+ * @param ray identifies the ray
+ * @return the first occupied square; initsquare if the ray leaves the board
+ */
+square bitboard_find_end_of_line(unsigned int index, bitboard_ray_type ray)
+{
+  bitboard_type const blockers = (bitboard_rays[ray][index]
+                                  & being_solved_bitboards.occupied);
+
+  if (blockers==0)
+    return initsquare;
+  else if (ray<bitboard_ray_down)
+    return bitboard_square_of_index(bitboard_lowest_index(blockers));
+  else
+    return bitboard_square_of_index(bitboard_highest_index(blockers));
+}
+
+static bitboard_type calc_leaps(square from,
+                                vec_index_type start, vec_index_type end)
+{
+  bitboard_type result = 0;
+  vec_index_type k;
+
+  for (k = start; k<=end; ++k)
+  {
+    square const to = from+vec[k];
+    if (is_on_board(to))
+      result |= 1ULL<<bitboard_index_of_square(to);
+  }
+
+  return result;
+}
+
+static bitboard_type calc_ray(square from, numvec dir)
+{
+  bitboard_type result = 0;
+  square to;
+
+  for (to = from+dir; is_on_board(to); to += dir)
+    result |= 1ULL<<bitboard_index_of_square(to);
+
+  return result;
+}
+
+/* Initialise the module
+ */
+void bitboard_initialise(void)
+{
+  unsigned int i;
+
+  for (i = 0; i!=nr_squares_on_board; ++i)
+  {
+    square const from = bitboard_square_of_index(i);
+    bitboard_ray_type ray;
+
+    assert(bitboard_index_of_square(from)==i);
+
+    bitboard_king_steps[i] = calc_leaps(from,vec_queen_start,vec_queen_end);
+    bitboard_knight_leaps[i] = calc_leaps(from,vec_knight_start,vec_knight_end);
+
+    for (ray = 0; ray!=nr_bitboard_rays; ++ray)
+      bitboard_rays[ray][i] = calc_ray(from,ray_directions[ray]);
+  }
+}
@@ -0,0 +1,69 @@
+#if !defined(POSITION_BITBOARD_H)
+#define POSITION_BITBOARD_H
+
+#include "position/position.h"
+
+/* This module provides the geometry for working with the bitboards of
+ * being_solved (cf. being_solved_bitboards in position.h): the squares
+ * reached by the orthodox leapers and the rays of the orthodox riders.
+ *
+ * The end of a line is found by masking the ray with the occupied squares and
+ * scanning for the occupied square nearest to the start square.
+ */
+
+typedef enum
+{
+  /* rays along which the bit indices increase */
+  bitboard_ray_up,
+  bitboard_ray_right,
+  bitboard_ray_up_left,
+  bitboard_ray_up_right,
+
+  /* rays along which the bit indices decrease */
+  bitboard_ray_down,
+  bitboard_ray_left,
+  bitboard_ray_down_right,
+  bitboard_ray_down_left,
+
+  nr_bitboard_rays
+} bitboard_ray_type;
+
+extern bitboard_type bitboard_rays[nr_bitboard_rays][nr_squares_on_board];
+extern bitboard_type bitboard_king_steps[nr_squares_on_board];
+extern bitboard_type bitboard_knight_leaps[nr_squares_on_board];
+
+#if defined(__GNUC__)
+#define bitboard_lowest_index(bb) ((unsigned int)__builtin_ctzll(bb))
+#define bitboard_highest_index(bb) (63u-(unsigned int)__builtin_clzll(bb))
+#else
+/* Determine the index of the lowest set bit of a bitboard
+ * @param bb bitboard; must not be 0
+ * @return index
+ */
+unsigned int bitboard_lowest_index(bitboard_type bb);
+
+/* Determine the index of the highest set bit of a bitboard
+ * @param bb bitboard; must not be 0
+ * @return index
+ */
+unsigned int bitboard_highest_index(bitboard_type bb);
+#endif
+
+/* Determine the square corresponding to a bit index
+ * @param index bit index
+ * @return square
+ */
+#define bitboard_square_of_index(index) (boardnum[(index)])
+
+/* Find the first occupied square on a ray
+ * @param index bit index of the start square of the ray
+ * @param ray identifies the ray
+ * @return the first occupied square; initsquare if the ray leaves the board
+ */
+square bitboard_find_end_of_line(unsigned int index, bitboard_ray_type ray);
+
+/* Initialise the module
+ */
+void bitboard_initialise(void);
+
+#endif
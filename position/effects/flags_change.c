@@ -28,7 +28,7 @@ void move_effect_journal_do_flags_change(move_effect_reason_type reason,
   if (TSTFLAG(being_solved.spec[on],Black))
     --being_solved.number_of_pieces[Black][get_walk_of_piece_on_square(on)];
 
-  being_solved.spec[on] = to;
+  replace_flags(on,to);
 
   if (TSTFLAG(being_solved.spec[on],White))
     ++being_solved.number_of_pieces[White][get_walk_of_piece_on_square(on)];
@@ -61,7 +61,7 @@ static void undo_flags_change(move_effect_journal_entry_type const *entry)
   if (TSTFLAG(being_solved.spec[on],Black))
     --being_solved.number_of_pieces[Black][get_walk_of_piece_on_square(on)];
 
-  being_solved.spec[on] = from;
+  replace_flags(on,from);
 
   if (TSTFLAG(being_solved.spec[on],White))
     ++being_solved.number_of_pieces[White][get_walk_of_piece_on_square(on)];
@@ -94,7 +94,7 @@ static void redo_flags_change(move_effect_journal_entry_type const *entry)
   if (TSTFLAG(being_solved.spec[on],Black))
     --being_solved.number_of_pieces[Black][get_walk_of_piece_on_square(on)];
 
-  being_solved.spec[on] = to;
+  replace_flags(on,to);
 
   if (TSTFLAG(being_solved.spec[on],White))
     ++being_solved.number_of_pieces[White][get_walk_of_piece_on_square(on)];
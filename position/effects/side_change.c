@@ -23,8 +23,11 @@ void move_effect_journal_do_side_change(move_effect_reason_type reason, square o
   entry->u.side_change.to = to;
 
   --being_solved.number_of_pieces[advers(to)][get_walk_of_piece_on_square(on)];
-  piece_change_side(&being_solved.spec[on]);
-  occupy_square(on,get_walk_of_piece_on_square(on),being_solved.spec[on]);
+  {
+    Flags spec = being_solved.spec[on];
+    piece_change_side(&spec);
+    replace_flags(on,spec);
+  }
   ++being_solved.number_of_pieces[to][get_walk_of_piece_on_square(on)];
 
   TraceFunctionExit(__func__);
@@ -40,8 +43,11 @@ static void undo_side_change(move_effect_journal_entry_type const *entry)
   TraceFunctionParamListEnd();
 
   --being_solved.number_of_pieces[advers(from)][get_walk_of_piece_on_square(on)];
-  piece_change_side(&being_solved.spec[on]);
-  occupy_square(on,get_walk_of_piece_on_square(on),being_solved.spec[on]);
+  {
+    Flags spec = being_solved.spec[on];
+    piece_change_side(&spec);
+    replace_flags(on,spec);
+  }
   ++being_solved.number_of_pieces[from][get_walk_of_piece_on_square(on)];
 
   TraceFunctionExit(__func__);
@@ -57,8 +63,11 @@ static void redo_side_change(move_effect_journal_entry_type const *entry)
   TraceFunctionParamListEnd();
 
   --being_solved.number_of_pieces[advers(to)][get_walk_of_piece_on_square(on)];
-  piece_change_side(&being_solved.spec[on]);
-  occupy_square(on,get_walk_of_piece_on_square(on),being_solved.spec[on]);
+  {
+    Flags spec = being_solved.spec[on];
+    piece_change_side(&spec);
+    replace_flags(on,spec);
+  }
   ++being_solved.number_of_pieces[to][get_walk_of_piece_on_square(on)];
 
   TraceFunctionExit(__func__);
@@ -18,9 +18,10 @@ static void do_total_side_exchange(void)
         Side const to = TSTFLAG(being_solved.spec[*bnp],White) ? Black : White;
         if (!TSTFLAG(being_solved.spec[*bnp],to))
         {
+          Flags spec = being_solved.spec[*bnp];
           --being_solved.number_of_pieces[advers(to)][get_walk_of_piece_on_square(*bnp)];
-          piece_change_side(&being_solved.spec[*bnp]);
-          occupy_square(*bnp,get_walk_of_piece_on_square(*bnp),being_solved.spec[*bnp]);
+          piece_change_side(&spec);
+          replace_flags(*bnp,spec);
           ++being_solved.number_of_pieces[to][get_walk_of_piece_on_square(*bnp)];
         }
       }
@@ -3,11 +3,20 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
+#include <string.h>
+
 boolean areColorsSwapped;
 boolean isBoardReflected;
 
 position being_solved;
 
+zobrist_key_type zobrist_key;
+
+board_bitboards_type being_solved_bitboards;
+
+static boolean is_zobrist_key_maintained;
+static Flags zobrist_relevant_flags;
+
 /* This is the InitialGameArray */
 piece_walk_type const PAS[nr_squares_on_board] = {
   Rook, Knight, Bishop, Queen, King,  Bishop,  Knight,  Rook,
@@ -121,6 +130,8 @@ void swap_sides(void)
     }
   }
 
+  recalculate_derived_board_data();
+
   areColorsSwapped = !areColorsSwapped;
 }
 
@@ -155,6 +166,8 @@ void reflect_position(void)
 
   swap_castling_rights();
 
+  recalculate_derived_board_data();
+
   isBoardReflected = !isBoardReflected;
 }
 
@@ -166,8 +179,169 @@ void piece_change_side(Flags *spec)
   *spec ^= BIT(Black)|BIT(White);
 }
 
+/* Calculate the contribution of a piece to the Zobrist key.
+ * Instead of looking up a table of random numbers, we calculate a
+ * pseudo-random number from the piece; the calculation is a bijection, so
+ * different pieces contribute different numbers.
+ * @param s position of the piece
+ * @param walk walk of the piece
+ * @param flags flags of the piece
+ * @return contribution
+ */
+static zobrist_key_type zobrist_contribution(square s,
+                                             piece_walk_type walk,
+                                             Flags flags)
+{
+  if (walk==Empty || !is_on_board(s))
+    return 0;
+  else
+  {
+    /* finaliser of SplitMix64 */
+    zobrist_key_type result = (((zobrist_key_type)s<<48)
+                               ^ ((zobrist_key_type)walk<<32)
+                               ^ (flags&zobrist_relevant_flags));
+    result = (result ^ (result>>30)) * 0xbf58476d1ce4e5b9ULL;
+    result = (result ^ (result>>27)) * 0x94d049bb133111ebULL;
+    return result ^ (result>>31);
+  }
+}
+
+static void update_zobrist_key(square s, piece_walk_type walk, Flags flags)
+{
+  if (is_zobrist_key_maintained)
+  {
+    zobrist_key ^= zobrist_contribution(s,
+                                        get_walk_of_piece_on_square(s),
+                                        being_solved.spec[s]);
+    zobrist_key ^= zobrist_contribution(s,walk,flags);
+  }
+}
+
+/* Start keeping zobrist_key up to date
+ * @param relevant_flags mask of the flags taken into account by zobrist_key
+ */
+void start_maintaining_zobrist_key(Flags relevant_flags)
+{
+  /* the calculation of the contributions relies on this */
+  assert(relevant_flags<=0xffffffffUL);
+  zobrist_relevant_flags = relevant_flags;
+  zobrist_key = calculate_zobrist_key();
+  is_zobrist_key_maintained = true;
+}
+
+/* Stop keeping zobrist_key up to date
+ */
+void stop_maintaining_zobrist_key(void)
+{
+  is_zobrist_key_maintained = false;
+}
+
+/* Calculate the Zobrist key of the board of being_solved from scratch
+ * @return the key
+ */
+zobrist_key_type calculate_zobrist_key(void)
+{
+  zobrist_key_type result = 0;
+  square const *bnp;
+
+  for (bnp = boardnum; *bnp; bnp++)
+    result ^= zobrist_contribution(*bnp,
+                                   get_walk_of_piece_on_square(*bnp),
+                                   being_solved.spec[*bnp]);
+
+  return result;
+}
+
+/* Is zobrist_key consistent with the board of being_solved?
+ * Code that modifies the board without using the functions above (e.g. to
+ * temporarily change a flag) should assert this once it has restored the board.
+ * @return true iff zobrist_key is up to date or isn't being maintained
+ */
+boolean is_zobrist_key_in_sync(void)
+{
+  return !is_zobrist_key_maintained || zobrist_key==calculate_zobrist_key();
+}
+
+/* Update the bitboards of being_solved before a square changes its walk
+ * @param s the square
+ * @param walk the new walk
+ */
+void update_board_bitboards(square s, piece_walk_type walk)
+{
+  if (is_on_board(s))
+  {
+    bitboard_type const bit = 1ULL<<bitboard_index_of_square(s);
+
+    being_solved_bitboards.by_walk[get_walk_of_piece_on_square(s)] &= ~bit;
+    being_solved_bitboards.by_walk[walk] |= bit;
+
+    if (walk==Empty)
+      being_solved_bitboards.occupied &= ~bit;
+    else
+      being_solved_bitboards.occupied |= bit;
+  }
+}
+
+static void calculate_bitboards(board_bitboards_type *bitboards)
+{
+  square const *bnp;
+
+  memset(bitboards,0,sizeof *bitboards);
+
+  for (bnp = boardnum; *bnp; bnp++)
+  {
+    piece_walk_type const walk = get_walk_of_piece_on_square(*bnp);
+    bitboard_type const bit = 1ULL<<bitboard_index_of_square(*bnp);
+
+    if (walk!=Empty)
+    {
+      bitboards->by_walk[walk] |= bit;
+      bitboards->occupied |= bit;
+    }
+  }
+}
+
+/* Calculate the bitboards of being_solved from scratch
+ */
+void calculate_board_bitboards(void)
+{
+  calculate_bitboards(&being_solved_bitboards);
+}
+
+/* Determine whether the bitboards of being_solved reflect the board
+ * @return true iff they do
+ */
+boolean are_board_bitboards_up_to_date(void)
+{
+  board_bitboards_type expected;
+  piece_walk_type walk;
+
+  calculate_bitboards(&expected);
+
+  if (expected.occupied!=being_solved_bitboards.occupied)
+    return false;
+
+  for (walk = Invalid; walk!=nr_piece_walks; ++walk)
+    if (expected.by_walk[walk]!=being_solved_bitboards.by_walk[walk])
+      return false;
+
+  return true;
+}
+
+/* Bring what is derived from the board of being_solved (bitboards, Zobrist
+ * key) up to date after being_solved has been assigned as a whole
+ */
+void recalculate_derived_board_data(void)
+{
+  calculate_board_bitboards();
+
+  if (is_zobrist_key_maintained)
+    zobrist_key = calculate_zobrist_key();
+}
+
 void empty_square(square s)
 {
+  update_zobrist_key(s,Empty,EmptySpec);
   set_walk_of_piece_on_square(s, Empty);
   being_solved.spec[s] = EmptySpec;
 }
@@ -179,6 +353,7 @@ void occupy_square(square s, piece_walk_type walk, Flags flags)
   // TODO why don't these hold?
 //  assert(get_walk_of_piece_on_square(s)==Empty);
 //  assert(being_solved.spec[s]==EmptySpec);
+  update_zobrist_key(s,walk,flags);
   set_walk_of_piece_on_square(s, walk);
   being_solved.spec[s] = flags;
 }
@@ -187,12 +362,20 @@ void replace_walk(square s, piece_walk_type walk)
 {
   assert(walk!=Empty);
   assert(walk!=Invalid);
+  update_zobrist_key(s,walk,being_solved.spec[s]);
   set_walk_of_piece_on_square(s, walk);
 }
 
+void replace_flags(square s, Flags flags)
+{
+  update_zobrist_key(s,get_walk_of_piece_on_square(s),flags);
+  being_solved.spec[s] = flags;
+}
+
 void block_square(square s)
 {
   assert(is_square_empty(s) || is_square_blocked(s));
+  update_zobrist_key(s,Invalid,BorderSpec);
   set_walk_of_piece_on_square(s, Invalid);
   being_solved.spec[s] = BorderSpec;
 }
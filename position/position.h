@@ -54,6 +54,35 @@ typedef struct position
 
 extern position being_solved;
 
+/* Zobrist key of the board of being_solved, i.e. of the walks and the relevant
+ * flags of the pieces on the board; kept up to date by the functions below
+ * that modify the board while hashing needs it
+ */
+typedef unsigned long long zobrist_key_type;
+
+extern zobrist_key_type zobrist_key;
+
+/* Bitboards of the board of being_solved. Bit nr_files_on_board*row+file
+ * stands for the square in row row and file file (a1 being bit 0).
+ * occupied contains the squares that are not empty (including blocked ones);
+ * by_walk[walk] contains the squares occupied by pieces of walk walk of either
+ * side (by_walk[Empty] isn't maintained).
+ * They are kept up to date by set_walk_of_piece_on_square().
+ */
+typedef unsigned long long bitboard_type;
+
+typedef struct
+{
+    bitboard_type occupied;
+    bitboard_type by_walk[nr_piece_walks];
+} board_bitboards_type;
+
+extern board_bitboards_type being_solved_bitboards;
+
+#define bitboard_index_of_square(s) \
+  ((unsigned int)(((s)-square_a1)/onerow*nr_files_on_board \
+                  + ((s)-square_a1)%onerow))
+
 /* Sequence of pieces corresponding to the game array (a1..h1, a2..h2
  * ... a8..h8)
  */
@@ -80,10 +109,54 @@ void empty_square(square s);
 void block_square(square s);
 void occupy_square(square s, piece_walk_type walk, Flags flags);
 void replace_walk(square s, piece_walk_type walk);
+void replace_flags(square s, Flags flags);
+
+/* Start keeping zobrist_key up to date
+ * @param relevant_flags mask of the flags taken into account by zobrist_key
+ */
+void start_maintaining_zobrist_key(Flags relevant_flags);
+
+/* Stop keeping zobrist_key up to date
+ */
+void stop_maintaining_zobrist_key(void);
+
+/* Calculate the Zobrist key of the board of being_solved from scratch
+ * @return the key
+ */
+zobrist_key_type calculate_zobrist_key(void);
+
+/* Is zobrist_key consistent with the board of being_solved?
+ * Code that modifies the board without using the functions above (e.g. to
+ * temporarily change a flag) should assert this once it has restored the board.
+ * @return true iff zobrist_key is up to date or isn't being maintained
+ */
+boolean is_zobrist_key_in_sync(void);
+
+/* Update the bitboards of being_solved before a square changes its walk
+ * @param s the square
+ * @param walk the new walk
+ */
+void update_board_bitboards(square s, piece_walk_type walk);
+
+/* Calculate the bitboards of being_solved from scratch
+ */
+void calculate_board_bitboards(void);
+
+/* Determine whether the bitboards of being_solved reflect the board
+ * @return true iff they do
+ */
+boolean are_board_bitboards_up_to_date(void);
+
+/* Bring what is derived from the board of being_solved (bitboards, Zobrist
+ * key) up to date after being_solved has been assigned as a whole
+ */
+void recalculate_derived_board_data(void);
+
 #define is_square_empty(s) (being_solved.board[(s)]==Empty)
 #define is_square_blocked(s) (being_solved.board[(s)]==Invalid)
 #define get_walk_of_piece_on_square(s) (being_solved.board[(s)])
-#define set_walk_of_piece_on_square(s, w) (being_solved.board[(s)]=(w))
+#define set_walk_of_piece_on_square(s, w) \
+  (update_board_bitboards((s),(w)), being_solved.board[(s)]=(w))
 square find_end_of_line(square from, numvec dir);
 #define piece_belongs_to_opponent(sq)    TSTFLAG(being_solved.spec[(sq)],advers(trait[nbply]))
 
@@ -1,5 +1,6 @@
 #include "optimisations/hash.h"
 #include "solving/moves_traversal.h"
+#include "solving/machinery/dispatch.h"
 #include "output/plaintext/language_dependant.h"
 #include "output/latex/latex.h"
 #include "platform/priority.h"
@@ -12,6 +13,7 @@
 #include "position/effects/side_change.h"
 #include "position/effects/piece_movement.h"
 #include "position/effects/piece_exchange.h"
+#include "position/bitboard.h"
 #include "input/commandline.h"
 #include "input/plaintext/token.h"
 #include "stipulation/pipe.h"
@@ -43,6 +45,7 @@ int main(int argc, char *argv[])
   platform_set_nice_priority();
 
   initialise_slice_properties();
+  dispatch_initialise_solvers();
   init_structure_children_visitors();
   init_moves_children_visitors();
 
@@ -57,6 +60,7 @@ int main(int argc, char *argv[])
   position_piece_exchange_initialise();
   position_flags_change_initialise();
   position_side_change_initialise();
+  bitboard_initialise();
 
   {
     slice_index const parser = alloc_command_line_options_parser(argc,argv);
@@ -64,6 +68,7 @@ int main(int argc, char *argv[])
     slice_index const prototypes[] =
     {
       alloc_pipe(STPlatformInitialiser),
+      alloc_pipe(STPlyTablesAllocator),
       alloc_pipe(STHashTableDimensioner),
       alloc_pipe(STOutputLaTeXCloser),
       /* start timer to be able to display a reasonable time if the user
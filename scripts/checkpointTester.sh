@@ -0,0 +1,82 @@
+#! /bin/bash
+
+# Script for testing checkpoints (command line options -checkpoint and
+# -resume)
+#
+# Usage: checkpointTester.sh
+#
+# Twinned problems (one of them with set play and duplex) are solved from
+# checkpoints written to a temporary directory. Twins and phases before the
+# checkpoint have to be skipped, the moves of the checkpointed phase before
+# the checkpointed move as well, and later twins have to be solved in full.
+
+SCRIPTDIR=$(dirname $0)
+POPEYEDIR=$(cd ${SCRIPTDIR}/.. && pwd)
+
+TMPDIR=$(mktemp -d)
+trap "rm -rf ${TMPDIR}" EXIT
+
+cat > ${TMPDIR}/twin.inp <<EOF
+begin
+pieces white kc1 rh7 rg1 black ka8
+stip #1
+twin move g1 g2
+end
+EOF
+
+cat > ${TMPDIR}/phases.inp <<EOF
+begin
+pieces white kc1 rh7 rg1 black ka8 pb7
+stip h#1
+option setplay duplex
+twin move g1 g2
+end
+EOF
+
+failed=0
+
+# usage: resume input twin phase move
+resume()
+{
+    ${POPEYEDIR}/py -maxmem 16M -checkpoint ${TMPDIR}/full.chk ${TMPDIR}/$1 > /dev/null
+    sed -e "s/^twin .*/twin $2/" -e "s/^phase .*/phase $3/" -e "s/^move .*/move $4/" ${TMPDIR}/full.chk > ${TMPDIR}/resumed.chk
+    ${POPEYEDIR}/py -maxmem 16M -resume ${TMPDIR}/resumed.chk ${TMPDIR}/$1 2> /dev/null > ${TMPDIR}/solution
+}
+
+# usage: check description solution_expected solution_not_expected
+check()
+{
+    if [ -n "$2" ] && ! grep -q "$2" ${TMPDIR}/solution
+    then
+        echo "$1: missing $2"
+        failed=1
+    fi
+
+    if [ -n "$3" ] && grep -q "$3" ${TMPDIR}/solution
+    then
+        echo "$1: not skipped $3"
+        failed=1
+    fi
+}
+
+resume twin.inp 1 1 3
+check "twin a, last move" "1.Rg1-g8 #" ""
+check "twin a, last move" "1.Rg2-g8 #" ""
+
+resume twin.inp 1 1 4
+check "twin a solved" "1.Rg2-g8 #" "1.Rg1-g8 #"
+
+resume twin.inp 2 1 7
+check "twin b, last move" "1.Rg2-g8 #" "1.Rg1-g8 #"
+
+resume twin.inp 2 1 8
+check "twin b solved" "" "1.Rg2-g8 #"
+
+resume phases.inp 1 2 31
+check "play of twin a" "1.b7-b6 Rg1-g8 #" "1.b7-b5 Rg1-g8 #"
+check "play of twin a" "1.b7-b5 Rg2-g8 #" ""
+
+resume phases.inp 1 3 1
+check "duplex of twin a" "1.b7-b5 Rg2-g8 #" "Rg1-g8 #"
+
+exit $failed
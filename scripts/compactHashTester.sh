@@ -0,0 +1,33 @@
+#! /bin/bash
+
+# Script for solving example problems with the compact hash table
+# (command line option -compacthash), which is kept so small that entries
+# have to be replaced, and for comparing the solutions to those stored in
+# REGRESSIONTESTS
+#
+# Usage: compactHashTester.sh [inputfile...]
+#
+# Without parameters, TESTS/compacthash.inp is solved.
+# The numbers of moves played etc. written by builds with DOMEASURE depend on
+# the hash table and are not compared.
+
+SCRIPTDIR=$(dirname $0)
+POPEYEDIR=${SCRIPTDIR}/..
+
+if [ $# -eq 0 ]
+then
+    set -- ${POPEYEDIR}/TESTS/compacthash.inp
+fi
+
+for f in "$@"
+do
+    ${POPEYEDIR}/py -maxmem 1M -compacthash -regression -maxtrace 0 $f > /dev/null
+done
+
+for f in `ls -tr`
+do
+    if [ -f ${POPEYEDIR}/REGRESSIONTESTS/$f ]
+    then
+        diff -q -wb -I '^ *[a-z_]*: *[0-9]*$' ${POPEYEDIR}/REGRESSIONTESTS/$f $f > /dev/null || echo "different solutions: $f"
+    fi
+done
@@ -0,0 +1,94 @@
+#! /bin/bash
+
+# Script for testing the regression test suite runner (command line option
+# -regression-suite) itself
+#
+# Usage: regressionSuiteTester.sh
+#
+# A small suite is set up in a temporary directory: one input file whose
+# reference matches (and contains counter lines like those written by builds
+# with DOMEASURE), one whose reference differs in the solution and one
+# without reference. The runner has to report each of them correctly.
+
+SCRIPTDIR=$(dirname $0)
+POPEYEDIR=$(cd ${SCRIPTDIR}/.. && pwd)
+
+TMPDIR=$(mktemp -d)
+trap "rm -rf ${TMPDIR}" EXIT
+
+mkdir ${TMPDIR}/SUITE ${TMPDIR}/REGRESSIONTESTS ${TMPDIR}/work
+
+for name in identical different noreference
+do
+    cat > ${TMPDIR}/SUITE/${name}.inp <<EOF
+begin
+protocol ${name}.tst
+pieces white kb6 rh7 black ka8
+stip #1
+end
+EOF
+done
+
+# the reference as written by a build with DOMEASURE
+cat > ${TMPDIR}/REGRESSIONTESTS/identical.tst <<EOF
+
+
++---a---b---c---d---e---f---g---h---+
+|                                   |
+8  -K   .   .   .   .   .   .   .   8
+|                                   |
+7   .   .   .   .   .   .   .   R   7
+|                                   |
+6   .   K   .   .   .   .   .   .   6
+|                                   |
+5   .   .   .   .   .   .   .   .   5
+|                                   |
+4   .   .   .   .   .   .   .   .   4
+|                                   |
+3   .   .   .   .   .   .   .   .   3
+|                                   |
+2   .   .   .   .   .   .   .   .   2
+|                                   |
+1   .   .   .   .   .   .   .   .   1
+|                                   |
++---a---b---c---d---e---f---g---h---+
+  #1                          2 + 1
+
+   1.Rh7-h8 # !
+
+  add_to_move_generation_stack:           8
+                     play_move:           3
+ is_white_king_square_attacked:           0
+ is_black_king_square_attacked:           3
+
+solution finished.
+
+
+EOF
+
+sed -e 's/Rh7-h8/Rh7-a7/' ${TMPDIR}/REGRESSIONTESTS/identical.tst > ${TMPDIR}/REGRESSIONTESTS/different.tst
+
+(cd ${TMPDIR}/work && ${POPEYEDIR}/py -maxmem 16M -regression-suite ${TMPDIR}/SUITE -j 2) > ${TMPDIR}/report
+
+failed=0
+
+check()
+{
+    if ! grep -q "$1" ${TMPDIR}/report
+    then
+        echo "not reported: $1"
+        failed=1
+    fi
+}
+
+check "^identical.inp .* identical$"
+check "^different.inp .* DIFFERENT .*different.tst from line 24$"
+check "^noreference.inp .* no reference for .*noreference.tst$"
+check "^3 input files: 1 identical, 1 different, 1 without reference, 0 failed$"
+
+if [ $failed -ne 0 ]
+then
+    cat ${TMPDIR}/report
+fi
+
+exit $failed
@@ -21,11 +21,11 @@
 
 /* Table where threats of the various move levels are collected
  */
-table threats[maxply+1];
+table *threats;
 
 /* Lengths of threats of the various move levels
  */
-static stip_length_type threat_lengths[maxply+1];
+static stip_length_type *threat_lengths;
 
 /* value of threat_lengths[N] that signals that no threats were found
  * in ply N (and that threats[N] may not even refer to a table)
@@ -37,6 +37,14 @@ static stip_length_type const no_threats_found = UINT_MAX;
  */
 static unsigned int nr_threats_to_be_confirmed;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void threat_allocate_ply_tables(void)
+{
+  threats = ply_allocate_table(maxply+1,sizeof threats[0]);
+  threat_lengths = ply_allocate_table(maxply+1,sizeof threat_lengths[0]);
+}
+
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
  * @note assigns solve_result the length of solution found and written, i.e.:
@@ -11,7 +11,7 @@
 
 /* Table where threats of the various move levels are collected
  */
-extern table threats[maxply+1];
+extern table *threats;
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
@@ -83,4 +83,8 @@ void solving_insert_threat_boundaries(slice_index si);
  */
 void solving_threat_instrument_for_dummy_move_effects(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void threat_allocate_ply_tables(void);
+
 #endif
@@ -43,10 +43,17 @@
 
 #include "debugging/assert.h"
 
-piece_walk_type observing_walk[maxply+1];
+piece_walk_type *observing_walk;
 
 piece_walk_type checkpieces[nr_piece_walks-Leo+1]; /* only fairies ! */
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void track_back_from_target_allocate_ply_tables(void)
+{
+  observing_walk = ply_allocate_table(maxply+1,sizeof observing_walk[0]);
+}
+
 static boolean never_check(validator_id evaluate)
 {
   return false;
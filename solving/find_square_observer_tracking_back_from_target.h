@@ -6,7 +6,7 @@
 #include "utilities/boolean.h"
 #include "pieces/pieces.h"
 
-extern piece_walk_type observing_walk[maxply+1];
+extern piece_walk_type *observing_walk;
 
 typedef boolean (checkfunction_t)(validator_id);
 extern checkfunction_t *checkfunctions[nr_piece_walks];
@@ -17,4 +17,8 @@ void track_back_from_target_according_to_observer_walk(slice_index si);
 
 void determine_observer_walk(slice_index si);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void track_back_from_target_allocate_ply_tables(void);
+
 #endif
@@ -14,7 +14,14 @@
 #include "debugging/assert.h"
 
 /* remember if the prerequistes for the relvant goals are met */
-unsigned int goal_preprequisites_met[maxply];
+unsigned int *goal_preprequisites_met;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void goal_prerequisite_guards_allocate_ply_tables(void)
+{
+  goal_preprequisites_met = ply_allocate_table(maxply,sizeof goal_preprequisites_met[0]);
+}
 
 static boolean insert_goal_prerequisite_guard_battle_filter(slice_index si,
                                                             goal_type goal,
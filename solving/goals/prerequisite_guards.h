@@ -6,7 +6,7 @@
 #include "solving/ply.h"
 
 /* remember if the prerequistes for the relvant goals are met */
-extern unsigned int goal_preprequisites_met[maxply];
+extern unsigned int *goal_preprequisites_met;
 
 /* Instrument the stipulation structure with goal prerequisite guards.
  * These guards stop solving if the following move has to reach a
@@ -22,4 +22,8 @@ typedef struct
   boolean are_there_other_forks;
 } prerequisite_guards_insertion_state;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void goal_prerequisite_guards_allocate_ply_tables(void);
+
 #endif
@@ -43,6 +43,28 @@ solving_completeness_type problem_solving_completeness(slice_index si)
   return result;
 }
 
+/* Remember that solving a part of the problem has been interrupted where the
+ * phases of that part can't report it themselves, e.g. in a worker process
+ * @param si identifies the STProblemSolvingIncomplete slice
+ * @param c completeness of the part
+ */
+void problem_solving_remember_incompleteness(slice_index si,
+                                             solving_completeness_type c)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParam("%d",c);
+  TraceFunctionParamListEnd();
+
+  assert(SLICE_TYPE(si)==STProblemSolvingIncomplete);
+
+  if (SLICE_U(si).value_handler.value<c)
+    SLICE_U(si).value_handler.value = c;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
 /* Allocate a STPhaseSolvingIncomplete slice
  * @param base base for searching for the STProblemSolvingIncomplete slice
  *             that the result will propagate the information about
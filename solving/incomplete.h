@@ -28,6 +28,14 @@ void problem_solving_incomplete_solve(slice_index si);
  */
 solving_completeness_type problem_solving_completeness(slice_index si);
 
+/* Remember that solving a part of the problem has been interrupted where the
+ * phases of that part can't report it themselves, e.g. in a worker process
+ * @param si identifies the STProblemSolvingIncomplete slice
+ * @param c completeness of the part
+ */
+void problem_solving_remember_incompleteness(slice_index si,
+                                             solving_completeness_type c);
+
 /* Allocate a STPhaseSolvingIncomplete slice
  * @param base base for searching for the STProblemSolvingIncomplete slice
  *             that the result will propagate the information about
@@ -6,15 +6,26 @@
 #include "debugging/assert.h"
 
 /* current value of the count */
-unsigned int legal_move_counter_count[maxply];
+unsigned int *legal_move_counter_count;
 
 /* stop the move iteration once legal_move_counter_count exceeds this number */
-unsigned int legal_move_counter_interesting[maxply];
+unsigned int *legal_move_counter_interesting;
 
 #if !defined(NDEBUG)
-static boolean is_init[maxply];
+static boolean *is_init;
 #endif
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void legal_move_counter_allocate_ply_tables(void)
+{
+  legal_move_counter_count = ply_allocate_table(maxply,sizeof legal_move_counter_count[0]);
+  legal_move_counter_interesting = ply_allocate_table(maxply,sizeof legal_move_counter_interesting[0]);
+#if !defined(NDEBUG)
+  is_init = ply_allocate_table(maxply,sizeof is_init[0]);
+#endif
+}
+
 /* Allocate a STLegalAttackCounter slice.
  * @return index of allocated slice
  */
@@ -9,10 +9,10 @@
  */
 
 /* current value of the count */
-extern unsigned int legal_move_counter_count[maxply];
+extern unsigned int *legal_move_counter_count;
 
 /* stop the move iteration once legal_move_counter_count exceeds this number */
-extern unsigned int legal_move_counter_interesting[maxply];
+extern unsigned int *legal_move_counter_interesting;
 
 /* Allocate a STLegalAttackCounter slice.
  * @return index of allocated slice
@@ -63,4 +63,8 @@ void legal_defense_counter_solve(slice_index si);
 void legal_move_count_init(unsigned int nr_interesting);
 void legal_move_count_fini(void);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void legal_move_counter_allocate_ply_tables(void);
+
 #endif
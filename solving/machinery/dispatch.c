@@ -170,10 +170,12 @@
 #include "optimisations/intelligent/stalemate/goalreachable_guard.h"
 #include "optimisations/intelligent/stalemate/immobilise_black.h"
 #include "optimisations/killer_move/collector.h"
-#include "optimisations/killer_move/final_defense_move.h"
+#include "optimisations/killer_move/staged_defense.h"
 #include "optimisations/killer_move/prioriser.h"
+#include "optimisations/killer_move/history.h"
 #include "optimisations/orthodox_mating_moves/orthodox_mating_move_generator.h"
 #include "optimisations/orthodox_mating_moves/king_contact_move_generator.h"
+#include "optimisations/orthodox_legal_moves.h"
 #include "optimisations/orthodox_square_observation.h"
 #include "optimisations/ohneschach/non_checking_first.h"
 #include "optimisations/ohneschach/stop_if_check.h"
@@ -196,6 +198,8 @@
 #include "options/goal_is_end.h"
 #include "options/nullmoves.h"
 #include "input/commandline.h"
+#include "input/server.h"
+#include "input/regression_suite.h"
 #include "input/plaintext/plaintext.h"
 #include "input/plaintext/problem.h"
 #include "input/plaintext/twin.h"
@@ -269,6 +273,7 @@
 #include "stipulation/whitetoplay.h"
 #include "stipulation/battle_play/branch.h"
 #include "solving/machinery/slack_length.h"
+#include "solving/machinery/ply_tables.h"
 #include "solving/avoid_unsolvable.h"
 #include "solving/battle_play/attack_adapter.h"
 #include "solving/battle_play/defense_adapter.h"
@@ -340,12 +345,643 @@
 #include "solving/machinery/solve.h"
 #include "solving/machinery/solvers.h"
 #include "solving/zeroposition.h"
+#include "solving/parallel/root_moves.h"
+#include "solving/parallel/partition.h"
+#include "solving/parallel/twins.h"
+#include "solving/statistics.h"
 #include "debugging/trace.h"
 #include "debugging/measure.h"
 #include "debugging/assert.h"
 #include "platform/platform.h"
 #include "platform/maxmem.h"
 #include "platform/timer.h"
+#include "pieces/attributes/total_invisible/consumption.h"
+
+typedef void (*slice_solver)(slice_index si);
+
+/* the function solving the slices of each type */
+static slice_solver solvers[nr_slice_types];
+
+static void unsupported_solve(slice_index si)
+{
+  assert(0);
+}
+
+static void true_solve(slice_index si)
+{
+  solve_result = previous_move_has_solved;
+}
+
+static void false_solve(slice_index si)
+{
+  solve_result = MOVE_HAS_NOT_SOLVED_LENGTH();
+}
+
+static void moves_for_piece_based_on_walk_generator_solve(slice_index si)
+{
+  generate_moves_for_piece_based_on_walk();
+}
+
+static void is_square_observed_ortho_solve(slice_index si)
+{
+  observation_result = is_square_observed_ortho(trait[nbply],
+                                                move_generation_stack[CURRMOVE_OF_PLY(nbply)].capture);
+}
+
+static void check_total_invisible_consumption(void)
+{
+  TraceConsumption();
+
+  assert(!current_consumption.is_king_unplaced[Black] || being_solved.king_square[Black]==initsquare);
+  assert(!current_consumption.is_king_unplaced[White] || being_solved.king_square[White]==initsquare);
+
+  assert(nbply<=ply_retro_move
+         || nr_total_invisbles_consumed()<=total_invisible_number);
+}
+
+/* Initialise the table of the functions solving the slices of each type
+ * @note to be invoked once at start of program
+ */
+void dispatch_initialise_solvers(void)
+{
+  slice_type type;
+
+  for (type = 0; type!=nr_slice_types; ++type)
+    solvers[type] = &unsupported_solve;
+
+  solvers[STQuodlibetStipulationModifier] = &quodlibet_stipulation_modifier_solve;
+  solvers[STGoalIsEndStipulationModifier] = &goal_is_end_stipulation_modifier_solve;
+  solvers[STWhiteToPlayStipulationModifier] = &white_to_play_stipulation_modifier_solve;
+  solvers[STPostKeyPlayStipulationModifier] = &post_key_play_stipulation_modifier_solve;
+  solvers[STStipulationStarterDetector] = &stipulation_starter_detector_solve;
+  solvers[STStipulationCopier] = &stipulation_copier_solve;
+  solvers[STProofSolverBuilder] = &build_proof_solving_machinery;
+  solvers[STAToBSolverBuilder] = &build_atob_solving_machinery;
+  solvers[STTwinIdAdjuster] = &twin_id_adjuster_solve;
+  solvers[STConditionsResetter] = &conditions_resetter_solve;
+  solvers[STOptionsResetter] = &options_resetter_solve;
+  solvers[STProblemSolvingIncomplete] = &problem_solving_incomplete_solve;
+  solvers[STPhaseSolvingIncomplete] = &phase_solving_incomplete_solve;
+  solvers[STCommandLineOptionsParser] = &command_line_options_parser_solve;
+  solvers[STInputPlainTextOpener] = &input_plaintext_opener_solve;
+  solvers[STServerChannelOpener] = &server_channel_opener_solve;
+  solvers[STPlatformInitialiser] = &platform_initialiser_solve;
+  solvers[STOutputLaTeXCloser] = &output_latex_closer_solve;
+  solvers[STOutputPlainTextInstrumentSolversBuilder] = &output_plaintext_instrument_solving_builder_solve;
+  solvers[STOutputPlainTextInstrumentSolvers] = &output_plaintext_instrument_solving;
+  solvers[STOutputLaTeXInstrumentSolversBuilder] = &output_latex_instrument_solving_builder_solve;
+  solvers[STOutputLaTeXInstrumentSolvers] = &output_latex_instrument_solving;
+  solvers[STPlyTablesAllocator] = &ply_tables_allocator_solve;
+  solvers[STHashTableDimensioner] = &hashtable_dimensioner_solve;
+  solvers[STTimerStarter] = &timer_starter_solve;
+  solvers[STCheckDirInitialiser] = &check_dir_initialiser_solve;
+  solvers[STOutputPlainTextWriter] = &output_plaintext_writer_solve;
+  solvers[STServerRequestsIterator] = &server_requests_iterator_solve;
+  solvers[STRegressionSuiteRunner] = &regression_suite_runner_solve;
+  solvers[STParallelPartitionMerger] = &parallel_partition_merger_solve;
+  solvers[STInputPlainTextUserLanguageDetector] = &input_plaintext_detect_user_language;
+  solvers[STInputPlainTextProblemsIterator] = &input_plaintext_iterate_problems;
+  solvers[STEndOfStipulationSpecific] = &pipe_solve_delegate;
+  solvers[STOutputPlainTextStartOfTargetWriter] = &pipe_solve_delegate;
+  solvers[STInputPlainTextProblemHandler] = &input_plaintext_problem_handle;
+  solvers[STInputPlainTextInitialTwinReader] = &input_plaintext_initial_twin_reader_solve;
+  solvers[STInputPlainTextTwinsHandler] = &input_plaintext_twins_handle;
+  solvers[STSolvingMachineryIntroBuilder] = &solving_machinery_intro_builder_solve;
+  solvers[STOutputPlainTextOptionNoboard] = &output_plaintext_option_noboard_solve;
+  solvers[STOutputPlaintextTwinIntroWriterBuilder] = &output_plaintext_twin_intro_writer_builder_solve;
+  solvers[STOutputLaTeXTwinningWriterBuilder] = &output_latex_twinning_writer_builder_solve;
+  solvers[STStartOfCurrentTwin] = &slices_deallocator_solve;
+  solvers[STDuplexSolver] = &duplex_solve;
+  solvers[STHalfDuplexSolver] = &half_duplex_solve;
+  solvers[STCreateBuilderSetupPly] = &create_builder_setup_ply_solve;
+  solvers[STPieceWalkCacheInitialiser] = &piece_walk_caches_initialiser_solve;
+  solvers[STPiecesCounter] = &pieces_counter_solve;
+  solvers[STPiecesFlagsInitialiser] = &initialise_piece_flags_solve;
+  solvers[STRoyalsLocator] = &royals_locator_solve;
+  solvers[STProofgameVerifyUniqueGoal] = &proof_verify_unique_goal_solve;
+  solvers[STProofgameStartPositionInitialiser] = &proof_initialise_start_position;
+  solvers[STProofSolver] = &proof_solve;
+  solvers[STInputVerification] = &verify_position;
+  solvers[STMoveEffectsJournalReset] = &move_effect_journal_reset;
+  solvers[STSolversBuilder1] = &build_solvers1;
+  solvers[STSolversBuilder2] = &build_solvers2;
+  solvers[STProxyResolver] = &proxies_resolve;
+  solvers[STSlackLengthAdjuster] = &adjust_slack_length;
+  solvers[STThreatSolver] = &threat_solver_solve;
+  solvers[STDummyMove] = &dummy_move_solve;
+  solvers[STThreatCollector] = &threat_collector_solve;
+  solvers[STThreatEnforcer] = &threat_enforcer_solve;
+  solvers[STThreatDefeatedTester] = &threat_defeated_tester_solve;
+  solvers[STOutputPlainTextThreatWriter] = &output_plaintext_tree_threat_writer_solve;
+  solvers[STOutputPlainTextZugzwangByDummyMoveCheckWriter] = &output_plaintext_tree_zugzwang_by_dummy_move_check_writer_solve;
+  solvers[STOutputPlainTextZugzwangWriter] = &output_plaintext_tree_zugzwang_writer_solve;
+  solvers[STOutputPlainTextKeyWriter] = &output_plaintext_tree_key_writer_solve;
+  solvers[STOutputPlainTextTryWriter] = &output_plaintext_tree_try_writer_solve;
+  solvers[STRefutationsAllocator] = &refutations_allocator_solve;
+  solvers[STRefutationsSolver] = &refutations_solver_solve;
+  solvers[STOutputPlainTextRefutationsIntroWriter] = &output_plaintext_tree_refutations_intro_writer_solve;
+  solvers[STRefutationsAvoider] = &refutations_avoider_solve;
+  solvers[STRefutationsFilter] = &refutations_filter_solve;
+  solvers[STOutputPlaintextTreeRefutingVariationWriter] = &output_plaintext_tree_refuting_variation_writer_solve;
+  solvers[STOutputPlaintextLineRefutingVariationWriter] = &output_plaintext_line_refuting_variation_writer_solve;
+  solvers[STOutputPlainTextMoveWriter] = &output_plaintext_tree_move_writer_solve;
+  solvers[STTrivialEndFilter] = &trivial_end_filter_solve;
+  solvers[STNoShortVariations] = &no_short_variations_solve;
+  solvers[STOr] = &or_solve;
+  solvers[STFindShortest] = &find_shortest_solve;
+  solvers[STMoveGenerator] = &move_generator_solve;
+  solvers[STForEachAttack] = &for_each_attack_solve;
+  solvers[STFindAttack] = &find_attack_solve;
+  solvers[STForEachDefense] = &for_each_defense_solve;
+  solvers[STFindDefense] = &find_defense_solve;
+  solvers[STNullMovePlayer] = &null_move_player_solve;
+  solvers[STRoleExchangeMovePlayer] = &role_exchange_player_solve;
+  solvers[STPostMoveIterationInitialiser] = &move_execution_post_move_iterator_solve;
+  solvers[STMoveEffectJournalUndoer] = &move_effect_journal_undoer_solve;
+  solvers[STMessignyMovePlayer] = &messigny_move_player_solve;
+  solvers[STCastlingPlayer] = &castling_player_solve;
+  solvers[STMovePlayer] = &move_player_solve;
+  solvers[STEnPassantAdjuster] = &en_passant_adjuster_solve;
+  solvers[STEinsteinEnPassantAdjuster] = &einstein_en_passant_adjuster_solve;
+  solvers[STPawnPromoter] = &pawn_promoter_solve;
+  solvers[STMakeTakeResetMoveIdsCastlingAsMakeInMoveGeneration] = &make_and_take_reset_move_ids_castling_as_make_in_move_generation;
+  solvers[STMakeTakeGenerateCapturesWalkByWalk] = &make_and_take_generate_captures_by_walk_solve;
+  solvers[STMakeTakeMoveCastlingPartner] = &make_and_take_move_castling_partner;
+  solvers[STBoleroGenerateMovesWalkByWalk] = &bolero_generate_moves;
+  solvers[STMarsCirceMoveToRebirthSquare] = &marscirce_move_to_rebirth_square_solve;
+  solvers[STKamikazeCapturingPieceRemover] = &kamikaze_capturing_piece_remover_solve;
+  solvers[STHaanChessHoleInserter] = &haan_chess_hole_inserter_solve;
+  solvers[STCastlingChessMovePlayer] = &castling_chess_move_player_solve;
+  solvers[STExchangeCastlingMovePlayer] = &exchange_castling_move_player_solve;
+  solvers[STSuperTransmutingKingTransmuter] = &supertransmuting_kings_transmuter_solve;
+  solvers[STSuperTransmutingKingMoveGenerationFilter] = &supertransmuting_kings_move_generation_filter_solve;
+  solvers[STAMUAttackCounter] = &amu_attack_counter_solve;
+  solvers[STMutualCastlingRightsAdjuster] = &mutual_castling_rights_adjuster_solve;
+  solvers[STImitatorMover] = &imitator_mover_solve;
+  solvers[STImitatorRemoveIllegalMoves] = &imitator_remove_illegal_moves_solve;
+  solvers[STImitatorDetectIllegalMoves] = &imitator_detect_illegal_moves_solve;
+  solvers[STPawnToImitatorPromoter] = &imitator_pawn_promoter_solve;
+  solvers[STAttackPlayed] = &attack_played_solve;
+#if defined(DOTRACE)
+  solvers[STMoveTracer] = &move_tracer_solve;
+#endif
+#if defined(DOMEASURE)
+  solvers[STMoveCounter] = &move_counter_solve;
+  solvers[STCountersWriter] = &counters_writer_solve;
+#endif
+  solvers[STStatisticsWriter] = &statistics_writer_solve;
+  solvers[STOrthodoxMatingMoveGenerator] = &orthodox_mating_move_generator_solve;
+  solvers[STOrthodoxMatingKingContactGenerator] = &orthodox_mating_king_contact_generator_solve;
+  solvers[STDeadEnd] = &dead_end_solve;
+  solvers[STDeadEndGoal] = &dead_end_solve;
+  solvers[STMinLengthOptimiser] = &min_length_optimiser_solve;
+  solvers[STForkOnRemaining] = &fork_on_remaining_solve;
+  solvers[STHashOpener] = &hash_opener_solve;
+  solvers[STAttackHashed] = &attack_hashed_solve;
+  solvers[STAttackHashedTester] = &attack_hashed_tester_solve;
+  solvers[STHelpHashed] = &help_hashed_solve;
+  solvers[STHelpHashedTester] = &help_hashed_tester_solve;
+  solvers[STEndOfBranch] = &end_of_branch_solve;
+  solvers[STEndOfBranchForced] = &end_of_branch_solve;
+  solvers[STEndOfBranchTester] = &end_of_branch_solve;
+  solvers[STEndOfBranchGoal] = &end_of_branch_goal_solve;
+  solvers[STEndOfBranchGoalImmobile] = &end_of_branch_goal_solve;
+  solvers[STEndOfBranchGoalTester] = &end_of_branch_goal_solve;
+  solvers[STGoalReachedTester] = &goal_reached_tester_solve;
+  solvers[STAvoidUnsolvable] = &avoid_unsolvable_solve;
+  solvers[STResetUnsolvable] = &reset_unsolvable_solve;
+  solvers[STLearnUnsolvable] = &learn_unsolvable_solve;
+  solvers[STConstraintSolver] = &constraint_solve;
+  solvers[STConstraintTester] = &constraint_solve;
+  solvers[STGoalConstraintTester] = &constraint_solve;
+  solvers[STSelfCheckGuard] = &selfcheck_guard_solve;
+  solvers[STExclusiveChessGoalReachingMoveCounterSelfCheckGuard] = &selfcheck_guard_solve;
+  solvers[STKeepMatingFilter] = &keepmating_filter_solve;
+  solvers[STOutputPlaintextTreeCheckWriter] = &output_plaintext_tree_check_writer_solve;
+  solvers[STOutputPlainTextRefutationWriter] = &output_plaintext_tree_refutation_writer_solve;
+  solvers[STDoubleMateFilter] = &doublemate_filter_solve;
+  solvers[STCounterMateFilter] = &countermate_filter_solve;
+  solvers[STEnPassantFilter] = &enpassant_filter_solve;
+  solvers[STEnPassantRemoveNonReachers] = &enpassant_remove_non_reachers_solve;
+  solvers[STCastlingFilter] = &castling_filter_solve;
+  solvers[STCastlingRemoveNonReachers] = &castling_remove_non_reachers_solve;
+  solvers[STPrerequisiteOptimiser] = &goal_prerequisite_optimiser_solve;
+  solvers[STChess81RemoveNonReachers] = &chess81_remove_non_reachers_solve;
+  solvers[STCaptureRemoveNonReachers] = &capture_remove_non_reachers_solve;
+  solvers[STTargetRemoveNonReachers] = &target_remove_non_reachers_solve;
+  solvers[STDetectMoveRetracted] = &detect_move_retracted_solve;
+  solvers[STRetractionPrioriser] = &priorise_retraction_solve;
+  solvers[STOutputPlaintextProblemWriter] = &output_plaintext_problem_writer_solve;
+  solvers[STOutputPlaintextGoalWriter] = &output_plaintext_goal_writer_solve;
+  solvers[STOutputPlaintextConstraintWriter] = &output_plaintext_constraint_writer_solve;
+  solvers[STOutputPlaintextLineLineWriter] = &output_plaintext_line_line_writer_solve;
+  solvers[STOutputLaTeXGoalWriter] = &output_latex_goal_writer_solve;
+  solvers[STOutputLaTeXConstraintWriter] = &output_latex_constraint_writer_solve;
+  solvers[STOutputLaTeXLineLineWriter] = &output_latex_line_line_writer_solve;
+  solvers[STOutputLaTeXProblemWriter] = &output_latex_problem_writer_solve;
+  solvers[STOutputLaTeXProblemIntroWriter] = &output_latex_problem_intro_writer_solve;
+  solvers[STOutputLaTeXTwinningWriter] = &output_latex_write_twinning;
+  solvers[STOutputLaTeXKeyWriter] = &output_latex_tree_key_writer_solve;
+  solvers[STOutputLaTeXMoveWriter] = &output_latex_tree_move_writer_solve;
+  solvers[STOutputLaTeXRefutationWriter] = &output_latex_tree_refutation_writer_solve;
+  solvers[STOutputLaTeXThreatWriter] = &output_latex_tree_threat_writer_solve;
+  solvers[STOutputLaTeXTreeCheckWriter] = &output_latex_tree_check_writer_solve;
+  solvers[STOutputLaTeXTreeRefutingVariationWriter] = &output_latex_tree_refuting_variation_writer_solve;
+  solvers[STOutputLaTeXTryWriter] = &output_latex_tree_try_writer_solve;
+  solvers[STOutputLaTeXZugzwangByDummyMoveCheckWriter] = &output_latex_tree_zugzwang_by_dummy_move_check_writer_solve;
+  solvers[STOutputLaTeXZugzwangWriter] = &output_latex_tree_zugzwang_writer_solve;
+  solvers[STBGLEnforcer] = &bgl_enforcer_solve;
+  solvers[STBGLAdjuster] = &bgl_adjuster_solve;
+  solvers[STMasandRecolorer] = &masand_recolorer_solve;
+  solvers[STMasandGeneralisedRecolorer] = &masand_generalised_recolorer_solve;
+  solvers[STInfluencerWalkChanger] = &influencer_walk_changer_solve;
+  solvers[STActuatedRevolvingCentre] = &actuated_revolving_centre_solve;
+  solvers[STActuatedRevolvingBoard] = &actuated_revolving_board_solve;
+  solvers[STRepublicanKingPlacer] = &republican_king_placer_solve;
+  solvers[STRepublicanType1DeadEnd] = &republican_type1_dead_end_solve;
+  solvers[STBretonApplier] = &breton_applier_solve;
+  solvers[STBretonPopeyeApplier] = &breton_applier_solve;
+  solvers[STCirceCaptureFork] = &circe_capture_fork_solve;
+  solvers[STCircePreventKingRebirth] = &circe_prevent_king_rebirth_solve;
+  solvers[STCirceInitialiseRelevantFromReborn] = &circe_initialise_relevant_from_reborn;
+  solvers[STCirceInitialiseFromCurrentMove] = &circe_make_current_move_relevant_solve;
+  solvers[STCirceInitialiseFromLastMove] = &circe_make_last_move_relevant_solve;
+  solvers[STCirceInitialiseRebornFromCapturee] = &circe_initialise_reborn_from_capturee_solve;
+  solvers[STCirceCloneDetermineRebornWalk] = &circe_clone_determine_reborn_walk_solve;
+  solvers[STAntiCloneCirceDetermineRebornWalk] = &anti_clone_circe_determine_reborn_walk_solve;
+  solvers[STCirceDoubleAgentsAdaptRebornSide] = &circe_doubleagents_adapt_reborn_side_solve;
+  solvers[STChameleonCirceAdaptRebornWalk] = &chameleon_circe_adapt_reborn_walk_solve;
+  solvers[STCirceEinsteinAdjustRebornWalk] = &circe_einstein_adjust_reborn_walk_solve;
+  solvers[STCirceReverseEinsteinAdjustRebornWalk] = &circe_reverse_einstein_adjust_reborn_walk_solve;
+  solvers[STCirceCouscousMakeCapturerRelevant] = &circe_couscous_make_capturer_relevant_solve;
+  solvers[STAnticirceCouscousMakeCaptureeRelevant] = &anticirce_couscous_make_capturee_relevant_solve;
+  solvers[STMirrorCirceOverrideRelevantSide] = &mirror_circe_override_relevant_side_solve;
+  solvers[STCirceDetermineRebirthSquare] = &circe_determine_rebirth_square_solve;
+  solvers[STCirceFrischaufAdjustRebirthSquare] = &frischauf_adjust_rebirth_square_solve;
+  solvers[STCirceGlasgowAdjustRebirthSquare] = &circe_glasgow_adjust_rebirth_square_solve;
+  solvers[STFileCirceDetermineRebirthSquare] = &file_circe_determine_rebirth_square_solve;
+  solvers[STCirceDiametralAdjustRebirthSquare] = &circe_diametral_adjust_rebirth_square_solve;
+  solvers[STCirceVerticalMirrorAdjustRebirthSquare] = &circe_verticalmirror_adjust_rebirth_square_solve;
+  solvers[STRankCirceOverrideRelevantSide] = &rank_circe_override_relevant_side_solve;
+  solvers[STRankCirceProjectRebirthSquare] = &rank_circe_adjust_rebirth_square_solve;
+  solvers[STTakeMakeCirceDetermineRebirthSquares] = &take_make_circe_determine_rebirth_squares_solve;
+  solvers[STTakeMakeCirceCollectRebirthSquares] = &take_make_circe_collect_rebirth_squares_solve;
+  solvers[STAntipodesCirceDetermineRebirthSquare] = &antipodes_circe_determine_rebirth_square_solve;
+  solvers[STSymmetryCirceDetermineRebirthSquare] = &symmetry_circe_determine_rebirth_square_solve;
+  solvers[STVerticalSymmetryCirceDetermineRebirthSquare] = &vertical_symmetry_circe_determine_rebirth_square_solve;
+  solvers[STHorizontalSymmetryCirceDetermineRebirthSquare] = &horizontal_symmetry_circe_determine_rebirth_square_solve;
+  solvers[STPWCDetermineRebirthSquare] = &pwc_determine_rebirth_square_solve;
+  solvers[STDiagramCirceDetermineRebirthSquare] = &diagram_circe_determine_rebirth_square_solve;
+  solvers[STContactGridAvoidCirceRebirth] = &contact_grid_avoid_circe_rebirth;
+  solvers[STGenevaStopCaptureFromRebirthSquare] = &geneva_stop_catpure_from_rebirth_square_solve;
+  solvers[STCirceTestRebirthSquareEmpty] = &circe_test_rebirth_square_empty_solve;
+  solvers[STCircePlaceReborn] = &circe_place_reborn_solve;
+  solvers[STCirceDoneWithRebirth] = &circe_done_with_rebirth;
+  solvers[STAprilCaptureFork] = &april_chess_fork_solve;
+  solvers[STSuperCirceNoRebirthFork] = &supercirce_no_rebirth_fork_solve;
+  solvers[STSuperCirceDetermineRebirthSquare] = &supercirce_determine_rebirth_square_solve;
+  solvers[STSupercircePreventRebirthOnNonEmptySquare] = &supercirce_prevent_rebirth_on_non_empty_square_solve;
+  solvers[STCirceVolageRecolorer] = &circe_volage_recolorer_solve;
+  solvers[STCirceParrainThreatFork] = &circe_parrain_threat_fork_solve;
+  solvers[STCirceParrainDetermineRebirth] = &circe_parrain_determine_rebirth_solve;
+  solvers[STCirceContraparrainDetermineRebirth] = &circe_contraparrain_determine_rebirth_solve;
+  solvers[STCirceCageNoCageFork] = &circe_cage_no_cage_fork_solve;
+  solvers[STCirceCageCageTester] = &circe_cage_cage_tester_solve;
+  solvers[STCageCirceFutileCapturesRemover] = &circe_cage_futile_captures_remover_solve;
+  solvers[STSeriesCapturePlyRewinder] = &series_capture_ply_rewinder_solve;
+  solvers[STSeriesCaptureFork] = &series_capture_fork_solve;
+  solvers[STSeriesCaptureJournalFixer] = &series_capture_journal_fixer_solve;
+  solvers[STSentinellesInserter] = &sentinelles_inserter_solve;
+  solvers[STMagicViewsInitialiser] = &magic_views_initialiser_solve;
+  solvers[STMagicPiecesRecolorer] = &magic_pieces_recolorer_solve;
+  solvers[STHauntedChessGhostSummoner] = &haunted_chess_ghost_summoner_solve;
+  solvers[STHauntedChessGhostRememberer] = &haunted_chess_ghost_rememberer_solve;
+  solvers[STGhostChessGhostRememberer] = &ghost_chess_ghost_rememberer_solve;
+  solvers[STAndernachSideChanger] = &andernach_side_changer_solve;
+  solvers[STAntiAndernachSideChanger] = &antiandernach_side_changer_solve;
+  solvers[STDarksideSideChanger] = &darkside_side_changer_solve;
+  solvers[STChameleonPursuitSideChanger] = &chameleon_pursuit_side_changer_solve;
+  solvers[STLostPiecesRemover] = &lostpieces_remover_solve;
+  solvers[STNorskRemoveIllegalCaptures] = &norsk_remove_illegal_captures_solve;
+  solvers[STNorskArrivingAdjuster] = &norsk_arriving_adjuster_solve;
+  solvers[STProteanPawnAdjuster] = &protean_pawn_adjuster_solve;
+  solvers[STEinsteinArrivingAdjuster] = &einstein_moving_adjuster_solve;
+  solvers[STReverseEinsteinArrivingAdjuster] = &reverse_einstein_moving_adjuster_solve;
+  solvers[STAntiEinsteinArrivingAdjuster] = &anti_einstein_moving_adjuster_solve;
+  solvers[STTraitorSideChanger] = &traitor_side_changer_solve;
+  solvers[STVolageSideChanger] = &volage_side_changer_solve;
+  solvers[STMagicSquareSideChanger] = &magic_square_side_changer_solve;
+  solvers[STMagicSquareType2SideChanger] = &magic_square_side_changer_solve;
+  solvers[STMagicSquareType2AnticirceRelevantSideAdapter] = &magic_square_anticirce_relevant_side_adapter_solve;
+  solvers[STTibetSideChanger] = &tibet_solve;
+  solvers[STDoubleTibetSideChanger] = &double_tibet_solve;
+  solvers[STDegradierungDegrader] = &degradierung_degrader_solve;
+  solvers[STChameleonChangePromoteeInto] = &chameleon_change_promotee_into_solve;
+  solvers[STChameleonArrivingAdjuster] = &chameleon_arriving_adjuster_solve;
+  solvers[STChameleonChessArrivingAdjuster] = &chameleon_chess_arriving_adjuster_solve;
+  solvers[STLineChameleonArrivingAdjuster] = &line_chameleon_arriving_adjuster_solve;
+  solvers[STFrischaufPromoteeMarker] = &frischauf_promotee_marker_solve;
+  solvers[STPiecesHalfNeutralRecolorer] = &half_neutral_recolorer_solve;
+  solvers[STKobulKingSubstitutor] = &kobul_king_substitutor_solve;
+  solvers[STSnekSubstitutor] = &snek_substitutor_solve;
+  solvers[STSnekCircleSubstitutor] = &snek_circle_substitutor_solve;
+  solvers[STDuellistsRememberDuellist] = &duellists_remember_duellist_solve;
+  solvers[STSingleboxType2LatentPawnSelector] = &singlebox_type2_latent_pawn_selector_solve;
+  solvers[STSingleboxType2LatentPawnPromoter] = &singlebox_type2_latent_pawn_promoter_solve;
+  solvers[STCirceKamikazeCaptureFork] = &circe_kamikaze_capture_fork_solve;
+  solvers[STAnticirceInitialiseRebornFromCapturer] = &circe_initialise_reborn_from_capturer_solve;
+  solvers[STMarscirceInitialiseRebornFromGenerated] = &marscirce_initialise_reborn_from_generated_solve;
+  solvers[STGenevaInitialiseRebornFromCapturer] = &geneva_initialise_reborn_from_capturer_solve;
+  solvers[STAnticirceCheylanFilter] = &anticirce_cheylan_filter_solve;
+  solvers[STAnticirceRemoveCapturer] = &anticirce_remove_capturer_solve;
+  solvers[STMarscirceRemoveCapturer] = &marscirce_remove_capturer_solve;
+  solvers[STFootballChessSubsitutor] = &football_chess_substitutor_solve;
+  solvers[STRefutationsCollector] = &refutations_collector_solve;
+  solvers[STMinLengthGuard] = &min_length_guard_solve;
+  solvers[STDegenerateTree] = &degenerate_tree_solve;
+  solvers[STMaxNrNonTrivialCounter] = &max_nr_nontrivial_counter_solve;
+  solvers[STKillerDefenseCollector] = &killer_defense_collector_solve;
+  solvers[STFindByIncreasingLength] = &find_by_increasing_length_solve;
+  solvers[STHelpMovePlayed] = &help_move_played_solve;
+  solvers[STIntelligentMovesLeftInitialiser] = &intelligent_moves_left_initialiser_solve;
+  solvers[STRestartGuardIntelligent] = &restart_guard_intelligent_solve;
+  solvers[STIntelligentTargetCounter] = &intelligent_target_counter_solve;
+  solvers[STIntelligentFilter] = &intelligent_filter_solve;
+  solvers[STIntelligentFlightsGuarder] = &intelligent_guard_flights;
+  solvers[STIntelligentFlightsBlocker] = &intelligent_find_and_block_flights;
+  solvers[STIntelligentMateTargetPositionTester] = &intelligent_mate_test_target_position;
+  solvers[STIntelligentStalemateTargetPositionTester] = &intelligent_stalemate_test_target_position;
+  solvers[STIntelligentProof] = &intelligent_proof_solve;
+  solvers[STIntelligentLimitNrSolutionsPerTargetPosLimiter] = &intelligent_limit_nr_solutions_per_target_position_solve;
+  solvers[STGoalReachableGuardFilterMate] = &goalreachable_guard_mate_solve;
+  solvers[STGoalReachableGuardFilterStalemate] = &goalreachable_guard_stalemate_solve;
+  solvers[STGoalReachableGuardFilterProof] = &goalreachable_guard_proofgame_solve;
+  solvers[STGoalReachableGuardFilterProofFairy] = &goalreachable_guard_proofgame_fairy_solve;
+  solvers[STRestartGuard] = &restart_guard_solve;
+  solvers[STRestartGuardNested] = &restart_guard_nested_solve;
+  solvers[STMaxTimeProblemInstrumenter] = &maxtime_problem_instrumenter_solve;
+  solvers[STMaxTimeSetter] = &maxtime_set;
+  solvers[STMaxTimeGuard] = &maxtime_guard_solve;
+  solvers[STMaxSolutionsProblemInstrumenter] = &maxsolutions_problem_instrumenter_solve;
+  solvers[STMaxSolutionsSolvingInstrumenter] = &maxsolutions_solving_instrumenter_solve;
+  solvers[STMaxSolutionsCounter] = &maxsolutions_counter_solve;
+  solvers[STMaxSolutionsGuard] = &maxsolutions_guard_solve;
+  solvers[STParallelRootMovesProblemInstrumenter] = &parallel_root_moves_problem_instrumenter_solve;
+  solvers[STParallelRootMovesSolvingInstrumenter] = &parallel_root_moves_solving_instrumenter_solve;
+  solvers[STParallelRootMoveSplitter] = &parallel_root_move_splitter_solve;
+  solvers[STParallelRootMoveClaimer] = &parallel_root_move_claimer_solve;
+  solvers[STParallelTargetPositionSplitter] = &parallel_root_move_splitter_solve;
+  solvers[STParallelTwinsCollector] = &parallel_twins_collector_solve;
+  solvers[STParallelTwinSpawner] = &parallel_twin_spawner_solve;
+  solvers[STStopOnShortSolutionsSolvingInstrumenter] = &stoponshortsolutions_solving_instrumenter_solve;
+  solvers[STStopOnShortSolutionsFilter] = &stoponshortsolutions_solve;
+  solvers[STIfThenElse] = &if_then_else_solve;
+  solvers[STFlightsquaresCounter] = &flightsquares_counter_solve;
+  solvers[STKingMoveGenerator] = &king_move_generator_solve;
+  solvers[STNonKingMoveGenerator] = &non_king_move_generator_solve;
+  solvers[STUltraMummerMeasurerDeadend] = &ultra_mummer_measurer_deadend_solve;
+  solvers[STLegalAttackCounter] = &legal_attack_counter_solve;
+  solvers[STAnyMoveCounter] = &legal_attack_counter_solve;
+  solvers[STLegalDefenseCounter] = &legal_defense_counter_solve;
+  solvers[STCaptureCounter] = &capture_counter_solve;
+  solvers[STOhneschachStopIfCheck] = &ohneschach_stop_if_check_solve;
+  solvers[STOhneschachStopIfCheckAndNotMate] = &ohneschach_stop_if_check_and_not_mate_solve;
+  solvers[STOhneschachDetectUndecidableGoal] = &ohneschach_detect_undecidable_goal_solve;
+  solvers[STRecursionStopper] = &recursion_stopper_solve;
+  solvers[STSinglePieceMoveGenerator] = &single_piece_move_generator_solve;
+  solvers[STCastlingRightsAdjuster] = &castling_rights_adjuster_solve;
+  solvers[STOpponentMovesCounter] = &opponent_moves_counter_solve;
+  solvers[STOpponentMovesKnownLegalCounter] = &opponent_moves_known_legal_counter_solve;
+  solvers[STOpponentMovesFewMovesPrioriser] = &opponent_moves_few_moves_prioriser_solve;
+  solvers[STIntelligentImmobilisationCounter] = &intelligent_immobilisation_counter_solve;
+  solvers[STIntelligentDuplicateAvoider] = &intelligent_duplicate_avoider_solve;
+  solvers[STIntelligentSolutionRememberer] = &intelligent_solution_rememberer_solve;
+  solvers[STIntelligentSolutionsPerTargetPosProblemInstrumenter] = &intelligent_nr_solutions_per_target_position_problem_instrumenter_solve;
+  solvers[STIntelligentSolutionsPerTargetPosSolvingInstrumenter] = &intelligent_nr_solutions_per_target_position_solving_instrumenter_solve;
+  solvers[STIntelligentSolutionsPerTargetPosInitialiser] = &intelligent_nr_solutions_per_target_position_initialiser_solve;
+  solvers[STIntelligentSolutionsPerTargetPosCounter] = &intelligent_nr_solutions_per_target_position_counter_solve;
+  solvers[STSetplayFork] = &setplay_fork_solve;
+  solvers[STAttackAdapter] = &attack_adapter_solve;
+  solvers[STDefenseAdapter] = &defense_adapter_solve;
+  solvers[STHelpAdapter] = &help_adapter_solve;
+  solvers[STAnd] = &and_solve;
+  solvers[STNot] = &not_solve;
+  solvers[STMoveInverter] = &move_inverter_solve;
+  solvers[STMoveInverterSetPlay] = &move_inverter_solve;
+  solvers[STRetroStartRetractionPly] = &retro_start_retraction_ply;
+  solvers[STRetroPlayNullMove] = &retro_play_null_move;
+  solvers[STRetroRetractLastCapture] = &circe_parrain_undo_retro_capture;
+  solvers[STRetroRedoLastCapture] = &circe_parrain_redo_retro_capture;
+  solvers[STRetroUndoLastPawnMultistep] = &en_passant_undo_multistep;
+  solvers[STRetroRedoLastPawnMultistep] = &en_passant_redo_multistep;
+  solvers[STRetroStartRetroMovePly] = &retro_start_retro_move_ply;
+  solvers[STMaxSolutionsInitialiser] = &maxsolutions_initialiser_solve;
+  solvers[STStopOnShortSolutionsProblemInstrumenter] = &stoponshortsolutions_problem_instrumenter_solve;
+  solvers[STStopOnShortSolutionsWasShortSolutionFound] = &stoponshortsolutions_was_short_solution_found_solve;
+  solvers[STOutputPlaintextZeropositionIntroWriter] = &output_plaintext_write_zeroposition_intro;
+  solvers[STOutputPlaintextTwinIntroWriter] = &output_plaintext_write_twin_intro;
+  solvers[STOutputPlainTextMetaWriter] = &output_plaintext_write_meta;
+  solvers[STOutputPlainTextBoardWriter] = &output_plaintext_write_board;
+  solvers[STOutputPlainTextPieceCountsWriter] = &output_plaintext_write_piece_counts;
+  solvers[STOutputPlainTextRoyalPiecePositionsWriter] = &output_plaintext_write_royal_piece_positions;
+  solvers[STOutputPlainTextNonRoyalAttributesWriter] = &output_plaintext_write_non_royal_attributes;
+  solvers[STOutputPlainTextConditionsWriter] = &output_plaintext_write_conditions;
+  solvers[STOutputPlainTextMutuallyExclusiveCastlingsWriter] = &output_plaintext_write_mutually_exclusive_castlings;
+  solvers[STOutputPlainTextDuplexWriter] = &output_plaintext_write_duplex;
+  solvers[STOutputPlainTextHalfDuplexWriter] = &output_plaintext_write_halfduplex;
+  solvers[STOutputPlainTextQuodlibetWriter] = &output_plaintext_write_quodlibet;
+  solvers[STOutputPlainTextAToBIntraWriter] = &output_plaintext_write_atob_intra;
+  solvers[STOutputPlainTextStipulationWriter] = &output_plaintext_write_stipulation;
+  solvers[STOutputPlainTextGridWriter] = &output_plaintext_write_grid;
+  solvers[STOutputPlainTextEndOfPositionWriters] = &output_plaintext_end_of_position_writers_solve;
+  solvers[STZeroPositionInitialiser] = &zeroposition_initialiser_solve;
+  solvers[STZeropositionSolvingStopper] = &zeroposition_solving_stopper_solve;
+  solvers[STIllegalSelfcheckWriter] = &illegal_selfcheck_writer_solve;
+  solvers[STOutputPlainTextEndOfPhaseWriter] = &output_plaintext_end_of_phase_writer_solve;
+  solvers[STOutputPlaintextMoveInversionCounter] = &output_plaintext_move_inversion_counter_solve;
+  solvers[STOutputPlaintextMoveInversionCounterSetPlay] = &output_plaintext_move_inversion_counter_solve;
+  solvers[STOutputPlaintextLineEndOfIntroSeriesMarker] = &output_plaintext_line_end_of_intro_series_marker_solve;
+  solvers[STPiecesParalysingMateFilter] = &paralysing_mate_filter_solve;
+  solvers[STPiecesParalysingStalemateSpecial] = &paralysing_stalemate_special_solve;
+  solvers[STPiecesParalysingRemoveCaptures] = &paralysing_remove_captures_solve;
+  solvers[STPiecesParalysingSuffocationFinder] = &paralysing_suffocation_finder_solve;
+  solvers[STAmuMateFilter] = &amu_mate_filter_solve;
+  solvers[STCirceSteingewinnFilter] = &circe_steingewinn_filter_solve;
+  solvers[STCirceCircuitSpecial] = &circe_circuit_special_solve;
+  solvers[STCirceExchangeSpecial] = &circe_exchange_special_solve;
+  solvers[STTemporaryHackFork] = &pipe_solve_delegate;
+  solvers[STGoalTargetReachedTester] = &goal_target_reached_tester_solve;
+  solvers[STGoalCheckReachedTester] = &goal_check_reached_tester_solve;
+  solvers[STGoalCaptureReachedTester] = &goal_capture_reached_tester_solve;
+  solvers[STGoalSteingewinnReachedTester] = &goal_steingewinn_reached_tester_solve;
+  solvers[STGoalEnpassantReachedTester] = &goal_enpassant_reached_tester_solve;
+  solvers[STGoalDoubleMateReachedTester] = &goal_doublemate_reached_tester_solve;
+  solvers[STGoalCounterMateReachedTester] = &goal_countermate_reached_tester_solve;
+  solvers[STGoalCastlingReachedTester] = &goal_castling_reached_tester_solve;
+  solvers[STGoalCircuitReachedTester] = &goal_circuit_reached_tester_solve;
+  solvers[STGoalExchangeReachedTester] = &goal_exchange_reached_tester_solve;
+  solvers[STGoalCircuitByRebirthReachedTester] = &goal_circuit_by_rebirth_reached_tester_solve;
+  solvers[STGoalExchangeByRebirthReachedTester] = &goal_exchange_by_rebirth_reached_tester_solve;
+  solvers[STGoalProofgameReachedTester] = &goal_proofgame_reached_tester_solve;
+  solvers[STGoalAToBReachedTester] = &goal_proofgame_reached_tester_solve;
+  solvers[STGoalImmobileReachedTester] = &goal_immobile_reached_tester_solve;
+  solvers[STMaffImmobilityTesterKing] = &maff_immobility_tester_king_solve;
+  solvers[STOWUImmobilityTesterKing] = &owu_immobility_tester_king_solve;
+  solvers[STGoalNotCheckReachedTester] = &goal_notcheck_reached_tester_solve;
+  solvers[STGoalAnyReachedTester] = &goal_any_reached_tester_solve;
+  solvers[STGoalChess81ReachedTester] = &goal_chess81_reached_tester_solve;
+  solvers[STGoalKissReachedTester] = &goal_kiss_reached_tester_solve;
+  solvers[STGoalKingCaptureReachedTester] = &goal_king_capture_reached_tester_solve;
+  solvers[STPiecesParalysingMateFilterTester] = &paralysing_mate_filter_tester_solve;
+  solvers[STBlackChecks] = &blackchecks_solve;
+  solvers[STSingleBoxType1LegalityTester] = &singlebox_type1_legality_tester_solve;
+  solvers[STSingleBoxType2LegalityTester] = &singlebox_type2_legality_tester_solve;
+  solvers[STSingleBoxType3LegalityTester] = &singlebox_type3_legality_tester_solve;
+  solvers[STSingleBoxType3PawnPromoter] = &singlebox_type3_pawn_promoter_solve;
+  solvers[STExclusiveChessExclusivityDetector] = &exclusive_chess_exclusivity_detector_solve;
+  solvers[STExclusiveChessNestedExclusivityDetector] = &exclusive_chess_nested_exclusivity_detector_solve;
+  solvers[STExclusiveChessLegalityTester] = &exclusive_chess_legality_tester_solve;
+  solvers[STExclusiveChessGoalReachingMoveCounter] = &exclusive_chess_goal_reaching_move_counter_solve;
+  solvers[STExclusiveChessUndecidableWriterTree] = &exclusive_chess_undecidable_writer_tree_solve;
+  solvers[STExclusiveChessUndecidableWriterLine] = &exclusive_chess_undecidable_writer_line_solve;
+  solvers[STUltraschachzwangLegalityTester] = &ultraschachzwang_legality_tester_solve;
+  solvers[STIsardamLegalityTester] = &isardam_legality_tester_solve;
+  solvers[STCirceAssassinAssassinate] = &circe_assassin_assassinate_solve;
+  solvers[STCirceParachuteRemember] = &circe_parachute_remember_solve;
+  solvers[STCirceParachuteUncoverer] = &circe_parachute_uncoverer_solve;
+  solvers[STCirceVolcanicRemember] = &circe_volcanic_remember_solve;
+  solvers[STCirceVolcanicSwapper] = &circe_volcanic_swapper_solve;
+  solvers[STKingSquareUpdater] = &king_square_updater_solve;
+  solvers[STOwnKingCaptureAvoider] = &own_king_capture_avoider_solve;
+  solvers[STOpponentKingCaptureAvoider] = &opponent_king_capture_avoider_solve;
+  solvers[STPatienceChessLegalityTester] = &patience_chess_legality_tester_solve;
+  solvers[STStrictSATInitialiser] = &strict_sat_initialiser_solve;
+  solvers[STStrictSATUpdater] = &strict_sat_updater_solve;
+  solvers[STDynastyKingSquareUpdater] = &dynasty_king_square_updater_solve;
+  solvers[STHurdleColourChanger] = &hurdle_colour_changer_solve;
+  solvers[STHurdleColourChangeInitialiser] = &hurdle_colour_change_initialiser_solve;
+  solvers[STHurdleColourChangerChangePromoteeInto] = &hurdle_colour_change_change_promotee_into_solve;
+  solvers[STOscillatingKingsTypeA] = &oscillating_kings_type_a_solve;
+  solvers[STOscillatingKingsTypeB] = &oscillating_kings_type_b_solve;
+  solvers[STOscillatingKingsTypeC] = &oscillating_kings_type_c_solve;
+  solvers[STPlaySuppressor] = &play_suppressor_solve;
+  solvers[STContinuationSolver] = &continuation_solver_solve;
+  solvers[STDefensePlayed] = &defense_played_solve;
+  solvers[STMaxFlightsquares] = &maxflight_guard_solve;
+  solvers[STMaxNrNonTrivial] = &max_nr_nontrivial_guard_solve;
+  solvers[STOutputPlainTextTreeEndOfSolutionWriter] = &output_plaintext_end_of_solution_writer_solve;
+  solvers[STKillerMoveStagedDefense] = &killer_move_staged_defense_solve;
+  solvers[STKillerMovePrioriser] = &killer_move_prioriser_solve;
+  solvers[STHistoryPrioriser] = &history_prioriser_solve;
+  solvers[STMaxThreatLength] = &maxthreatlength_guard_solve;
+  solvers[STKillerAttackCollector] = &killer_attack_collector_solve;
+  solvers[STTotalInvisibleMoveSequenceTester] = &total_invisible_move_sequence_tester_solve;
+  solvers[STTotalInvisibleInstrumenter] = &total_invisible_instrumenter_solve;
+  solvers[STTotalInvisibleInvisiblesAllocator] = &total_invisible_invisibles_allocator_solve;
+  solvers[STTotalInvisibleMoveSequenceMoveRepeater] = &total_invisible_move_repeater_solve;
+  solvers[STTotalInvisibleUninterceptableSelfCheckGuard] = &total_invisible_uninterceptable_selfcheck_guard_solve;
+  solvers[STTotalInvisibleGoalGuard] = &total_invisible_goal_guard_solve;
+  solvers[STTotalInvisibleSpecialMoveGenerator] = &total_invisible_generate_special_moves;
+  solvers[STTotalInvisibleSpecialMovesPlayer] = &total_invisible_special_moves_player_solve;
+  solvers[STTotalInvisibleReserveKingMovement] = &total_invisible_reserve_king_movement;
+  solvers[STTotalInvisibleMovesByInvisibleGenerator] = &total_invisible_generate_moves_by_invisible;
+  solvers[STTotalInvisibleRevealAfterFinalMove] = &total_invisible_reveal_after_mating_move;
+  solvers[STMummerOrchestrator] = &mummer_orchestrator_solve;
+  solvers[STMummerBookkeeper] = &mummer_bookkeeper_solve;
+  solvers[STBackHomeMovesOnly] = &back_home_moves_only_solve;
+  solvers[STNoPromotionsRemovePromotionMoving] = &nopromotion_avoid_promotion_moving_solve;
+  solvers[STBackhomeExistanceTester] = &backhome_existance_tester_solve;
+  solvers[STBackhomeRemoveIllegalMoves] = &backhome_remove_illegal_moves_solve;
+  solvers[STNocaptureRemoveCaptures] = &nocapture_remove_captures_solve;
+  solvers[STWoozlesRemoveIllegalCaptures] = &woozles_remove_illegal_captures_solve;
+  solvers[STBiWoozlesRemoveIllegalCaptures] = &biwoozles_remove_illegal_captures_solve;
+  solvers[STHeffalumpsRemoveIllegalCaptures] = &heffalumps_remove_illegal_captures_solve;
+  solvers[STBiHeffalumpsRemoveIllegalCaptures] = &biheffalumps_remove_illegal_captures_solve;
+  solvers[STProvocateursRemoveUnobservedCaptures] = &provocateurs_remove_unobserved_captures_solve;
+  solvers[STLortapRemoveSupportedCaptures] = &lortap_remove_supported_captures_solve;
+  solvers[STPatrolRemoveUnsupportedCaptures] = &patrol_remove_unsupported_captures_solve;
+  solvers[STKoekoLegalityTester] = &koeko_legality_tester_solve;
+  solvers[STGridContactLegalityTester] = &contact_grid_legality_tester_solve;
+  solvers[STAntiKoekoLegalityTester] = &antikoeko_legality_tester_solve;
+  solvers[STNewKoekoRememberContact] = &newkoeko_remember_contact_solve;
+  solvers[STNewKoekoLegalityTester] = &newkoeko_legality_tester_solve;
+  solvers[STJiggerLegalityTester] = &jigger_legality_tester_solve;
+  solvers[STMonochromeRemoveNonMonochromeMoves] = &monochrome_remove_non_monochrome_moves_solve;
+  solvers[STBichromeRemoveNonBichromeMoves] = &bichrome_remove_non_bichrome_moves_solve;
+  solvers[STEdgeMoverRemoveIllegalMoves] = &edgemover_remove_illegal_moves_solve;
+  solvers[STShieldedKingsRemoveIllegalCaptures] = &shielded_kings_remove_illegal_captures_solve;
+  solvers[STSuperguardsRemoveIllegalCaptures] = &superguards_remove_illegal_captures_solve;
+  solvers[STGridRemoveIllegalMoves] = &grid_remove_illegal_moves_solve;
+  solvers[STOrthodoxRemoveIllegalMoves] = &orthodox_remove_illegal_moves_solve;
+  solvers[STUncapturableRemoveCaptures] = &uncapturable_remove_captures_solve;
+  solvers[STTakeAndMakeGenerateMake] = &take_and_make_generate_make_solve;
+  solvers[STTakeAndMakeAvoidPawnMakeToBaseLine] = &take_and_make_avoid_pawn_make_to_base_line_solve;
+  solvers[STWormholeRemoveIllegalCaptures] = &wormhole_remove_illegal_captures_solve;
+  solvers[STWormholeTransferer] = &wormhole_transferer_solve;
+  solvers[STExtinctionExtinctedTester] = &extinction_extincted_tester_solve;
+  solvers[STCastlingGeneratorTestDeparture] = &castling_generate_test_departure;
+  solvers[STNullMoveGenerator] = &null_move_generator_solve;
+  solvers[STRoleExchangeMoveGenerator] = &role_exchange_generator_solve;
+  solvers[STTrue] = &true_solve;
+  solvers[STFalse] = &false_solve;
+
+  /* move generators: */
+  solvers[STSingleBoxType3TMovesForPieceGenerator] = &singleboxtype3_generate_moves_for_piece;
+  solvers[STMadrasiMovesForPieceGenerator] = &madrasi_generate_moves_for_piece;
+  solvers[STPartialParalysisMovesForPieceGenerator] = &partial_paralysis_generate_moves_for_piece;
+  solvers[STEiffelMovesForPieceGenerator] = &eiffel_generate_moves_for_piece;
+  solvers[STDisparateMovesForPieceGenerator] = &disparate_generate_moves_for_piece;
+  solvers[STParalysingMovesForPieceGenerator] = &paralysing_generate_moves_for_piece;
+  solvers[STUltraPatrolMovesForPieceGenerator] = &ultrapatrol_generate_moves_for_piece;
+  solvers[STCentralMovesForPieceGenerator] = &central_generate_moves_for_piece;
+  solvers[STBeamtenMovesForPieceGenerator] = &beamten_generate_moves_for_piece;
+  solvers[STMarsCirceMoveGeneratorEnforceRexInclusive] = &marscirce_generate_moves_enforce_rex_exclusive;
+  solvers[STPhantomAvoidDuplicateMoves] = &phantom_avoid_duplicate_moves;
+  solvers[STPlusAdditionalCapturesForPieceGenerator] = &plus_generate_additional_captures_for_piece;
+  solvers[STMoveForPieceGeneratorTwoPaths] = &generate_moves_for_piece_two_paths;
+  solvers[STMarsCirceRememberRebirth] = &marscirce_remember_rebirth;
+  solvers[STMarsCirceRememberNoRebirth] = &marscirce_remember_no_rebirth;
+  solvers[STMarsCirceFixDeparture] = &marscirce_fix_departure;
+  solvers[STMarsCirceGenerateFromRebirthSquare] = &marscirce_generate_from_rebirth_square;
+  solvers[STMoveGeneratorRejectCaptures] = &move_generation_reject_captures;
+  solvers[STMoveGeneratorRejectNoncaptures] = &move_generation_reject_non_captures;
+  solvers[STVaultingKingsMovesForPieceGenerator] = &vaulting_kings_generate_moves_for_piece;
+  solvers[STTransmutingKingsMovesForPieceGenerator] = &transmuting_kings_generate_moves_for_piece;
+  solvers[STSuperTransmutingKingsMovesForPieceGenerator] = &supertransmuting_kings_generate_moves_for_piece;
+  solvers[STReflectiveKingsMovesForPieceGenerator] = &reflective_kings_generate_moves_for_piece;
+  solvers[STRokagogoMovesForPieceGeneratorFilter] = &rokagogo_filter_moves_for_piece;
+  solvers[STCastlingChessMovesForPieceGenerator] = &castlingchess_generate_moves_for_piece;
+  solvers[STPlatzwechselRochadeMovesForPieceGenerator] = &exchange_castling_generate_moves_for_piece;
+  solvers[STCastlingGenerator] = &castling_generator_generate_castling;
+  solvers[STMessignyMovesForPieceGenerator] = &messigny_generate_moves_for_piece;
+  solvers[STAnnanMovesForPieceGenerator] = &annan_generate_moves_for_piece;
+  solvers[STNannaMovesForPieceGenerator] = &nanna_generate_moves_for_piece;
+  solvers[STPointReflectionMovesForPieceGenerator] = &point_reflection_generate_moves_for_piece;
+  solvers[STFaceToFaceMovesForPieceGenerator] = &facetoface_generate_moves_for_piece;
+  solvers[STBackToBackMovesForPieceGenerator] = &backtoback_generate_moves_for_piece;
+  solvers[STCheekToCheekMovesForPieceGenerator] = &cheektocheek_generate_moves_for_piece;
+  solvers[STMovesForPieceBasedOnWalkGenerator] = &moves_for_piece_based_on_walk_generator_solve;
+  solvers[STMoveGenerationPostMoveIterator] = &move_generation_post_move_iterator_solve;
+
+  /* square observation */
+  solvers[STIsSquareObservedOrtho] = &is_square_observed_ortho_solve;
+  solvers[STPlusIsSquareObserved] = &plus_is_square_observed;
+  solvers[STMarsIterateObservers] = &marscirce_iterate_observers;
+  solvers[STMarsCirceIsSquareObservedEnforceRexInclusive] = &marscirce_is_square_observed_enforce_rex_exclusive;
+  solvers[STMarsIsSquareObserved] = &marscirce_is_square_observed;
+  solvers[STVaultingKingIsSquareObserved] = &vaulting_king_is_square_observed;
+  solvers[STTransmutingKingIsSquareObserved] = &transmuting_king_is_square_observed;
+  solvers[STTransmutingKingDetectNonTransmutation] = &transmuting_king_detect_non_transmutation;
+  solvers[STDetermineObserverWalk] = &determine_observer_walk;
+  solvers[STBicoloresTryBothSides] = &bicolores_try_both_sides;
+  solvers[STDontTryObservingWithNonExistingWalk] = &dont_try_observing_with_non_existing_walk;
+  solvers[STDontTryObservingWithNonExistingWalkBothSides] = &dont_try_observing_with_non_existing_walk_both_sides;
+  solvers[STOptimiseObservationsByQueenInitialiser] = &optimise_away_observations_by_queen_initialise;
+  solvers[STOptimiseObservationsByQueen] = &optimise_away_observations_by_queen;
+  solvers[STTrackBackFromTargetAccordingToObserverWalk] = &track_back_from_target_according_to_observer_walk;
+  solvers[STIsSquareObservedTwoPaths] = &is_square_observed_two_paths;
+  solvers[STSquareObservationPostMoveIterator] = &square_observation_post_move_iterator_solve;
+}
 
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
@@ -360,7 +996,6 @@
  *            n+3 no solution found in next branch
  *            (with n denominating solve_nr_remaining)
  */
-#include "pieces/attributes/total_invisible/consumption.h"
 void dispatch(slice_index si)
 {
   TraceFunctionEntry(__func__);
@@ -371,2187 +1006,18 @@ void dispatch(slice_index si)
   TraceEOL();
 
   if (total_invisible_number>0)
-  {
-    TraceConsumption();
-
-    assert(!current_consumption.is_king_unplaced[Black] || being_solved.king_square[Black]==initsquare);
-    assert(!current_consumption.is_king_unplaced[White] || being_solved.king_square[White]==initsquare);
-
-    assert(nbply<=ply_retro_move
-           || nr_total_invisbles_consumed()<=total_invisible_number);
-  }
-
-  switch (SLICE_TYPE(si))
-  {
-    case STQuodlibetStipulationModifier:
-      quodlibet_stipulation_modifier_solve(si);
-      break;
-
-    case STGoalIsEndStipulationModifier:
-      goal_is_end_stipulation_modifier_solve(si);
-      break;
-
-    case STWhiteToPlayStipulationModifier:
-      white_to_play_stipulation_modifier_solve(si);
-      break;
-
-    case STPostKeyPlayStipulationModifier:
-      post_key_play_stipulation_modifier_solve(si);
-      break;
-
-    case STStipulationStarterDetector:
-      stipulation_starter_detector_solve(si);
-      break;
-
-    case STStipulationCopier:
-      stipulation_copier_solve(si);
-      break;
-
-    case STProofSolverBuilder:
-      build_proof_solving_machinery(si);
-      break;
-
-    case STAToBSolverBuilder:
-      build_atob_solving_machinery(si);
-      break;
-
-    case STTwinIdAdjuster:
-      twin_id_adjuster_solve(si);
-      break;
-
-    case STConditionsResetter:
-      conditions_resetter_solve(si);
-      break;
-
-    case STOptionsResetter:
-      options_resetter_solve(si);
-      break;
-
-    case STProblemSolvingIncomplete:
-      problem_solving_incomplete_solve(si);
-      break;
-
-    case STPhaseSolvingIncomplete:
-      phase_solving_incomplete_solve(si);
-      break;
-
-    case STCommandLineOptionsParser:
-      command_line_options_parser_solve(si);
-      break;
-
-    case STInputPlainTextOpener:
-      input_plaintext_opener_solve(si);
-      break;
-
-    case STPlatformInitialiser:
-      platform_initialiser_solve(si);
-      break;
-
-    case STOutputLaTeXCloser:
-      output_latex_closer_solve(si);
-      break;
-
-    case STOutputPlainTextInstrumentSolversBuilder:
-      output_plaintext_instrument_solving_builder_solve(si);
-      break;
-
-    case STOutputPlainTextInstrumentSolvers:
-      output_plaintext_instrument_solving(si);
-      break;
-
-    case STOutputLaTeXInstrumentSolversBuilder:
-      output_latex_instrument_solving_builder_solve(si);
-      break;
-
-    case STOutputLaTeXInstrumentSolvers:
-      output_latex_instrument_solving(si);
-      break;
-
-    case STHashTableDimensioner:
-      hashtable_dimensioner_solve(si);
-      break;
-
-    case STTimerStarter:
-      timer_starter_solve(si);
-      break;
-
-    case STCheckDirInitialiser:
-      check_dir_initialiser_solve(si);
-      break;
-
-    case STOutputPlainTextWriter:
-      output_plaintext_writer_solve(si);
-      break;
-
-    case STInputPlainTextUserLanguageDetector:
-      input_plaintext_detect_user_language(si);
-      break;
-
-    case STInputPlainTextProblemsIterator:
-      input_plaintext_iterate_problems(si);
-      break;
-
-    case STEndOfStipulationSpecific:
-    case STOutputPlainTextStartOfTargetWriter:
-      pipe_solve_delegate(si);
-      break;
-
-    case STInputPlainTextProblemHandler:
-      input_plaintext_problem_handle(si);
-      break;
-
-    case STInputPlainTextInitialTwinReader:
-      input_plaintext_initial_twin_reader_solve(si);
-      break;
-
-    case STInputPlainTextTwinsHandler:
-      input_plaintext_twins_handle(si);
-      break;
-
-    case STSolvingMachineryIntroBuilder:
-      solving_machinery_intro_builder_solve(si);
-      break;
-
-    case STOutputPlainTextOptionNoboard:
-      output_plaintext_option_noboard_solve(si);
-      break;
-
-    case STOutputPlaintextTwinIntroWriterBuilder:
-      output_plaintext_twin_intro_writer_builder_solve(si);
-      break;
-
-    case STOutputLaTeXTwinningWriterBuilder:
-      output_latex_twinning_writer_builder_solve(si);
-      break;
-
-    case STStartOfCurrentTwin:
-      slices_deallocator_solve(si);
-      break;
-
-    case STDuplexSolver:
-      duplex_solve(si);
-      break;
-
-    case STHalfDuplexSolver:
-      half_duplex_solve(si);
-      break;
-
-    case STCreateBuilderSetupPly:
-      create_builder_setup_ply_solve(si);
-      break;
-
-    case STPieceWalkCacheInitialiser:
-      piece_walk_caches_initialiser_solve(si);
-      break;
-
-    case STPiecesCounter:
-      pieces_counter_solve(si);
-      break;
-
-    case STPiecesFlagsInitialiser:
-      initialise_piece_flags_solve(si);
-      break;
-
-    case STRoyalsLocator:
-      royals_locator_solve(si);
-      break;
-
-    case STProofgameVerifyUniqueGoal:
-      proof_verify_unique_goal_solve(si);
-      break;
-
-    case STProofgameStartPositionInitialiser:
-      proof_initialise_start_position(si);
-      break;
-
-    case STProofSolver:
-      proof_solve(si);
-      break;
-
-    case STInputVerification:
-      verify_position(si);
-      break;
-
-    case STMoveEffectsJournalReset:
-      move_effect_journal_reset(si);
-      break;
-
-    case STSolversBuilder1:
-      build_solvers1(si);
-      break;
-
-    case STSolversBuilder2:
-      build_solvers2(si);
-      break;
-
-    case STProxyResolver:
-      proxies_resolve(si);
-      break;
-
-    case STSlackLengthAdjuster:
-      adjust_slack_length(si);
-      break;
-
-    case STThreatSolver:
-      threat_solver_solve(si);
-      break;
-
-    case STDummyMove:
-      dummy_move_solve(si);
-      break;
-
-    case STThreatCollector:
-      threat_collector_solve(si);
-      break;
-
-    case STThreatEnforcer:
-      threat_enforcer_solve(si);
-      break;
-
-    case STThreatDefeatedTester:
-      threat_defeated_tester_solve(si);
-      break;
-
-    case STOutputPlainTextThreatWriter:
-      output_plaintext_tree_threat_writer_solve(si);
-      break;
-
-    case STOutputPlainTextZugzwangByDummyMoveCheckWriter:
-      output_plaintext_tree_zugzwang_by_dummy_move_check_writer_solve(si);
-      break;
-
-    case STOutputPlainTextZugzwangWriter:
-      output_plaintext_tree_zugzwang_writer_solve(si);
-      break;
-
-    case STOutputPlainTextKeyWriter:
-      output_plaintext_tree_key_writer_solve(si);
-      break;
-
-    case STOutputPlainTextTryWriter:
-      output_plaintext_tree_try_writer_solve(si);
-      break;
-
-    case STRefutationsAllocator:
-      refutations_allocator_solve(si);
-      break;
-
-    case STRefutationsSolver:
-      refutations_solver_solve(si);
-      break;
-
-    case STOutputPlainTextRefutationsIntroWriter:
-      output_plaintext_tree_refutations_intro_writer_solve(si);
-      break;
-
-    case STRefutationsAvoider:
-      refutations_avoider_solve(si);
-      break;
-
-    case STRefutationsFilter:
-      refutations_filter_solve(si);
-      break;
-
-    case STOutputPlaintextTreeRefutingVariationWriter:
-      output_plaintext_tree_refuting_variation_writer_solve(si);
-      break;
-
-    case STOutputPlaintextLineRefutingVariationWriter:
-      output_plaintext_line_refuting_variation_writer_solve(si);
-      break;
-
-    case STOutputPlainTextMoveWriter:
-      output_plaintext_tree_move_writer_solve(si);
-      break;
-
-    case STTrivialEndFilter:
-      trivial_end_filter_solve(si);
-      break;
-
-    case STNoShortVariations:
-      no_short_variations_solve(si);
-      break;
-
-    case STOr:
-      or_solve(si);
-      break;
-
-    case STFindShortest:
-      find_shortest_solve(si);
-      break;
-
-    case STMoveGenerator:
-      move_generator_solve(si);
-      break;
-
-    case STForEachAttack:
-      for_each_attack_solve(si);
-      break;
-
-    case STFindAttack:
-      find_attack_solve(si);
-      break;
-
-    case STForEachDefense:
-      for_each_defense_solve(si);
-      break;
-
-    case STFindDefense:
-      find_defense_solve(si);
-      break;
-
-    case STNullMovePlayer:
-      null_move_player_solve(si);
-      break;
-
-    case STRoleExchangeMovePlayer:
-      role_exchange_player_solve(si);
-      break;
-
-    case STPostMoveIterationInitialiser:
-      move_execution_post_move_iterator_solve(si);
-      break;
-
-    case STMoveEffectJournalUndoer:
-      move_effect_journal_undoer_solve(si);
-      break;
-
-    case STMessignyMovePlayer:
-      messigny_move_player_solve(si);
-      break;
-
-    case STCastlingPlayer:
-      castling_player_solve(si);
-      break;
-
-    case STMovePlayer:
-      move_player_solve(si);
-      break;
-
-    case STEnPassantAdjuster:
-      en_passant_adjuster_solve(si);
-      break;
-
-    case STEinsteinEnPassantAdjuster:
-      einstein_en_passant_adjuster_solve(si);
-      break;
-
-    case STPawnPromoter:
-      pawn_promoter_solve(si);
-      break;
-
-    case STMakeTakeResetMoveIdsCastlingAsMakeInMoveGeneration:
-      make_and_take_reset_move_ids_castling_as_make_in_move_generation(si);
-      break;
-
-    case STMakeTakeGenerateCapturesWalkByWalk:
-      make_and_take_generate_captures_by_walk_solve(si);
-      break;
-
-    case STMakeTakeMoveCastlingPartner:
-      make_and_take_move_castling_partner(si);
-      break;
-
-    case STBoleroGenerateMovesWalkByWalk:
-      bolero_generate_moves(si);
-      break;
-
-    case STMarsCirceMoveToRebirthSquare:
-      marscirce_move_to_rebirth_square_solve(si);
-      break;
-
-    case STKamikazeCapturingPieceRemover:
-      kamikaze_capturing_piece_remover_solve(si);
-      break;
-
-    case STHaanChessHoleInserter:
-      haan_chess_hole_inserter_solve(si);
-      break;
-
-    case STCastlingChessMovePlayer:
-      castling_chess_move_player_solve(si);
-      break;
-
-    case STExchangeCastlingMovePlayer:
-      exchange_castling_move_player_solve(si);
-      break;
-
-    case STSuperTransmutingKingTransmuter:
-      supertransmuting_kings_transmuter_solve(si);
-      break;
-
-    case STSuperTransmutingKingMoveGenerationFilter:
-      supertransmuting_kings_move_generation_filter_solve(si);
-      break;
-
-    case STAMUAttackCounter:
-      amu_attack_counter_solve(si);
-      break;
-
-    case STMutualCastlingRightsAdjuster:
-      mutual_castling_rights_adjuster_solve(si);
-      break;
-
-    case STImitatorMover:
-      imitator_mover_solve(si);
-      break;
-
-    case STImitatorRemoveIllegalMoves:
-      imitator_remove_illegal_moves_solve(si);
-      break;
-
-    case STImitatorDetectIllegalMoves:
-      imitator_detect_illegal_moves_solve(si);
-      break;
-
-    case STPawnToImitatorPromoter:
-      imitator_pawn_promoter_solve(si);
-      break;
-
-    case STAttackPlayed:
-      attack_played_solve(si);
-      break;
-
-#if defined(DOTRACE)
-    case STMoveTracer:
-      move_tracer_solve(si);
-      break;
-#endif
-
-#if defined(DOMEASURE)
-    case STMoveCounter:
-      move_counter_solve(si);
-      break;
-
-    case STCountersWriter:
-      counters_writer_solve(si);
-      break;
-#endif
-
-    case STOrthodoxMatingMoveGenerator:
-      orthodox_mating_move_generator_solve(si);
-      break;
-
-    case STOrthodoxMatingKingContactGenerator:
-      orthodox_mating_king_contact_generator_solve(si);
-      break;
-
-    case STDeadEnd:
-    case STDeadEndGoal:
-      dead_end_solve(si);
-      break;
-
-    case STMinLengthOptimiser:
-      min_length_optimiser_solve(si);
-      break;
-
-    case STForkOnRemaining:
-      fork_on_remaining_solve(si);
-      break;
-
-    case STHashOpener:
-      hash_opener_solve(si);
-      break;
-
-    case STAttackHashed:
-      attack_hashed_solve(si);
-      break;
-
-    case STAttackHashedTester:
-      attack_hashed_tester_solve(si);
-      break;
-
-    case STHelpHashed:
-      help_hashed_solve(si);
-      break;
-
-    case STHelpHashedTester:
-      help_hashed_tester_solve(si);
-      break;
-
-    case STEndOfBranch:
-    case STEndOfBranchForced:
-    case STEndOfBranchTester:
-      end_of_branch_solve(si);
-      break;
-
-    case STEndOfBranchGoal:
-    case STEndOfBranchGoalImmobile:
-    case STEndOfBranchGoalTester:
-      end_of_branch_goal_solve(si);
-      break;
-
-    case STGoalReachedTester:
-      goal_reached_tester_solve(si);
-      break;
-
-    case STAvoidUnsolvable:
-      avoid_unsolvable_solve(si);
-      break;
-
-    case STResetUnsolvable:
-      reset_unsolvable_solve(si);
-      break;
-
-    case STLearnUnsolvable:
-      learn_unsolvable_solve(si);
-      break;
-
-    case STConstraintSolver:
-    case STConstraintTester:
-    case STGoalConstraintTester:
-      constraint_solve(si);
-      break;
-
-    case STSelfCheckGuard:
-    case STExclusiveChessGoalReachingMoveCounterSelfCheckGuard:
-      selfcheck_guard_solve(si);
-      break;
-
-    case STKeepMatingFilter:
-      keepmating_filter_solve(si);
-      break;
-
-    case STOutputPlaintextTreeCheckWriter:
-      output_plaintext_tree_check_writer_solve(si);
-      break;
-
-    case STOutputPlainTextRefutationWriter:
-      output_plaintext_tree_refutation_writer_solve(si);
-      break;
-
-    case STDoubleMateFilter:
-      doublemate_filter_solve(si);
-      break;
-
-    case STCounterMateFilter:
-      countermate_filter_solve(si);
-      break;
-
-    case STEnPassantFilter:
-      enpassant_filter_solve(si);
-      break;
-
-    case STEnPassantRemoveNonReachers:
-      enpassant_remove_non_reachers_solve(si);
-      break;
-
-    case STCastlingFilter:
-      castling_filter_solve(si);
-      break;
-
-    case STCastlingRemoveNonReachers:
-      castling_remove_non_reachers_solve(si);
-      break;
-
-    case STPrerequisiteOptimiser:
-      goal_prerequisite_optimiser_solve(si);
-      break;
-
-    case STChess81RemoveNonReachers:
-      chess81_remove_non_reachers_solve(si);
-      break;
-
-    case STCaptureRemoveNonReachers:
-      capture_remove_non_reachers_solve(si);
-      break;
-
-    case STTargetRemoveNonReachers:
-      target_remove_non_reachers_solve(si);
-      break;
-
-    case STDetectMoveRetracted:
-      detect_move_retracted_solve(si);
-      break;
-
-    case STRetractionPrioriser:
-      priorise_retraction_solve(si);
-      break;
-
-    case STOutputPlaintextProblemWriter:
-      output_plaintext_problem_writer_solve(si);
-      break;
-
-    case STOutputPlaintextGoalWriter:
-      output_plaintext_goal_writer_solve(si);
-      break;
-
-    case STOutputPlaintextConstraintWriter:
-      output_plaintext_constraint_writer_solve(si);
-      break;
-
-    case STOutputPlaintextLineLineWriter:
-      output_plaintext_line_line_writer_solve(si);
-      break;
-
-    case STOutputLaTeXGoalWriter:
-      output_latex_goal_writer_solve(si);
-      break;
-
-    case STOutputLaTeXConstraintWriter:
-      output_latex_constraint_writer_solve(si);
-      break;
-
-    case STOutputLaTeXLineLineWriter:
-      output_latex_line_line_writer_solve(si);
-      break;
-
-    case STOutputLaTeXProblemWriter:
-      output_latex_problem_writer_solve(si);
-      break;
-
-    case STOutputLaTeXProblemIntroWriter:
-      output_latex_problem_intro_writer_solve(si);
-      break;
-
-    case STOutputLaTeXTwinningWriter:
-      output_latex_write_twinning(si);
-      break;
-
-    case STOutputLaTeXKeyWriter:
-      output_latex_tree_key_writer_solve(si);
-      break;
-
-    case STOutputLaTeXMoveWriter:
-      output_latex_tree_move_writer_solve(si);
-      break;
-
-    case STOutputLaTeXRefutationWriter:
-      output_latex_tree_refutation_writer_solve(si);
-      break;
-
-    case STOutputLaTeXThreatWriter:
-      output_latex_tree_threat_writer_solve(si);
-      break;
-
-    case STOutputLaTeXTreeCheckWriter:
-      output_latex_tree_check_writer_solve(si);
-      break;
-
-    case STOutputLaTeXTreeRefutingVariationWriter:
-      output_latex_tree_refuting_variation_writer_solve(si);
-      break;
-
-    case STOutputLaTeXTryWriter:
-      output_latex_tree_try_writer_solve(si);
-      break;
-
-    case STOutputLaTeXZugzwangByDummyMoveCheckWriter:
-      output_latex_tree_zugzwang_by_dummy_move_check_writer_solve(si);
-      break;
-
-    case STOutputLaTeXZugzwangWriter:
-      output_latex_tree_zugzwang_writer_solve(si);
-      break;
-
-    case STBGLEnforcer:
-      bgl_enforcer_solve(si);
-      break;
-
-    case STBGLAdjuster:
-      bgl_adjuster_solve(si);
-      break;
-
-    case STMasandRecolorer:
-      masand_recolorer_solve(si);
-      break;
-
-    case STMasandGeneralisedRecolorer:
-      masand_generalised_recolorer_solve(si);
-      break;
-
-    case STInfluencerWalkChanger:
-      influencer_walk_changer_solve(si);
-      break;
-
-    case STActuatedRevolvingCentre:
-      actuated_revolving_centre_solve(si);
-      break;
-
-    case STActuatedRevolvingBoard:
-      actuated_revolving_board_solve(si);
-      break;
-
-    case STRepublicanKingPlacer:
-      republican_king_placer_solve(si);
-      break;
-
-    case STRepublicanType1DeadEnd:
-      republican_type1_dead_end_solve(si);
-      break;
-
-    case STBretonApplier:
-    case STBretonPopeyeApplier:
-      breton_applier_solve(si);
-      break;
-
-    case STCirceCaptureFork:
-      circe_capture_fork_solve(si);
-      break;
-
-    case STCircePreventKingRebirth:
-      circe_prevent_king_rebirth_solve(si);
-      break;
-
-    case STCirceInitialiseRelevantFromReborn:
-      circe_initialise_relevant_from_reborn(si);
-      break;
-
-    case STCirceInitialiseFromCurrentMove:
-      circe_make_current_move_relevant_solve(si);
-      break;
-
-    case STCirceInitialiseFromLastMove:
-      circe_make_last_move_relevant_solve(si);
-      break;
-
-    case STCirceInitialiseRebornFromCapturee:
-      circe_initialise_reborn_from_capturee_solve(si);
-      break;
-
-    case STCirceCloneDetermineRebornWalk:
-      circe_clone_determine_reborn_walk_solve(si);
-      break;
-
-    case STAntiCloneCirceDetermineRebornWalk:
-      anti_clone_circe_determine_reborn_walk_solve(si);
-      break;
-
-    case STCirceDoubleAgentsAdaptRebornSide:
-      circe_doubleagents_adapt_reborn_side_solve(si);
-      break;
-
-    case STChameleonCirceAdaptRebornWalk:
-      chameleon_circe_adapt_reborn_walk_solve(si);
-      break;
-
-    case STCirceEinsteinAdjustRebornWalk:
-      circe_einstein_adjust_reborn_walk_solve(si);
-      break;
-
-    case STCirceReverseEinsteinAdjustRebornWalk:
-      circe_reverse_einstein_adjust_reborn_walk_solve(si);
-      break;
-
-    case STCirceCouscousMakeCapturerRelevant:
-      circe_couscous_make_capturer_relevant_solve(si);
-      break;
-
-    case STAnticirceCouscousMakeCaptureeRelevant:
-      anticirce_couscous_make_capturee_relevant_solve(si);
-      break;
-
-    case STMirrorCirceOverrideRelevantSide:
-      mirror_circe_override_relevant_side_solve(si);
-      break;
-
-    case STCirceDetermineRebirthSquare:
-      circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STCirceFrischaufAdjustRebirthSquare:
-      frischauf_adjust_rebirth_square_solve(si);
-      break;
-
-    case STCirceGlasgowAdjustRebirthSquare:
-      circe_glasgow_adjust_rebirth_square_solve(si);
-      break;
-
-    case STFileCirceDetermineRebirthSquare:
-      file_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STCirceDiametralAdjustRebirthSquare:
-      circe_diametral_adjust_rebirth_square_solve(si);
-      break;
-
-    case STCirceVerticalMirrorAdjustRebirthSquare:
-      circe_verticalmirror_adjust_rebirth_square_solve(si);
-      break;
-
-    case STRankCirceOverrideRelevantSide:
-      rank_circe_override_relevant_side_solve(si);
-      break;
-
-    case STRankCirceProjectRebirthSquare:
-      rank_circe_adjust_rebirth_square_solve(si);
-      break;
-
-    case STTakeMakeCirceDetermineRebirthSquares:
-      take_make_circe_determine_rebirth_squares_solve(si);
-      break;
-
-    case STTakeMakeCirceCollectRebirthSquares:
-      take_make_circe_collect_rebirth_squares_solve(si);
-      break;
-
-    case STAntipodesCirceDetermineRebirthSquare:
-      antipodes_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STSymmetryCirceDetermineRebirthSquare:
-      symmetry_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STVerticalSymmetryCirceDetermineRebirthSquare:
-      vertical_symmetry_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STHorizontalSymmetryCirceDetermineRebirthSquare:
-      horizontal_symmetry_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STPWCDetermineRebirthSquare:
-      pwc_determine_rebirth_square_solve(si);
-      break;
-
-    case STDiagramCirceDetermineRebirthSquare:
-      diagram_circe_determine_rebirth_square_solve(si);
-      break;
-
-    case STContactGridAvoidCirceRebirth:
-      contact_grid_avoid_circe_rebirth(si);
-      break;
-
-    case STGenevaStopCaptureFromRebirthSquare:
-      geneva_stop_catpure_from_rebirth_square_solve(si);
-      break;
-
-    case STCirceTestRebirthSquareEmpty:
-      circe_test_rebirth_square_empty_solve(si);
-      break;
-
-    case STCircePlaceReborn:
-      circe_place_reborn_solve(si);
-      break;
-
-    case STCirceDoneWithRebirth:
-      circe_done_with_rebirth(si);
-      break;
-
-    case STAprilCaptureFork:
-      april_chess_fork_solve(si);
-      break;
-
-    case STSuperCirceNoRebirthFork:
-      supercirce_no_rebirth_fork_solve(si);
-      break;
-
-    case STSuperCirceDetermineRebirthSquare:
-      supercirce_determine_rebirth_square_solve(si);
-      break;
-
-    case STSupercircePreventRebirthOnNonEmptySquare:
-      supercirce_prevent_rebirth_on_non_empty_square_solve(si);
-      break;
-
-    case STCirceVolageRecolorer:
-      circe_volage_recolorer_solve(si);
-      break;
-
-    case STCirceParrainThreatFork:
-      circe_parrain_threat_fork_solve(si);
-      break;
-
-    case STCirceParrainDetermineRebirth:
-      circe_parrain_determine_rebirth_solve(si);
-      break;
-
-    case STCirceContraparrainDetermineRebirth:
-      circe_contraparrain_determine_rebirth_solve(si);
-      break;
-
-    case STCirceCageNoCageFork:
-      circe_cage_no_cage_fork_solve(si);
-      break;
-
-    case STCirceCageCageTester:
-      circe_cage_cage_tester_solve(si);
-      break;
+    check_total_invisible_consumption();
 
-    case STCageCirceFutileCapturesRemover:
-      circe_cage_futile_captures_remover_solve(si);
-      break;
+  if (statistics_are_collected)
+    statistics_enter_slice(si);
 
-    case STSeriesCapturePlyRewinder:
-      series_capture_ply_rewinder_solve(si);
-      break;
+  (*solvers[SLICE_TYPE(si)])(si);
 
-    case STSeriesCaptureFork:
-      series_capture_fork_solve(si);
-      break;
-
-    case STSeriesCaptureJournalFixer:
-      series_capture_journal_fixer_solve(si);
-      break;
-
-    case STSentinellesInserter:
-      sentinelles_inserter_solve(si);
-      break;
-
-    case STMagicViewsInitialiser:
-      magic_views_initialiser_solve(si);
-      break;
-
-    case STMagicPiecesRecolorer:
-      magic_pieces_recolorer_solve(si);
-      break;
-
-    case STHauntedChessGhostSummoner:
-      haunted_chess_ghost_summoner_solve(si);
-      break;
-
-    case STHauntedChessGhostRememberer:
-      haunted_chess_ghost_rememberer_solve(si);
-      break;
-
-    case STGhostChessGhostRememberer:
-      ghost_chess_ghost_rememberer_solve(si);
-      break;
-
-    case STAndernachSideChanger:
-      andernach_side_changer_solve(si);
-      break;
-
-    case STAntiAndernachSideChanger:
-      antiandernach_side_changer_solve(si);
-      break;
-
-    case STDarksideSideChanger:
-      darkside_side_changer_solve(si);
-      break;
-
-    case STChameleonPursuitSideChanger:
-      chameleon_pursuit_side_changer_solve(si);
-      break;
-
-    case STLostPiecesRemover:
-      lostpieces_remover_solve(si);
-      break;
-
-    case STNorskRemoveIllegalCaptures:
-      norsk_remove_illegal_captures_solve(si);
-      break;
-
-    case STNorskArrivingAdjuster:
-      norsk_arriving_adjuster_solve(si);
-      break;
-
-    case STProteanPawnAdjuster:
-      protean_pawn_adjuster_solve(si);
-      break;
-
-    case STEinsteinArrivingAdjuster:
-      einstein_moving_adjuster_solve(si);
-      break;
-
-    case STReverseEinsteinArrivingAdjuster:
-      reverse_einstein_moving_adjuster_solve(si);
-      break;
-
-    case STAntiEinsteinArrivingAdjuster:
-      anti_einstein_moving_adjuster_solve(si);
-      break;
-
-    case STTraitorSideChanger:
-      traitor_side_changer_solve(si);
-      break;
-
-    case STVolageSideChanger:
-      volage_side_changer_solve(si);
-      break;
-
-    case STMagicSquareSideChanger:
-    case STMagicSquareType2SideChanger:
-      magic_square_side_changer_solve(si);
-      break;
-
-    case STMagicSquareType2AnticirceRelevantSideAdapter:
-      magic_square_anticirce_relevant_side_adapter_solve(si);
-      break;
-
-    case STTibetSideChanger:
-      tibet_solve(si);
-      break;
-
-    case STDoubleTibetSideChanger:
-      double_tibet_solve(si);
-      break;
-
-    case STDegradierungDegrader:
-      degradierung_degrader_solve(si);
-      break;
-
-    case STChameleonChangePromoteeInto:
-      chameleon_change_promotee_into_solve(si);
-      break;
-
-    case STChameleonArrivingAdjuster:
-      chameleon_arriving_adjuster_solve(si);
-      break;
-
-    case STChameleonChessArrivingAdjuster:
-      chameleon_chess_arriving_adjuster_solve(si);
-      break;
-
-    case STLineChameleonArrivingAdjuster:
-      line_chameleon_arriving_adjuster_solve(si);
-      break;
-
-    case STFrischaufPromoteeMarker:
-      frischauf_promotee_marker_solve(si);
-      break;
-
-    case STPiecesHalfNeutralRecolorer:
-      half_neutral_recolorer_solve(si);
-      break;
-
-    case STKobulKingSubstitutor:
-      kobul_king_substitutor_solve(si);
-      break;
-
-    case STSnekSubstitutor:
-      snek_substitutor_solve(si);
-      break;
-
-    case STSnekCircleSubstitutor:
-      snek_circle_substitutor_solve(si);
-      break;
-
-    case STDuellistsRememberDuellist:
-      duellists_remember_duellist_solve(si);
-      break;
-
-    case STSingleboxType2LatentPawnSelector:
-      singlebox_type2_latent_pawn_selector_solve(si);
-      break;
-
-    case STSingleboxType2LatentPawnPromoter:
-      singlebox_type2_latent_pawn_promoter_solve(si);
-      break;
-
-    case STCirceKamikazeCaptureFork:
-      circe_kamikaze_capture_fork_solve(si);
-      break;
-
-    case STAnticirceInitialiseRebornFromCapturer:
-      circe_initialise_reborn_from_capturer_solve(si);
-      break;
-
-    case STMarscirceInitialiseRebornFromGenerated:
-      marscirce_initialise_reborn_from_generated_solve(si);
-      break;
-
-    case STGenevaInitialiseRebornFromCapturer:
-      geneva_initialise_reborn_from_capturer_solve(si);
-      break;
-
-    case STAnticirceCheylanFilter:
-      anticirce_cheylan_filter_solve(si);
-      break;
-
-    case STAnticirceRemoveCapturer:
-      anticirce_remove_capturer_solve(si);
-      break;
-
-    case STMarscirceRemoveCapturer:
-      marscirce_remove_capturer_solve(si);
-      break;
-
-    case STFootballChessSubsitutor:
-      football_chess_substitutor_solve(si);
-      break;
-
-    case STRefutationsCollector:
-      refutations_collector_solve(si);
-      break;
-
-    case STMinLengthGuard:
-      min_length_guard_solve(si);
-      break;
-
-    case STDegenerateTree:
-      degenerate_tree_solve(si);
-      break;
-
-    case STMaxNrNonTrivialCounter:
-      max_nr_nontrivial_counter_solve(si);
-      break;
-
-    case STKillerDefenseCollector:
-      killer_defense_collector_solve(si);
-      break;
-
-    case STFindByIncreasingLength:
-      find_by_increasing_length_solve(si);
-      break;
-
-    case STHelpMovePlayed:
-      help_move_played_solve(si);
-      break;
-
-    case STIntelligentMovesLeftInitialiser:
-      intelligent_moves_left_initialiser_solve(si);
-      break;
-
-    case STRestartGuardIntelligent:
-      restart_guard_intelligent_solve(si);
-      break;
-
-    case STIntelligentTargetCounter:
-      intelligent_target_counter_solve(si);
-      break;
-
-    case STIntelligentFilter:
-      intelligent_filter_solve(si);
-      break;
-
-    case STIntelligentFlightsGuarder:
-      intelligent_guard_flights(si);
-      break;
-
-    case STIntelligentFlightsBlocker:
-      intelligent_find_and_block_flights(si);
-      break;
-
-    case STIntelligentMateTargetPositionTester:
-      intelligent_mate_test_target_position(si);
-      break;
-
-    case STIntelligentStalemateTargetPositionTester:
-      intelligent_stalemate_test_target_position(si);
-      break;
-
-    case STIntelligentProof:
-      intelligent_proof_solve(si);
-      break;
-
-    case STIntelligentLimitNrSolutionsPerTargetPosLimiter:
-      intelligent_limit_nr_solutions_per_target_position_solve(si);
-      break;
-
-    case STGoalReachableGuardFilterMate:
-      goalreachable_guard_mate_solve(si);
-      break;
-
-    case STGoalReachableGuardFilterStalemate:
-      goalreachable_guard_stalemate_solve(si);
-      break;
-
-    case STGoalReachableGuardFilterProof:
-      goalreachable_guard_proofgame_solve(si);
-      break;
-
-    case STGoalReachableGuardFilterProofFairy:
-      goalreachable_guard_proofgame_fairy_solve(si);
-      break;
-
-    case STRestartGuard:
-      restart_guard_solve(si);
-      break;
-
-    case STRestartGuardNested:
-      restart_guard_nested_solve(si);
-      break;
-
-    case STMaxTimeProblemInstrumenter:
-      maxtime_problem_instrumenter_solve(si);
-      break;
-
-    case STMaxTimeSetter:
-      maxtime_set(si);
-      break;
-
-    case STMaxTimeGuard:
-      maxtime_guard_solve(si);
-      break;
-
-    case STMaxSolutionsProblemInstrumenter:
-      maxsolutions_problem_instrumenter_solve(si);
-      break;
-
-    case STMaxSolutionsSolvingInstrumenter:
-      maxsolutions_solving_instrumenter_solve(si);
-      break;
-
-    case STMaxSolutionsCounter:
-      maxsolutions_counter_solve(si);
-      break;
-
-    case STMaxSolutionsGuard:
-      maxsolutions_guard_solve(si);
-      break;
-
-    case STStopOnShortSolutionsSolvingInstrumenter:
-      stoponshortsolutions_solving_instrumenter_solve(si);
-      break;
-
-    case STStopOnShortSolutionsFilter:
-      stoponshortsolutions_solve(si);
-      break;
-
-    case STIfThenElse:
-      if_then_else_solve(si);
-      break;
-
-    case STFlightsquaresCounter:
-      flightsquares_counter_solve(si);
-      break;
-
-    case STKingMoveGenerator:
-      king_move_generator_solve(si);
-      break;
-
-    case STNonKingMoveGenerator:
-      non_king_move_generator_solve(si);
-      break;
-
-    case STUltraMummerMeasurerDeadend:
-      ultra_mummer_measurer_deadend_solve(si);
-      break;
-
-    case STLegalAttackCounter:
-    case STAnyMoveCounter:
-      legal_attack_counter_solve(si);
-      break;
-
-    case STLegalDefenseCounter:
-      legal_defense_counter_solve(si);
-      break;
-
-    case STCaptureCounter:
-      capture_counter_solve(si);
-      break;
-
-    case STOhneschachStopIfCheck:
-      ohneschach_stop_if_check_solve(si);
-      break;
-
-    case STOhneschachStopIfCheckAndNotMate:
-      ohneschach_stop_if_check_and_not_mate_solve(si);
-      break;
-
-    case STOhneschachDetectUndecidableGoal:
-      ohneschach_detect_undecidable_goal_solve(si);
-      break;
-
-    case STRecursionStopper:
-      recursion_stopper_solve(si);
-      break;
-
-    case STSinglePieceMoveGenerator:
-      single_piece_move_generator_solve(si);
-      break;
-
-    case STCastlingRightsAdjuster:
-      castling_rights_adjuster_solve(si);
-      break;
-
-    case STOpponentMovesCounter:
-      opponent_moves_counter_solve(si);
-      break;
-
-    case STOpponentMovesFewMovesPrioriser:
-      opponent_moves_few_moves_prioriser_solve(si);
-      break;
-
-    case STIntelligentImmobilisationCounter:
-      intelligent_immobilisation_counter_solve(si);
-      break;
-
-    case STIntelligentDuplicateAvoider:
-      intelligent_duplicate_avoider_solve(si);
-      break;
-
-    case STIntelligentSolutionRememberer:
-      intelligent_solution_rememberer_solve(si);
-      break;
-
-    case STIntelligentSolutionsPerTargetPosProblemInstrumenter:
-      intelligent_nr_solutions_per_target_position_problem_instrumenter_solve(si);
-      break;
-
-    case STIntelligentSolutionsPerTargetPosSolvingInstrumenter:
-      intelligent_nr_solutions_per_target_position_solving_instrumenter_solve(si);
-      break;
-
-    case STIntelligentSolutionsPerTargetPosInitialiser:
-      intelligent_nr_solutions_per_target_position_initialiser_solve(si);
-      break;
-
-    case STIntelligentSolutionsPerTargetPosCounter:
-      intelligent_nr_solutions_per_target_position_counter_solve(si);
-      break;
-
-    case STSetplayFork:
-      setplay_fork_solve(si);
-      break;
-
-    case STAttackAdapter:
-      attack_adapter_solve(si);
-      break;
-
-    case STDefenseAdapter:
-      defense_adapter_solve(si);
-      break;
-
-    case STHelpAdapter:
-      help_adapter_solve(si);
-      break;
-
-    case STAnd:
-      and_solve(si);
-      break;
-
-    case STNot:
-      not_solve(si);
-      break;
-
-    case STMoveInverter:
-    case STMoveInverterSetPlay:
-      move_inverter_solve(si);
-      break;
-
-    case STRetroStartRetractionPly:
-      retro_start_retraction_ply(si);
-      break;
-
-    case STRetroPlayNullMove:
-      retro_play_null_move(si);
-      break;
-
-    case STRetroRetractLastCapture:
-      circe_parrain_undo_retro_capture(si);
-      break;
-
-    case STRetroRedoLastCapture:
-      circe_parrain_redo_retro_capture(si);
-      break;
-
-    case STRetroUndoLastPawnMultistep:
-      en_passant_undo_multistep(si);
-      break;
-
-    case STRetroRedoLastPawnMultistep:
-      en_passant_redo_multistep(si);
-      break;
-
-    case STRetroStartRetroMovePly:
-      retro_start_retro_move_ply(si);
-      break;
-
-    case STMaxSolutionsInitialiser:
-      maxsolutions_initialiser_solve(si);
-      break;
-
-    case STStopOnShortSolutionsProblemInstrumenter:
-      stoponshortsolutions_problem_instrumenter_solve(si);
-      break;
-
-    case STStopOnShortSolutionsWasShortSolutionFound:
-      stoponshortsolutions_was_short_solution_found_solve(si);
-      break;
-
-    case STOutputPlaintextZeropositionIntroWriter:
-      output_plaintext_write_zeroposition_intro(si);
-      break;
-
-    case STOutputPlaintextTwinIntroWriter:
-      output_plaintext_write_twin_intro(si);
-      break;
-
-    case STOutputPlainTextMetaWriter:
-      output_plaintext_write_meta(si);
-      break;
-
-    case STOutputPlainTextBoardWriter:
-      output_plaintext_write_board(si);
-      break;
-
-    case STOutputPlainTextPieceCountsWriter:
-      output_plaintext_write_piece_counts(si);
-      break;
-
-    case STOutputPlainTextRoyalPiecePositionsWriter:
-      output_plaintext_write_royal_piece_positions(si);
-      break;
-
-    case STOutputPlainTextNonRoyalAttributesWriter:
-      output_plaintext_write_non_royal_attributes(si);
-      break;
-
-    case STOutputPlainTextConditionsWriter:
-      output_plaintext_write_conditions(si);
-      break;
-
-    case STOutputPlainTextMutuallyExclusiveCastlingsWriter:
-      output_plaintext_write_mutually_exclusive_castlings(si);
-      break;
-
-    case STOutputPlainTextDuplexWriter:
-      output_plaintext_write_duplex(si);
-      break;
-
-    case STOutputPlainTextHalfDuplexWriter:
-      output_plaintext_write_halfduplex(si);
-      break;
-
-    case STOutputPlainTextQuodlibetWriter:
-      output_plaintext_write_quodlibet(si);
-      break;
-
-    case STOutputPlainTextAToBIntraWriter:
-      output_plaintext_write_atob_intra(si);
-      break;
-
-    case STOutputPlainTextStipulationWriter:
-      output_plaintext_write_stipulation(si);
-      break;
-
-    case STOutputPlainTextGridWriter:
-      output_plaintext_write_grid(si);
-      break;
-
-    case STOutputPlainTextEndOfPositionWriters:
-      output_plaintext_end_of_position_writers_solve(si);
-      break;
-
-    case STZeroPositionInitialiser:
-      zeroposition_initialiser_solve(si);
-      break;
-
-    case STZeropositionSolvingStopper:
-      zeroposition_solving_stopper_solve(si);
-      break;
-
-    case STIllegalSelfcheckWriter:
-      illegal_selfcheck_writer_solve(si);
-      break;
-
-    case STOutputPlainTextEndOfPhaseWriter:
-      output_plaintext_end_of_phase_writer_solve(si);
-      break;
-
-    case STOutputPlaintextMoveInversionCounter:
-    case STOutputPlaintextMoveInversionCounterSetPlay:
-      output_plaintext_move_inversion_counter_solve(si);
-      break;
-
-    case STOutputPlaintextLineEndOfIntroSeriesMarker:
-      output_plaintext_line_end_of_intro_series_marker_solve(si);
-      break;
-
-    case STPiecesParalysingMateFilter:
-      paralysing_mate_filter_solve(si);
-      break;
-
-    case STPiecesParalysingStalemateSpecial:
-      paralysing_stalemate_special_solve(si);
-      break;
-
-    case STPiecesParalysingRemoveCaptures:
-      paralysing_remove_captures_solve(si);
-      break;
-
-    case STPiecesParalysingSuffocationFinder:
-      paralysing_suffocation_finder_solve(si);
-      break;
-
-    case STAmuMateFilter:
-      amu_mate_filter_solve(si);
-      break;
-
-    case STCirceSteingewinnFilter:
-      circe_steingewinn_filter_solve(si);
-      break;
-
-    case STCirceCircuitSpecial:
-      circe_circuit_special_solve(si);
-      break;
-
-    case STCirceExchangeSpecial:
-      circe_exchange_special_solve(si);
-      break;
-
-    case STTemporaryHackFork:
-      pipe_solve_delegate(si);
-      break;
-
-    case STGoalTargetReachedTester:
-      goal_target_reached_tester_solve(si);
-      break;
-
-    case STGoalCheckReachedTester:
-      goal_check_reached_tester_solve(si);
-      break;
-
-    case STGoalCaptureReachedTester:
-      goal_capture_reached_tester_solve(si);
-      break;
-
-    case STGoalSteingewinnReachedTester:
-      goal_steingewinn_reached_tester_solve(si);
-      break;
-
-    case STGoalEnpassantReachedTester:
-      goal_enpassant_reached_tester_solve(si);
-      break;
-
-    case STGoalDoubleMateReachedTester:
-      goal_doublemate_reached_tester_solve(si);
-      break;
-
-    case STGoalCounterMateReachedTester:
-      goal_countermate_reached_tester_solve(si);
-      break;
-
-    case STGoalCastlingReachedTester:
-      goal_castling_reached_tester_solve(si);
-      break;
-
-    case STGoalCircuitReachedTester:
-      goal_circuit_reached_tester_solve(si);
-      break;
-
-    case STGoalExchangeReachedTester:
-      goal_exchange_reached_tester_solve(si);
-      break;
-
-    case STGoalCircuitByRebirthReachedTester:
-      goal_circuit_by_rebirth_reached_tester_solve(si);
-      break;
-
-    case STGoalExchangeByRebirthReachedTester:
-      goal_exchange_by_rebirth_reached_tester_solve(si);
-      break;
-
-    case STGoalProofgameReachedTester:
-    case STGoalAToBReachedTester:
-      goal_proofgame_reached_tester_solve(si);
-      break;
-
-    case STGoalImmobileReachedTester:
-      goal_immobile_reached_tester_solve(si);
-      break;
-
-    case STMaffImmobilityTesterKing:
-      maff_immobility_tester_king_solve(si);
-      break;
-
-    case STOWUImmobilityTesterKing:
-      owu_immobility_tester_king_solve(si);
-      break;
-
-    case STGoalNotCheckReachedTester:
-      goal_notcheck_reached_tester_solve(si);
-      break;
-
-    case STGoalAnyReachedTester:
-      goal_any_reached_tester_solve(si);
-      break;
-
-    case STGoalChess81ReachedTester:
-      goal_chess81_reached_tester_solve(si);
-      break;
-
-    case STGoalKissReachedTester:
-      goal_kiss_reached_tester_solve(si);
-      break;
-
-    case STGoalKingCaptureReachedTester:
-      goal_king_capture_reached_tester_solve(si);
-      break;
-
-    case STPiecesParalysingMateFilterTester:
-      paralysing_mate_filter_tester_solve(si);
-      break;
-
-    case STBlackChecks:
-      blackchecks_solve(si);
-      break;
-
-    case STSingleBoxType1LegalityTester:
-      singlebox_type1_legality_tester_solve(si);
-      break;
-
-    case STSingleBoxType2LegalityTester:
-      singlebox_type2_legality_tester_solve(si);
-      break;
-
-    case STSingleBoxType3LegalityTester:
-      singlebox_type3_legality_tester_solve(si);
-      break;
-
-    case STSingleBoxType3PawnPromoter:
-      singlebox_type3_pawn_promoter_solve(si);
-      break;
-
-    case STExclusiveChessExclusivityDetector:
-      exclusive_chess_exclusivity_detector_solve(si);
-      break;
-
-    case STExclusiveChessNestedExclusivityDetector:
-      exclusive_chess_nested_exclusivity_detector_solve(si);
-      break;
-
-    case STExclusiveChessLegalityTester:
-      exclusive_chess_legality_tester_solve(si);
-      break;
-
-    case STExclusiveChessGoalReachingMoveCounter:
-      exclusive_chess_goal_reaching_move_counter_solve(si);
-      break;
-
-    case STExclusiveChessUndecidableWriterTree:
-      exclusive_chess_undecidable_writer_tree_solve(si);
-      break;
-
-    case STExclusiveChessUndecidableWriterLine:
-      exclusive_chess_undecidable_writer_line_solve(si);
-      break;
-
-    case STUltraschachzwangLegalityTester:
-      ultraschachzwang_legality_tester_solve(si);
-      break;
-
-    case STIsardamLegalityTester:
-      isardam_legality_tester_solve(si);
-      break;
-
-    case STCirceAssassinAssassinate:
-      circe_assassin_assassinate_solve(si);
-      break;
-
-    case STCirceParachuteRemember:
-      circe_parachute_remember_solve(si);
-      break;
-
-    case STCirceParachuteUncoverer:
-      circe_parachute_uncoverer_solve(si);
-      break;
-
-    case STCirceVolcanicRemember:
-      circe_volcanic_remember_solve(si);
-      break;
-
-    case STCirceVolcanicSwapper:
-      circe_volcanic_swapper_solve(si);
-      break;
-
-    case STKingSquareUpdater:
-      king_square_updater_solve(si);
-      break;
-
-    case STOwnKingCaptureAvoider:
-      own_king_capture_avoider_solve(si);
-      break;
-
-    case STOpponentKingCaptureAvoider:
-      opponent_king_capture_avoider_solve(si);
-      break;
-
-    case STPatienceChessLegalityTester:
-      patience_chess_legality_tester_solve(si);
-      break;
-
-    case STStrictSATInitialiser:
-      strict_sat_initialiser_solve(si);
-      break;
-
-    case STStrictSATUpdater:
-      strict_sat_updater_solve(si);
-      break;
-
-    case STDynastyKingSquareUpdater:
-      dynasty_king_square_updater_solve(si);
-      break;
-
-    case STHurdleColourChanger:
-      hurdle_colour_changer_solve(si);
-      break;
-
-    case STHurdleColourChangeInitialiser:
-      hurdle_colour_change_initialiser_solve(si);
-      break;
-
-    case STHurdleColourChangerChangePromoteeInto:
-      hurdle_colour_change_change_promotee_into_solve(si);
-      break;
-
-    case STOscillatingKingsTypeA:
-      oscillating_kings_type_a_solve(si);
-      break;
-
-    case STOscillatingKingsTypeB:
-      oscillating_kings_type_b_solve(si);
-      break;
-
-    case STOscillatingKingsTypeC:
-      oscillating_kings_type_c_solve(si);
-      break;
-
-    case STPlaySuppressor:
-      play_suppressor_solve(si);
-      break;
-
-    case STContinuationSolver:
-      continuation_solver_solve(si);
-      break;
-
-    case STDefensePlayed:
-      defense_played_solve(si);
-      break;
-
-    case STMaxFlightsquares:
-      maxflight_guard_solve(si);
-      break;
-
-    case STMaxNrNonTrivial:
-      max_nr_nontrivial_guard_solve(si);
-      break;
-
-    case STOutputPlainTextTreeEndOfSolutionWriter:
-      output_plaintext_end_of_solution_writer_solve(si);
-      break;
-
-    case STKillerMoveFinalDefenseMove:
-      killer_move_final_defense_move_solve(si);
-      break;
-
-    case STKillerMovePrioriser:
-      killer_move_prioriser_solve(si);
-      break;
-
-    case STMaxThreatLength:
-      maxthreatlength_guard_solve(si);
-      break;
-
-    case STKillerAttackCollector:
-      killer_attack_collector_solve(si);
-      break;
-
-    case STTotalInvisibleMoveSequenceTester:
-      total_invisible_move_sequence_tester_solve(si);
-      break;
-
-    case STTotalInvisibleInstrumenter:
-      total_invisible_instrumenter_solve(si);
-      break;
-
-    case STTotalInvisibleInvisiblesAllocator:
-      total_invisible_invisibles_allocator_solve(si);
-      break;
-
-    case STTotalInvisibleMoveSequenceMoveRepeater:
-      total_invisible_move_repeater_solve(si);
-      break;
-
-    case STTotalInvisibleUninterceptableSelfCheckGuard:
-      total_invisible_uninterceptable_selfcheck_guard_solve(si);
-      break;
-
-    case STTotalInvisibleGoalGuard:
-      total_invisible_goal_guard_solve(si);
-      break;
-
-    case STTotalInvisibleSpecialMoveGenerator:
-      total_invisible_generate_special_moves(si);
-      break;
-
-    case STTotalInvisibleSpecialMovesPlayer:
-      total_invisible_special_moves_player_solve(si);
-      break;
-
-    case STTotalInvisibleReserveKingMovement:
-      total_invisible_reserve_king_movement(si);
-      break;
-
-    case STTotalInvisibleMovesByInvisibleGenerator:
-      total_invisible_generate_moves_by_invisible(si);
-      break;
-
-    case STTotalInvisibleRevealAfterFinalMove:
-      total_invisible_reveal_after_mating_move(si);
-      break;
-
-    case STMummerOrchestrator:
-      mummer_orchestrator_solve(si);
-      break;
-
-    case STMummerBookkeeper:
-      mummer_bookkeeper_solve(si);
-      break;
-
-    case STBackHomeMovesOnly:
-      back_home_moves_only_solve(si);
-      break;
-
-    case STNoPromotionsRemovePromotionMoving:
-      nopromotion_avoid_promotion_moving_solve(si);
-      break;
-
-    case STBackhomeExistanceTester:
-      backhome_existance_tester_solve(si);
-      break;
-
-    case STBackhomeRemoveIllegalMoves:
-      backhome_remove_illegal_moves_solve(si);
-      break;
-
-    case STNocaptureRemoveCaptures:
-      nocapture_remove_captures_solve(si);
-      break;
-
-    case STWoozlesRemoveIllegalCaptures:
-      woozles_remove_illegal_captures_solve(si);
-      break;
-
-    case STBiWoozlesRemoveIllegalCaptures:
-      biwoozles_remove_illegal_captures_solve(si);
-      break;
-
-    case STHeffalumpsRemoveIllegalCaptures:
-      heffalumps_remove_illegal_captures_solve(si);
-      break;
-
-    case STBiHeffalumpsRemoveIllegalCaptures:
-      biheffalumps_remove_illegal_captures_solve(si);
-      break;
-
-    case STProvocateursRemoveUnobservedCaptures:
-      provocateurs_remove_unobserved_captures_solve(si);
-      break;
-
-    case STLortapRemoveSupportedCaptures:
-      lortap_remove_supported_captures_solve(si);
-      break;
-
-    case STPatrolRemoveUnsupportedCaptures:
-      patrol_remove_unsupported_captures_solve(si);
-      break;
-
-    case STKoekoLegalityTester:
-      koeko_legality_tester_solve(si);
-      break;
-
-    case STGridContactLegalityTester:
-      contact_grid_legality_tester_solve(si);
-      break;
-
-    case STAntiKoekoLegalityTester:
-      antikoeko_legality_tester_solve(si);
-      break;
-
-    case STNewKoekoRememberContact:
-      newkoeko_remember_contact_solve(si);
-      break;
-
-    case STNewKoekoLegalityTester:
-      newkoeko_legality_tester_solve(si);
-      break;
-
-    case STJiggerLegalityTester:
-      jigger_legality_tester_solve(si);
-      break;
-
-    case STMonochromeRemoveNonMonochromeMoves:
-      monochrome_remove_non_monochrome_moves_solve(si);
-      break;
-
-    case STBichromeRemoveNonBichromeMoves:
-      bichrome_remove_non_bichrome_moves_solve(si);
-      break;
-
-    case STEdgeMoverRemoveIllegalMoves:
-      edgemover_remove_illegal_moves_solve(si);
-      break;
-
-    case STShieldedKingsRemoveIllegalCaptures:
-      shielded_kings_remove_illegal_captures_solve(si);
-      break;
-
-    case STSuperguardsRemoveIllegalCaptures:
-      superguards_remove_illegal_captures_solve(si);
-      break;
-
-    case STGridRemoveIllegalMoves:
-      grid_remove_illegal_moves_solve(si);
-      break;
-
-    case STUncapturableRemoveCaptures:
-      uncapturable_remove_captures_solve(si);
-      break;
-
-    case STTakeAndMakeGenerateMake:
-      take_and_make_generate_make_solve(si);
-      break;
-
-    case STTakeAndMakeAvoidPawnMakeToBaseLine:
-      take_and_make_avoid_pawn_make_to_base_line_solve(si);
-      break;
-
-    case STWormholeRemoveIllegalCaptures:
-      wormhole_remove_illegal_captures_solve(si);
-      break;
-
-    case STWormholeTransferer:
-      wormhole_transferer_solve(si);
-      break;
-
-    case STExtinctionExtinctedTester:
-      extinction_extincted_tester_solve(si);
-      break;
-
-    case STCastlingGeneratorTestDeparture:
-      castling_generate_test_departure(si);
-      break;
-
-    case STNullMoveGenerator:
-      null_move_generator_solve(si);
-      break;
-
-    case STRoleExchangeMoveGenerator:
-      role_exchange_generator_solve(si);
-      break;
-
-    case STTrue:
-      solve_result = previous_move_has_solved;
-      break;
-
-    case STFalse:
-      solve_result = MOVE_HAS_NOT_SOLVED_LENGTH();
-      break;
-
-    /* move generators: */
-    case STSingleBoxType3TMovesForPieceGenerator:
-      singleboxtype3_generate_moves_for_piece(si);
-      break;
-
-    case STMadrasiMovesForPieceGenerator:
-      madrasi_generate_moves_for_piece(si);
-      break;
-
-    case STPartialParalysisMovesForPieceGenerator:
-      partial_paralysis_generate_moves_for_piece(si);
-      break;
-
-    case STEiffelMovesForPieceGenerator:
-      eiffel_generate_moves_for_piece(si);
-      break;
-
-    case STDisparateMovesForPieceGenerator:
-      disparate_generate_moves_for_piece(si);
-      break;
-
-    case STParalysingMovesForPieceGenerator:
-      paralysing_generate_moves_for_piece(si);
-      break;
-
-    case STUltraPatrolMovesForPieceGenerator:
-      ultrapatrol_generate_moves_for_piece(si);
-      break;
-
-    case STCentralMovesForPieceGenerator:
-      central_generate_moves_for_piece(si);
-      break;
-
-    case STBeamtenMovesForPieceGenerator:
-      beamten_generate_moves_for_piece(si);
-      break;
-
-    case STMarsCirceMoveGeneratorEnforceRexInclusive:
-      marscirce_generate_moves_enforce_rex_exclusive(si);
-      break;
-
-    case STPhantomAvoidDuplicateMoves:
-      phantom_avoid_duplicate_moves(si);
-      break;
-
-    case STPlusAdditionalCapturesForPieceGenerator:
-      plus_generate_additional_captures_for_piece(si);
-      break;
-
-    case STMoveForPieceGeneratorTwoPaths:
-      generate_moves_for_piece_two_paths(si);
-      break;
-
-    case STMarsCirceRememberRebirth:
-      marscirce_remember_rebirth(si);
-      break;
-
-    case STMarsCirceRememberNoRebirth:
-      marscirce_remember_no_rebirth(si);
-      break;
-
-    case STMarsCirceFixDeparture:
-      marscirce_fix_departure(si);
-      break;
-
-    case STMarsCirceGenerateFromRebirthSquare:
-      marscirce_generate_from_rebirth_square(si);
-      break;
-
-    case STMoveGeneratorRejectCaptures:
-      move_generation_reject_captures(si);
-      break;
-
-    case STMoveGeneratorRejectNoncaptures:
-      move_generation_reject_non_captures(si);
-      break;
-
-    case STVaultingKingsMovesForPieceGenerator:
-      vaulting_kings_generate_moves_for_piece(si);
-      break;
-
-    case STTransmutingKingsMovesForPieceGenerator:
-      transmuting_kings_generate_moves_for_piece(si);
-      break;
-
-    case STSuperTransmutingKingsMovesForPieceGenerator:
-      supertransmuting_kings_generate_moves_for_piece(si);
-      break;
-
-    case STReflectiveKingsMovesForPieceGenerator:
-      reflective_kings_generate_moves_for_piece(si);
-      break;
-
-    case STRokagogoMovesForPieceGeneratorFilter:
-      rokagogo_filter_moves_for_piece(si);
-      break;
-
-    case STCastlingChessMovesForPieceGenerator:
-      castlingchess_generate_moves_for_piece(si);
-      break;
-
-    case STPlatzwechselRochadeMovesForPieceGenerator:
-      exchange_castling_generate_moves_for_piece(si);
-      break;
-
-    case STCastlingGenerator:
-      castling_generator_generate_castling(si);
-      break;
-
-    case STMessignyMovesForPieceGenerator:
-      messigny_generate_moves_for_piece(si);
-      break;
-
-    case STAnnanMovesForPieceGenerator:
-      annan_generate_moves_for_piece(si);
-      break;
-
-    case STNannaMovesForPieceGenerator:
-      nanna_generate_moves_for_piece(si);
-      break;
-
-    case STPointReflectionMovesForPieceGenerator:
-      point_reflection_generate_moves_for_piece(si);
-      break;
-
-    case STFaceToFaceMovesForPieceGenerator:
-      facetoface_generate_moves_for_piece(si);
-      break;
-
-    case STBackToBackMovesForPieceGenerator:
-      backtoback_generate_moves_for_piece(si);
-      break;
-
-    case STCheekToCheekMovesForPieceGenerator:
-      cheektocheek_generate_moves_for_piece(si);
-      break;
-
-    case STMovesForPieceBasedOnWalkGenerator:
-      generate_moves_for_piece_based_on_walk();
-      break;
-
-    case STMoveGenerationPostMoveIterator:
-      move_generation_post_move_iterator_solve(si);
-      break;
-
-    /* square observation */
-    case STIsSquareObservedOrtho:
-      observation_result = is_square_observed_ortho(trait[nbply],
-                                                    move_generation_stack[CURRMOVE_OF_PLY(nbply)].capture);
-      break;
-
-    case STPlusIsSquareObserved:
-      plus_is_square_observed(si);
-      break;
-
-    case STMarsIterateObservers:
-      marscirce_iterate_observers(si);
-      break;
-
-    case STMarsCirceIsSquareObservedEnforceRexInclusive:
-      marscirce_is_square_observed_enforce_rex_exclusive(si);
-      break;
-
-    case STMarsIsSquareObserved:
-      marscirce_is_square_observed(si);
-      break;
-
-    case STVaultingKingIsSquareObserved:
-      vaulting_king_is_square_observed(si);
-      break;
-
-    case STTransmutingKingIsSquareObserved:
-      transmuting_king_is_square_observed(si);
-      break;
-
-    case STTransmutingKingDetectNonTransmutation:
-      transmuting_king_detect_non_transmutation(si);
-      break;
-
-    case STDetermineObserverWalk:
-      determine_observer_walk(si);
-      break;
-
-    case STBicoloresTryBothSides:
-      bicolores_try_both_sides(si);
-      break;
-
-    case STDontTryObservingWithNonExistingWalk:
-      dont_try_observing_with_non_existing_walk(si);
-      break;
-
-    case STDontTryObservingWithNonExistingWalkBothSides:
-      dont_try_observing_with_non_existing_walk_both_sides(si);
-      break;
-
-    case STOptimiseObservationsByQueenInitialiser:
-      optimise_away_observations_by_queen_initialise(si);
-      break;
-
-    case STOptimiseObservationsByQueen:
-      optimise_away_observations_by_queen(si);
-      break;
-
-    case STTrackBackFromTargetAccordingToObserverWalk:
-      track_back_from_target_according_to_observer_walk(si);
-      break;
-
-    case STIsSquareObservedTwoPaths:
-      is_square_observed_two_paths(si);
-      break;
-
-    case STSquareObservationPostMoveIterator:
-      square_observation_post_move_iterator_solve(si);
-      break;
-
-    default:
-      assert(0);
-      break;
-  }
+  if (statistics_are_collected)
+    statistics_leave_slice();
 
   if (total_invisible_number>0)
-  {
-    TraceConsumption();
-
-    assert(!current_consumption.is_king_unplaced[Black] || being_solved.king_square[Black]==initsquare);
-    assert(!current_consumption.is_king_unplaced[White] || being_solved.king_square[White]==initsquare);
-
-    assert(nbply<=ply_retro_move
-           || nr_total_invisbles_consumed()<=total_invisible_number);
-  }
+    check_total_invisible_consumption();
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
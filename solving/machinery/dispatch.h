@@ -7,6 +7,11 @@
 
 #include "stipulation/stipulation.h"
 
+/* Initialise the table of the functions solving the slices of each type
+ * @note to be invoked once at start of program
+ */
+void dispatch_initialise_solvers(void);
+
 /* Perform a dispatch
  */
 void dispatch(slice_index si);
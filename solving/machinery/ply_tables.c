@@ -0,0 +1,150 @@
+#include "solving/machinery/ply_tables.h"
+#include "conditions/amu/attack_counter.h"
+#include "conditions/backhome.h"
+#include "conditions/breton.h"
+#include "conditions/circe/cage.h"
+#include "conditions/circe/circe.h"
+#include "conditions/circe/parachute.h"
+#include "conditions/circe/super.h"
+#include "conditions/circe/takemake.h"
+#include "conditions/exclusive.h"
+#include "conditions/football.h"
+#include "conditions/imitator.h"
+#include "conditions/koeko/new.h"
+#include "conditions/make_and_take.h"
+#include "conditions/marscirce/marscirce.h"
+#include "conditions/masand.h"
+#include "conditions/mummer.h"
+#include "conditions/ohneschach.h"
+#include "conditions/patience.h"
+#include "conditions/republican.h"
+#include "conditions/singlebox/type2.h"
+#include "conditions/singlebox/type3.h"
+#include "conditions/snek.h"
+#include "conditions/transmuting_kings/super.h"
+#include "conditions/transmuting_kings/transmuting_kings.h"
+#include "conditions/transmuting_kings/vaulting_kings.h"
+#include "conditions/woozles.h"
+#include "conditions/wormhole.h"
+#include "optimisations/count_nr_opponent_moves/opponent_moves_counter.h"
+#include "optimisations/hash.h"
+#include "optimisations/intelligent/duplicate_avoider.h"
+#include "optimisations/intelligent/intelligent.h"
+#include "optimisations/intelligent/mate/goalreachable_guard.h"
+#include "optimisations/killer_move/killer_move.h"
+#include "optimisations/observation.h"
+#include "optimisations/orthodox_legal_moves.h"
+#include "options/movenumbers.h"
+#include "options/nontrivial.h"
+#include "output/plaintext/line/end_of_intro_series_marker.h"
+#include "pieces/attributes/chameleon.h"
+#include "pieces/attributes/hurdle_colour_changing.h"
+#include "pieces/attributes/magic.h"
+#include "pieces/attributes/total_invisible/revelations.h"
+#include "pieces/attributes/total_invisible/taboo.h"
+#include "pieces/walks/hoppers.h"
+#include "pieces/walks/hunters.h"
+#include "pieces/walks/pawns/en_passant.h"
+#include "pieces/walks/pawns/promotion.h"
+#include "solving/battle_play/threat.h"
+#include "solving/find_square_observer_tracking_back_from_target.h"
+#include "solving/goals/prerequisite_guards.h"
+#include "solving/legal_move_counter.h"
+#include "solving/move_effect_journal.h"
+#include "solving/move_generator.h"
+#include "solving/observation.h"
+#include "solving/ply.h"
+#include "utilities/table.h"
+#include "solving/pipe.h"
+#include "debugging/trace.h"
+
+/* Allocate the tables dimensioned by maxply, i.e. the tables indexed by ply,
+ * the move generation stack and the tables indexed like it, and the move
+ * effect journal
+ */
+static void allocate_ply_tables(void)
+{
+  ply_allocate_ply_tables();
+  move_generator_allocate_ply_tables();
+  move_effect_journal_allocate_ply_tables();
+  amu_attack_counter_allocate_ply_tables();
+  backhome_allocate_ply_tables();
+  breton_allocate_ply_tables();
+  circe_cage_allocate_ply_tables();
+  circe_allocate_ply_tables();
+  circe_parachute_allocate_ply_tables();
+  supercirce_allocate_ply_tables();
+  take_make_circe_allocate_ply_tables();
+  exclusive_chess_allocate_ply_tables();
+  football_chess_allocate_ply_tables();
+  imitator_allocate_ply_tables();
+  newkoeko_allocate_ply_tables();
+  make_and_take_allocate_ply_tables();
+  marscirce_allocate_ply_tables();
+  masand_allocate_ply_tables();
+  mummer_allocate_ply_tables();
+  ohneschach_allocate_ply_tables();
+  patience_chess_allocate_ply_tables();
+  republican_allocate_ply_tables();
+  singlebox_type2_allocate_ply_tables();
+  singlebox_type3_allocate_ply_tables();
+  snek_allocate_ply_tables();
+  supertransmuting_kings_allocate_ply_tables();
+  transmuting_kings_allocate_ply_tables();
+  vaulting_kings_allocate_ply_tables();
+  woozles_allocate_ply_tables();
+  wormhole_allocate_ply_tables();
+  opponent_moves_counter_allocate_ply_tables();
+  hash_allocate_ply_tables();
+  intelligent_duplicate_avoider_allocate_ply_tables();
+  intelligent_allocate_ply_tables();
+  goalreachable_guard_mate_allocate_ply_tables();
+  killer_move_allocate_ply_tables();
+  observation_optimisations_allocate_ply_tables();
+  orthodox_legal_moves_allocate_ply_tables();
+  move_numbers_allocate_ply_tables();
+  nontrivial_allocate_ply_tables();
+  output_plaintext_line_end_of_intro_series_marker_allocate_ply_tables();
+  chameleon_allocate_ply_tables();
+  hurdle_colour_change_allocate_ply_tables();
+  magic_allocate_ply_tables();
+  total_invisible_revelations_allocate_ply_tables();
+  total_invisible_taboo_allocate_ply_tables();
+  hoppers_allocate_ply_tables();
+  hunters_allocate_ply_tables();
+  en_passant_allocate_ply_tables();
+  promotion_allocate_ply_tables();
+  threat_allocate_ply_tables();
+  track_back_from_target_allocate_ply_tables();
+  goal_prerequisite_guards_allocate_ply_tables();
+  legal_move_counter_allocate_ply_tables();
+  observation_allocate_ply_tables();
+  tables_allocate_ply_tables();
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void ply_tables_allocator_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  allocate_ply_tables();
+  pipe_solve_delegate(si);
+  ply_deallocate_tables();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
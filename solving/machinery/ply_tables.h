@@ -0,0 +1,26 @@
+#if !defined(SOLVING_MACHINERY_PLY_TABLES_H)
+#define SOLVING_MACHINERY_PLY_TABLES_H
+
+#include "stipulation/stipulation.h"
+
+/* This module provides the slice type STPlyTablesAllocator, which allocates
+ * the tables dimensioned by maxply (as possibly set by command line option
+ * -maxply) before solving and deallocates them afterwards.
+ */
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void ply_tables_allocator_solve(slice_index si);
+
+#endif
@@ -187,9 +187,11 @@
 #include "options/maxflightsquares.h"
 #include "options/nontrivial.h"
 #include "options/movenumbers.h"
+#include "options/movenumbers/checkpoint.h"
 #include "options/nullmoves.h"
 #include "optimisations/count_nr_opponent_moves/move_generator.h"
 #include "optimisations/orthodox_mating_moves/orthodox_mating_moves_generation.h"
+#include "optimisations/orthodox_legal_moves.h"
 #include "optimisations/intelligent/limit_nr_solutions_per_target.h"
 #include "optimisations/goals/remove_non_reachers.h"
 #include "optimisations/detect_retraction.h"
@@ -625,7 +627,7 @@ void build_solvers1(slice_index si)
 
   solving_remove_irrelevant_constraints(si);
 
-  if (OptFlag[movenbr])
+  if (OptFlag[movenbr] || checkpoint_is_enabled())
     solving_insert_restart_guards(si);
 
   solving_insert_continuation_solvers(si);
@@ -636,6 +638,7 @@ void build_solvers1(slice_index si)
   {
     solving_optimise_with_orthodox_mating_move_generators(si);
     solving_optimise_with_goal_non_reacher_removers(si);
+    solving_optimise_with_orthodox_legal_moves(si);
   }
 
   if (!OptFlag[solvariantes])
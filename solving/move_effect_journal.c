@@ -3,10 +3,9 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
-move_effect_journal_entry_type move_effect_journal[move_effect_journal_size];
+move_effect_journal_entry_type *move_effect_journal;
 
-/* starting at 1 simplifies pointer arithmetic in undo_move_effects */
-move_effect_journal_index_type move_effect_journal_base[maxply+1] = { 1, 1 };
+move_effect_journal_index_type *move_effect_journal_base;
 
 move_effect_journal_index_type move_effect_journal_index_offset_capture = 0;
 move_effect_journal_index_type move_effect_journal_index_offset_movement = 1;
@@ -101,6 +100,18 @@ static void move_effect_none_do(move_effect_journal_entry_type const *entry)
 {
 }
 
+/* Allocate the journal and its tables
+ */
+void move_effect_journal_allocate_ply_tables(void)
+{
+  move_effect_journal = ply_allocate_table(move_effect_journal_size,sizeof move_effect_journal[0]);
+  move_effect_journal_base = ply_allocate_table(maxply+1,sizeof move_effect_journal_base[0]);
+
+  /* starting at 1 simplifies pointer arithmetic in undo_move_effects */
+  move_effect_journal_base[0] = 1;
+  move_effect_journal_base[1] = 1;
+}
+
 void move_effect_journal_init_move_effect_doers(void)
 {
   move_effect_type t;
@@ -295,17 +295,14 @@ typedef struct
 #endif
 } move_effect_journal_entry_type;
 
-enum
-{
-  /* length of journal */
-  move_effect_journal_size = 10*maxply
-};
+/* length of journal */
+#define move_effect_journal_size (10*maxply)
 
 /* the journal */
-extern move_effect_journal_entry_type move_effect_journal[move_effect_journal_size];
+extern move_effect_journal_entry_type *move_effect_journal;
 
 /* index of next effect per ply (i.e. 1 position beyond the last effect) */
-extern move_effect_journal_index_type move_effect_journal_base[maxply+1];
+extern move_effect_journal_index_type *move_effect_journal_base;
 
 extern move_effect_journal_index_type move_effect_journal_index_offset_capture;
 extern move_effect_journal_index_type move_effect_journal_index_offset_movement;
@@ -362,6 +359,10 @@ void move_effect_journal_pop_effect(void);
 
 typedef void (*move_effect_doer)(move_effect_journal_entry_type const *);
 
+/* Allocate the journal and its tables
+ */
+void move_effect_journal_allocate_ply_tables(void);
+
 void move_effect_journal_init_move_effect_doers(void);
 
 void move_effect_journal_set_effect_doers(move_effect_type type,
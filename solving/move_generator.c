@@ -2,6 +2,7 @@
 #include "solving/temporary_hacks.h"
 #include "solving/pipe.h"
 #include "solving/fork.h"
+#include "solving/statistics.h"
 #include "stipulation/slice_insertion.h"
 #include "stipulation/pipe.h"
 #include "stipulation/proxy.h"
@@ -17,15 +18,26 @@
 #include <string.h>
 #include <stdio.h>
 
-move_generation_elmt *curr_generation = &move_generation_stack[toppile];
+move_generation_elmt *curr_generation;
 
-move_generation_elmt move_generation_stack[toppile + 1];
+move_generation_elmt *move_generation_stack;
 
-numecoup current_move[maxply+1];
-numecoup current_move_id[maxply+1];
+numecoup *current_move;
+numecoup *current_move_id;
 
 piece_walk_type move_generation_current_walk;
 
+/* Allocate the move generation stack and the tables of the move generator
+ */
+void move_generator_allocate_ply_tables(void)
+{
+  move_generation_stack = ply_allocate_table(toppile+1,sizeof move_generation_stack[0]);
+  curr_generation = &move_generation_stack[current_generation];
+
+  current_move = ply_allocate_table(maxply+1,sizeof current_move[0]);
+  current_move_id = ply_allocate_table(maxply+1,sizeof current_move_id[0]);
+}
+
 static void write_history_recursive(ply ply)
 {
   if (parent_ply[ply]>ply_retro_move)
@@ -332,6 +344,8 @@ void generate_moves_different_walk(slice_index si, piece_walk_type walk)
  */
 void generate_moves_for_piece(square sq_departure)
 {
+  numecoup const base = CURRMOVE_OF_PLY(nbply);
+
   TraceFunctionEntry(__func__);
   TraceSquare(sq_departure);
   TraceFunctionParamListEnd();
@@ -340,6 +354,9 @@ void generate_moves_for_piece(square sq_departure)
   move_generation_current_walk = get_walk_of_piece_on_square(sq_departure);
   generate_moves_delegate(SLICE_NEXT2(temporary_hack_move_generator[trait[nbply]]));
 
+  if (statistics_are_collected && CURRMOVE_OF_PLY(nbply)>base)
+    statistics_count_moves_generated(CURRMOVE_OF_PLY(nbply)-base);
+
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
 }
@@ -33,20 +33,20 @@ typedef struct
 
 enum
 {
-  toppile = 60*maxply
+  /* the move generation stack is dimensioned for this many moves per ply */
+  max_nr_moves_per_ply = 60
 };
 
-extern move_generation_elmt move_generation_stack[toppile + 1];
+#define toppile (max_nr_moves_per_ply*maxply)
 
-enum
-{
-  current_generation = toppile
-};
+extern move_generation_elmt *move_generation_stack;
+
+#define current_generation toppile
 
 extern piece_walk_type move_generation_current_walk;
 
-extern numecoup current_move[maxply+1];
-extern numecoup current_move_id[maxply+1];
+extern numecoup *current_move;
+extern numecoup *current_move_id;
 
 #define MOVEBASE_OF_PLY(ply) (current_move[(ply)-1])
 #define SET_MOVEBASE_OF_PLY(ply,n) (current_move[(ply)-1] = (n))
@@ -61,6 +61,10 @@ enum
 
 #define encore() (CURRMOVE_OF_PLY(nbply)>MOVEBASE_OF_PLY(nbply))
 
+/* Allocate the move generation stack and the tables of the move generator
+ */
+void move_generator_allocate_ply_tables(void);
+
 void move_generator_write_history(void);
 
 
@@ -10,6 +10,16 @@
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
+static unsigned long nr_moves_played;
+
+/* Determine the number of moves played by the current process
+ * @return number of moves
+ */
+unsigned long move_player_get_nr_moves_played(void)
+{
+  return nr_moves_played;
+}
+
 static void play_move(void)
 {
   numecoup const curr = CURRMOVE_OF_PLY(nbply);
@@ -34,6 +44,8 @@ static void play_move(void)
   move_effect_journal_do_piece_movement(move_effect_reason_moving_piece_movement,
                                         sq_departure,
                                         sq_arrival);
+
+  ++nr_moves_played;
 }
 
 /* Try to solve in solve_nr_remaining half-moves.
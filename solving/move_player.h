@@ -6,6 +6,11 @@
 /* This module plays the orthodox part of a move.
  */
 
+/* Determine the number of moves played by the current process
+ * @return number of moves
+ */
+unsigned long move_player_get_nr_moves_played(void);
+
 /* Try to solve in solve_nr_remaining half-moves.
  * @param si slice index
  * @note assigns solve_result the length of solution found and written, i.e.:
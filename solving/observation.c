@@ -53,9 +53,16 @@
 #include "stipulation/binary.h"
 #include "debugging/assert.h"
 
-interceptable_observation_type interceptable_observation[maxply+1];
+interceptable_observation_type *interceptable_observation;
 unsigned int observation_context = 0;
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void observation_allocate_ply_tables(void)
+{
+  interceptable_observation = ply_allocate_table(maxply+1,sizeof interceptable_observation[0]);
+}
+
 static boolean enforce_observer_walk(slice_index si)
 {
   boolean result = false;
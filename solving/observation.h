@@ -28,7 +28,7 @@ typedef struct
     vec_index_type vector_index2;
     int auxiliary;
 } interceptable_observation_type;
-extern interceptable_observation_type interceptable_observation[maxply+1];
+extern interceptable_observation_type *interceptable_observation;
 extern unsigned int observation_context;
 
 /* Continue validating an observation (or observer or observation geometry)
@@ -201,4 +201,8 @@ void stip_instrument_is_square_observed_testing(slice_index si,
 void is_square_observed_instrument_for_alternative_paths(slice_index si,
                                                          Side side);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void observation_allocate_ply_tables(void);
+
 #endif
@@ -0,0 +1,427 @@
+#include "solving/parallel/partition.h"
+#include "stipulation/pipe.h"
+#include "stipulation/slice_insertion.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Each marker line of a partial result file starts with marker_lead,
+ * followed by a tag and the values of the marker:
+ * - marker_header K N: the file has been written by process K of N
+ * - marker_phase: start of a phase
+ * - marker_common: end of output written outside of a split
+ * - marker_unit U: end of the output of unit U of the current split
+ * - marker_split_end R M: end of a split with M units, R being the result
+ *   in this partition
+ */
+enum
+{
+  marker_lead = '\001',
+  marker_header = 'P',
+  marker_phase = 'H',
+  marker_common = 'C',
+  marker_unit = 'U',
+  marker_split_end = 'S',
+  marker_none = 0, /* end of file */
+
+  max_nr_marker_values = 2
+};
+
+static unsigned int partition_index;
+static unsigned int nr_partitions;
+
+static int nr_partial_results;
+static char **partial_result_names;
+
+/* Interpret the value of command line option -partition
+ * @param optionValue value of the option, e.g. "2/5"
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_partition(char const *optionValue)
+{
+  boolean result = false;
+  char *end;
+  unsigned long const k = strtoul(optionValue,&end,10);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%s",optionValue);
+  TraceFunctionParamListEnd();
+
+  if (end!=optionValue && *end=='/')
+  {
+    char const * const n_start = end+1;
+    unsigned long const n = strtoul(n_start,&end,10);
+    if (end!=n_start && *end==0 && k>=1 && k<=n && n<=UINT_MAX)
+    {
+      partition_index = (unsigned int)(k-1);
+      nr_partitions = (unsigned int)n;
+      result = true;
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Has this process been asked to solve a partition of the problems?
+ * @return true iff it has
+ */
+boolean parallel_is_partitioned(void)
+{
+  return nr_partitions>0;
+}
+
+static void write_marker(char tag, unsigned int nr_values, unsigned long const values[])
+{
+  unsigned int i;
+
+  /* markers go to the partial result file only, not to the protocol */
+  putchar(marker_lead);
+  putchar(tag);
+  for (i = 0; i!=nr_values; ++i)
+    printf(" %lu",values[i]);
+  putchar('\n');
+}
+
+/* Write the header of the partial result file
+ */
+void parallel_partition_write_header(void)
+{
+  unsigned long const values[] = { partition_index+1, nr_partitions };
+  assert(parallel_is_partitioned());
+  write_marker(marker_header,2,values);
+}
+
+/* Start a phase in the partial result file
+ */
+void parallel_partition_start_phase(void)
+{
+  write_marker(marker_phase,0,0);
+}
+
+/* Start a split in the partial result file
+ */
+void parallel_partition_start_split(void)
+{
+  write_marker(marker_common,0,0);
+}
+
+/* Is a unit of work (a root move or the target positions with the black king
+ * on some square) in our partition?
+ * @param unit index of the unit in the current split
+ * @return true iff we are to solve the unit
+ */
+boolean parallel_partition_is_unit_ours(unsigned int unit)
+{
+  return unit%nr_partitions==partition_index;
+}
+
+/* Report the end of the output of a unit of work
+ * @param unit index of the unit in the current split
+ */
+void parallel_partition_end_unit(unsigned int unit)
+{
+  unsigned long const values[] = { unit };
+  write_marker(marker_unit,1,values);
+}
+
+/* End a split in the partial result file
+ * @param result solve_result of the split in this partition
+ * @param nr_units number of units of work in the split
+ */
+void parallel_partition_end_split(stip_length_type result, unsigned int nr_units)
+{
+  unsigned long const values[] = { result, nr_units };
+  write_marker(marker_split_end,2,values);
+}
+
+/* Enable merging partial result files
+ * @param nr_files number of partial result files
+ * @param files names of the partial result files
+ */
+void parallel_merge_enable(int nr_files, char **files)
+{
+  nr_partial_results = nr_files;
+  partial_result_names = files;
+}
+
+/* Determine whether merging partial result files has been enabled
+ * @return true iff it has been enabled
+ */
+boolean parallel_merge_is_enabled(void)
+{
+  return partial_result_names!=0;
+}
+
+/* Instrument the root slices for merging partial result files
+ * @param si identifies the root slice
+ */
+void parallel_merge_instrument_root(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototype = alloc_pipe(STParallelPartitionMerger);
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+typedef struct
+{
+    char *contents;
+    size_t size;
+    size_t pos;
+} partial_result_type;
+
+typedef struct
+{
+    char const *text;
+    size_t length;
+    char tag;
+    unsigned long values[max_nr_marker_values];
+} segment_type;
+
+static boolean read_partial_result(char const *name, partial_result_type *partial)
+{
+  boolean result = false;
+  FILE * const file = fopen(name,"rb");
+
+  partial->contents = 0;
+
+  if (file!=0)
+  {
+    if (fseek(file,0,SEEK_END)==0)
+    {
+      long const size = ftell(file);
+      if (size>=0 && fseek(file,0,SEEK_SET)==0)
+      {
+        partial->contents = malloc((size_t)size+1);
+        if (partial->contents!=0
+            && fread(partial->contents,1,(size_t)size,file)==(size_t)size)
+        {
+          partial->size = (size_t)size;
+          partial->pos = 0;
+          result = true;
+        }
+      }
+    }
+
+    fclose(file);
+  }
+
+  if (!result)
+  {
+    free(partial->contents);
+    partial->contents = 0;
+  }
+
+  return result;
+}
+
+/* Read the next segment of a partial result file, i.e. the text up to the
+ * next marker, and the marker
+ * @return false iff the marker is malformed
+ */
+static boolean read_segment(partial_result_type *partial, segment_type *segment)
+{
+  char const * const start = partial->contents+partial->pos;
+  size_t length = 0;
+  unsigned int i;
+
+  while (partial->pos+length<partial->size && start[length]!=marker_lead)
+    ++length;
+
+  segment->text = start;
+  segment->length = length;
+  for (i = 0; i!=max_nr_marker_values; ++i)
+    segment->values[i] = 0;
+  partial->pos += length;
+
+  if (partial->pos==partial->size)
+  {
+    segment->tag = marker_none;
+    return true;
+  }
+  else
+  {
+    char *end_of_marker = memchr(partial->contents+partial->pos,
+                                 '\n',
+                                 partial->size-partial->pos);
+    if (end_of_marker==0 || end_of_marker-(partial->contents+partial->pos)<2)
+      return false;
+    else
+    {
+      char const *value = partial->contents+partial->pos+2;
+
+      segment->tag = partial->contents[partial->pos+1];
+
+      *end_of_marker = '\0';
+      for (i = 0; i!=max_nr_marker_values && *value==' '; ++i)
+      {
+        char *end;
+        segment->values[i] = strtoul(value,&end,10);
+        value = end;
+      }
+
+      partial->pos = (size_t)(end_of_marker-partial->contents)+1;
+      return *value=='\0';
+    }
+  }
+}
+
+static boolean are_segments_consistent(segment_type const segments[],
+                                       unsigned int nr)
+{
+  unsigned int i;
+
+  for (i = 1; i<nr; ++i)
+    if (segments[i].tag!=segments[0].tag
+        || (segments[0].tag==marker_unit
+            && segments[i].values[0]!=segments[0].values[0])
+        || (segments[0].tag==marker_split_end
+            && segments[i].values[1]!=segments[0].values[1]))
+      return false;
+
+  return true;
+}
+
+static void write_segment(segment_type const *segment)
+{
+  fwrite(segment->text,1,segment->length,stdout);
+}
+
+/* Merge the partial results, which have been ordered by partition index
+ * @return true iff the partial results could be merged
+ */
+static boolean merge(partial_result_type partials[], unsigned int nr)
+{
+  segment_type * const segments = malloc(nr*sizeof segments[0]);
+  unsigned int leader = 0;
+  boolean result = false;
+
+  if (segments!=0)
+  {
+    while (true)
+    {
+      unsigned int i;
+
+      for (i = 0; i!=nr; ++i)
+        if (!read_segment(&partials[i],&segments[i]))
+          break;
+
+      if (i!=nr || !are_segments_consistent(segments,nr))
+        break;
+      else if (segments[0].tag==marker_none)
+      {
+        write_segment(&segments[leader]);
+        result = true;
+        break;
+      }
+      else if (segments[0].tag==marker_phase || segments[0].tag==marker_common)
+        write_segment(&segments[leader]);
+      else if (segments[0].tag==marker_unit)
+        write_segment(&segments[segments[0].values[0]%nr]);
+      else if (segments[0].tag==marker_split_end)
+      {
+        unsigned long const nr_units = segments[0].values[1];
+
+        /* whatever has been written after the last unit */
+        write_segment(&segments[nr_units>0 ? (nr_units-1)%nr : leader]);
+
+        /* continue with a partition that has the overall result; until the
+         * next phase, all partitions solve everything */
+        leader = 0;
+        for (i = 1; i!=nr; ++i)
+          if (segments[i].values[0]<segments[leader].values[0])
+            leader = i;
+      }
+      else
+        break;
+    }
+
+    free(segments);
+  }
+
+  fflush(stdout);
+
+  return result;
+}
+
+/* Read the partial result files and order them by partition index
+ * @return true iff all files have been read and belong to the same split
+ */
+static boolean read_partial_results(partial_result_type partials[], unsigned int nr)
+{
+  int i;
+
+  for (i = 0; i!=nr_partial_results; ++i)
+  {
+    partial_result_type partial;
+    segment_type header;
+
+    if (!read_partial_result(partial_result_names[i],&partial))
+    {
+      fprintf(stderr,"couldn't read partial result file %s\n",partial_result_names[i]);
+      return false;
+    }
+    else if (!read_segment(&partial,&header)
+             || header.length!=0
+             || header.tag!=marker_header
+             || header.values[1]!=nr
+             || header.values[0]<1 || header.values[0]>nr
+             || partials[header.values[0]-1].contents!=0)
+    {
+      fprintf(stderr,"%s isn't partial result file %d of %u\n",
+              partial_result_names[i],i+1,nr);
+      free(partial.contents);
+      return false;
+    }
+    else
+      partials[header.values[0]-1] = partial;
+  }
+
+  return true;
+}
+
+/* Merge the partial result files
+ * @param si identifies the STParallelPartitionMerger slice
+ */
+void parallel_partition_merger_solve(slice_index si)
+{
+  unsigned int const nr = (unsigned int)nr_partial_results;
+  partial_result_type * const partials = calloc(nr>0 ? nr : 1,sizeof partials[0]);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (partials==0)
+    fputs("couldn't allocate memory for merging the partial result files\n",stderr);
+  else
+  {
+    unsigned int i;
+
+    if (nr==0)
+      fputs("-merge expects the names of the partial result files\n",stderr);
+    else if (read_partial_results(partials,nr) && !merge(partials,nr))
+      fputs("the partial result files don't belong to the same problems\n",stderr);
+
+    for (i = 0; i!=nr; ++i)
+      free(partials[i].contents);
+    free(partials);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,84 @@
+#if !defined(SOLVING_PARALLEL_PARTITION_H)
+#define SOLVING_PARALLEL_PARTITION_H
+
+#include "stipulation/stipulation.h"
+
+/* This module implements splitting a problem over independent Popeye
+ * processes (command line options -partition and -merge).
+ * In the first split of each phase, process K of N solves the root moves (or,
+ * in intelligent mode, the target positions with the black king on a
+ * particular square) whose index modulo N is K-1, skipping the others. What
+ * is solved after that split may depend on its overall result, so the
+ * remainder of the phase is solved by each process completely.
+ * The output of each process is a partial result file in which marker lines
+ * separate the output of each root move from the output written outside of
+ * the split.
+ * -merge then reads the N partial result files and writes the output that a
+ * single process would have written: each root move's chunk is taken from
+ * the file of the process that has solved it, the remaining output from the
+ * file of a process that has the overall result of the preceding split.
+ */
+
+/* Interpret the value of command line option -partition
+ * @param optionValue value of the option, e.g. "2/5"
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_partition(char const *optionValue);
+
+/* Has this process been asked to solve a partition of the problems?
+ * @return true iff it has
+ */
+boolean parallel_is_partitioned(void);
+
+/* Write the header of the partial result file
+ */
+void parallel_partition_write_header(void);
+
+/* Start a phase in the partial result file
+ */
+void parallel_partition_start_phase(void);
+
+/* Start a split in the partial result file
+ */
+void parallel_partition_start_split(void);
+
+/* Is a unit of work (a root move or the target positions with the black king
+ * on some square) in our partition?
+ * @param unit index of the unit in the current split
+ * @return true iff we are to solve the unit
+ */
+boolean parallel_partition_is_unit_ours(unsigned int unit);
+
+/* Report the end of the output of a unit of work
+ * @param unit index of the unit in the current split
+ */
+void parallel_partition_end_unit(unsigned int unit);
+
+/* End a split in the partial result file
+ * @param result solve_result of the split in this partition
+ * @param nr_units number of units of work in the split
+ */
+void parallel_partition_end_split(stip_length_type result, unsigned int nr_units);
+
+/* Enable merging partial result files
+ * @param nr_files number of partial result files
+ * @param files names of the partial result files
+ */
+void parallel_merge_enable(int nr_files, char **files);
+
+/* Determine whether merging partial result files has been enabled
+ * @return true iff it has been enabled
+ */
+boolean parallel_merge_is_enabled(void);
+
+/* Instrument the root slices for merging partial result files
+ * @param si identifies the root slice
+ */
+void parallel_merge_instrument_root(slice_index si);
+
+/* Merge the partial result files
+ * @param si identifies the STParallelPartitionMerger slice
+ */
+void parallel_partition_merger_solve(slice_index si);
+
+#endif
@@ -0,0 +1,660 @@
+#include "solving/parallel/root_moves.h"
+#include "solving/parallel/workers.h"
+#include "solving/parallel/partition.h"
+#include "solving/machinery/solve.h"
+#include "solving/move_generator.h"
+#include "solving/incomplete.h"
+#include "solving/pipe.h"
+#include "stipulation/pipe.h"
+#include "stipulation/branch.h"
+#include "stipulation/slice_insertion.h"
+#include "options/options.h"
+#include "options/movenumbers.h"
+#include "pieces/attributes/total_invisible.h"
+#include "platform/worker.h"
+#include "output/plaintext/protocol.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <stdio.h>
+
+/* A root move (or, in intelligent mode, the target positions with the black
+ * king on a particular square), and where to find its output
+ */
+typedef struct
+{
+    int volatile claimed;
+    unsigned int worker;
+    long start;
+    long end;
+} root_move_type;
+
+/* What a worker reports to the master when it is done
+ */
+typedef struct
+{
+    boolean done;
+    stip_length_type solve_result;
+    solving_completeness_type completeness;
+    unsigned int nr_root_moves;
+    long end_of_last_root_move;
+    long end_of_output;
+    ply root_ply;
+    unsigned int next_move_nbr;
+} worker_report_type;
+
+typedef struct
+{
+    worker_report_type report[parallel_max_nr_workers];
+    root_move_type *root_move; /* toppile elements following this structure */
+} shared_state_type;
+
+/* size of the shared state, including the root moves */
+#define shared_state_size (sizeof(shared_state_type)+toppile*sizeof(root_move_type))
+
+/* state shared between master and workers while the root moves are split;
+ * 0 while they aren't */
+static shared_state_type *shared;
+
+/* state of the current worker */
+static unsigned int this_worker;
+static ply split_ply;
+static ply root_ply;
+static unsigned int nr_root_moves_visited;
+static long end_of_last_root_move;
+static boolean are_target_positions_split;
+
+/* are we solving our partition of the units of a split? */
+static boolean is_partition_split_active;
+
+/* has the split of the current phase been partitioned? */
+static boolean is_phase_partitioned;
+
+typedef enum
+{
+  insert_mode_unknown,
+  insert_mode_regular,
+  insert_mode_intelligent
+} insert_mode_type;
+
+typedef struct
+{
+    insert_mode_type mode;
+    slice_index incomplete;
+} insertion_state_type;
+
+static void insert_target_positions_split(slice_index si, slice_index incomplete)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParam("%u",incomplete);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototype = alloc_pipe(STParallelTargetPositionSplitter);
+    SLICE_NEXT2(prototype) = incomplete;
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void insert_split(slice_index si, slice_index incomplete)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParam("%u",incomplete);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototypes[] = {
+        alloc_pipe(STParallelRootMoveSplitter),
+        alloc_pipe(STParallelRootMoveClaimer)
+    };
+    enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
+    SLICE_NEXT2(prototypes[0]) = incomplete;
+    slice_insertion_insert(si,prototypes,nr_prototypes);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void insert_split_attack(slice_index si, stip_structure_traversal *st)
+{
+  insertion_state_type const * const state = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  insert_split(si,state->incomplete);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void insert_split_help(slice_index si, stip_structure_traversal *st)
+{
+  insertion_state_type const * const state = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  stip_traverse_structure_children_pipe(si,st);
+
+  assert(state->mode!=insert_mode_unknown);
+
+  if (st->level!=structure_traversal_level_nested)
+  {
+    if (state->mode==insert_mode_regular)
+      insert_split(si,state->incomplete);
+    /* intelligent mode doesn't solve by playing root moves; split the target
+     * positions instead, unless they are counted for option movenum */
+    else if (!OptFlag[movenbr])
+      insert_target_positions_split(si,state->incomplete);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void remember_intelligent(slice_index si, stip_structure_traversal *st)
+{
+  insertion_state_type * const state = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  state->mode = insert_mode_intelligent;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void remember_regular(slice_index si, stip_structure_traversal *st)
+{
+  insertion_state_type * const state = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  state->mode = insert_mode_regular;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static structure_traversers_visitor split_inserters[] =
+{
+  { STAttackAdapter,     &insert_split_attack                   },
+  { STDefenseAdapter,    &stip_structure_visitor_noop           },
+  { STHelpAdapter,       &insert_split_help                     },
+  { STIntelligentFilter, &remember_intelligent                  },
+  { STIntelligentProof,  &remember_regular                      },
+  { STMove,              &remember_regular                      },
+  { STEndOfBranchForced, &stip_traverse_structure_children_pipe }
+};
+
+enum
+{
+  nr_split_inserters = sizeof split_inserters / sizeof split_inserters[0]
+};
+
+static void remember_latex(slice_index si, stip_structure_traversal *st)
+{
+  boolean * const is_latex_active = st->param;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  *is_latex_active = true;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static structure_traversers_visitor latex_detectors[] =
+{
+  { STOutputLaTeXLineLineWriter, &remember_latex },
+  { STOutputLaTeXMoveWriter,     &remember_latex }
+};
+
+enum
+{
+  nr_latex_detectors = sizeof latex_detectors / sizeof latex_detectors[0]
+};
+
+/* Does the solving machinery write LaTeX output?
+ * @param si identifies the slice where to start searching
+ * @return true iff it does
+ */
+static boolean is_latex_active(slice_index si)
+{
+  boolean result = false;
+  stip_structure_traversal st;
+
+  stip_structure_traversal_init(&st,&result);
+  stip_structure_traversal_override(&st,latex_detectors,nr_latex_detectors);
+  stip_traverse_structure(si,&st);
+
+  return result;
+}
+
+/* Does the current phase allow its root moves to be split?
+ * @param si identifies the solving machinery
+ * @return true iff it does
+ */
+static boolean is_split_possible(slice_index si)
+{
+  /* these options depend on the order in which the root moves are solved */
+  return (!OptFlag[maxsols]
+          && !OptFlag[stoponshort]
+          && total_invisible_number==0
+          /* the workers' LaTeX output couldn't be merged */
+          && !is_latex_active(si));
+}
+
+/* Instrument the solving machinery for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_solving_instrumenter_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (parallel_is_partitioned())
+  {
+    parallel_partition_start_phase();
+    is_phase_partitioned = false;
+  }
+
+  if (is_split_possible(si))
+  {
+    stip_structure_traversal st;
+    insertion_state_type state = { insert_mode_unknown, SLICE_NEXT2(si) };
+
+    stip_structure_traversal_init(&st,&state);
+    stip_structure_traversal_override_by_contextual(&st,
+                                                    slice_contextual_conditional_pipe,
+                                                    &stip_traverse_structure_children_pipe);
+    stip_structure_traversal_override(&st,split_inserters,nr_split_inserters);
+    stip_traverse_structure(si,&st);
+  }
+
+  pipe_solve_delegate(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the solving machinery for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_problem_instrumenter_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototype = alloc_pipe(STParallelRootMovesSolvingInstrumenter);
+    SLICE_NEXT2(prototype) = SLICE_NEXT2(si);
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  pipe_solve_delegate(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the current problem for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_instrument_problem(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const interruption = branch_find_slice(STPhaseSolvingIncomplete,
+                                                       si,
+                                                       stip_traversal_context_intro);
+    slice_index const prototype = alloc_pipe(STParallelRootMovesProblemInstrumenter);
+    SLICE_NEXT2(prototype) = interruption;
+    assert(interruption!=no_slice);
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void solve_as_worker(slice_index si, unsigned int worker)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParam("%u",worker);
+  TraceFunctionParamListEnd();
+
+  this_worker = worker;
+  are_target_positions_split = SLICE_TYPE(si)==STParallelTargetPositionSplitter;
+  split_ply = nbply;
+  root_ply = nbply;
+  nr_root_moves_visited = 0;
+  end_of_last_root_move = parallel_worker_output_position();
+
+  pipe_solve_delegate(si);
+
+  {
+    worker_report_type * const report = &shared->report[worker];
+    report->solve_result = solve_result;
+    report->completeness = phase_solving_completeness(SLICE_NEXT2(si));
+    report->nr_root_moves = nr_root_moves_visited;
+    report->end_of_last_root_move = end_of_last_root_move;
+    report->end_of_output = parallel_worker_output_position();
+    report->root_ply = root_ply;
+    report->next_move_nbr = move_numbers_get_next(root_ply);
+    report->done = true;
+  }
+
+  parallel_end_worker();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void solve_partition(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  are_target_positions_split = SLICE_TYPE(si)==STParallelTargetPositionSplitter;
+  split_ply = nbply;
+  nr_root_moves_visited = 0;
+
+  parallel_partition_start_split();
+  is_phase_partitioned = true;
+  is_partition_split_active = true;
+  pipe_solve_delegate(si);
+  is_partition_split_active = false;
+  parallel_partition_end_split(solve_result,nr_root_moves_visited);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void merge_worker_results(slice_index si)
+{
+  boolean const all_workers_done = parallel_wait_for_workers();
+  unsigned int const nr_workers = parallel_get_nr_started_workers();
+  stip_length_type result = MOVE_HAS_NOT_SOLVED_LENGTH();
+  boolean result_reported = false;
+  unsigned int nr_root_moves = 0;
+  unsigned int last_worker = 0;
+  unsigned int i;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  for (i = 0; i!=nr_workers; ++i)
+  {
+    worker_report_type const * const report = &shared->report[i];
+    if (report->done)
+    {
+      /* the workers only differ in which root moves they have solved */
+      if (!result_reported || report->solve_result<result)
+        result = report->solve_result;
+      result_reported = true;
+
+      if (report->nr_root_moves>nr_root_moves)
+      {
+        nr_root_moves = report->nr_root_moves;
+        /* move numbers continue where the workers have left off */
+        move_numbers_set_next(report->root_ply,report->next_move_nbr);
+      }
+
+      if (report->completeness!=solving_complete)
+        phase_solving_remember_incompleteness(si,report->completeness);
+    }
+  }
+
+  for (i = 0; i!=nr_root_moves; ++i)
+  {
+    root_move_type const * const root_move = &shared->root_move[i];
+    if (root_move->claimed)
+    {
+      parallel_write_worker_output(root_move->worker,
+                                   root_move->start,
+                                   root_move->end);
+      last_worker = root_move->worker;
+    }
+  }
+
+  /* whatever has been written after the last root move */
+  if (shared->report[last_worker].done)
+    parallel_write_worker_output(last_worker,
+                                 shared->report[last_worker].end_of_last_root_move,
+                                 shared->report[last_worker].end_of_output);
+
+  protocol_fflush(stdout);
+
+  if (!all_workers_done)
+    phase_solving_remember_incompleteness(si,solving_partial);
+
+  solve_result = result;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void parallel_root_move_splitter_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  if (parallel_is_worker() || shared!=0 || is_partition_split_active)
+    pipe_solve_delegate(si);
+  else if (parallel_is_partitioned())
+  {
+    /* what follows the first split of a phase may depend on its overall
+     * result (e.g. in reflex or reciprocal play), which we don't know */
+    if (is_phase_partitioned)
+      pipe_solve_delegate(si);
+    else
+      solve_partition(si);
+  }
+  else
+  {
+    shared = platform_allocate_shared_memory(shared_state_size);
+    if (shared==0)
+      pipe_solve_delegate(si);
+    else
+    {
+      shared->root_move = (root_move_type *)(shared+1);
+
+      unsigned int const worker = parallel_start_workers();
+
+      if (worker==parallel_workers_started)
+      {
+        merge_worker_results(si);
+        parallel_release_workers();
+      }
+      else if (worker==parallel_workers_not_started)
+      {
+        platform_free_shared_memory(shared,shared_state_size);
+        shared = 0;
+        pipe_solve_delegate(si);
+      }
+      else
+        solve_as_worker(si,worker);
+
+      if (shared!=0)
+      {
+        platform_free_shared_memory(shared,shared_state_size);
+        shared = 0;
+      }
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void parallel_root_move_claimer_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  /* help branches are loops - only claim the moves played at the root */
+  if (is_partition_split_active && parent_ply[nbply]==split_ply)
+  {
+    unsigned int const unit = nr_root_moves_visited;
+
+    ++nr_root_moves_visited;
+
+    if (parallel_partition_is_unit_ours(unit))
+      pipe_solve_delegate(si);
+    else
+      solve_result = MOVE_HAS_NOT_SOLVED_LENGTH();
+
+    parallel_partition_end_unit(unit);
+  }
+  else if (parallel_is_worker() && parent_ply[nbply]==split_ply)
+  {
+    root_move_type * const root_move = &shared->root_move[nr_root_moves_visited];
+
+    assert(nr_root_moves_visited<toppile);
+    ++nr_root_moves_visited;
+    root_ply = nbply;
+
+    if (platform_test_and_set_shared_flag(&root_move->claimed))
+    {
+      /* our chunk of output includes what has been written since the previous
+       * root move, e.g. the move number */
+      root_move->worker = this_worker;
+      root_move->start = end_of_last_root_move;
+      pipe_solve_delegate(si);
+      end_of_last_root_move = parallel_worker_output_position();
+      root_move->end = end_of_last_root_move;
+    }
+    else
+    {
+      solve_result = MOVE_HAS_NOT_SOLVED_LENGTH();
+      end_of_last_root_move = parallel_worker_output_position();
+    }
+  }
+  else
+    pipe_solve_delegate(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Claim the target positions with the black king on the next square in
+ * intelligent mode
+ * @return true iff the current process is to enumerate these target positions
+ * @note if true is returned, parallel_target_positions_enumerated() is to be
+ *       invoked once the target positions have been enumerated
+ */
+boolean parallel_claim_target_positions(void)
+{
+  boolean result = true;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (is_partition_split_active && are_target_positions_split)
+  {
+    unsigned int const unit = nr_root_moves_visited;
+
+    ++nr_root_moves_visited;
+
+    if (!parallel_partition_is_unit_ours(unit))
+    {
+      parallel_partition_end_unit(unit);
+      result = false;
+    }
+  }
+  else if (parallel_is_worker() && are_target_positions_split)
+  {
+    root_move_type * const unit = &shared->root_move[nr_root_moves_visited];
+
+    assert(nr_root_moves_visited<toppile);
+    ++nr_root_moves_visited;
+
+    if (platform_test_and_set_shared_flag(&unit->claimed))
+    {
+      unit->worker = this_worker;
+      unit->start = end_of_last_root_move;
+    }
+    else
+    {
+      end_of_last_root_move = parallel_worker_output_position();
+      result = false;
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Report that the target positions claimed by the latest successful
+ * invokation of parallel_claim_target_positions() have been enumerated
+ */
+void parallel_target_positions_enumerated(void)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (is_partition_split_active && are_target_positions_split)
+    parallel_partition_end_unit(nr_root_moves_visited-1);
+  else if (parallel_is_worker() && are_target_positions_split)
+  {
+    end_of_last_root_move = parallel_worker_output_position();
+    shared->root_move[nr_root_moves_visited-1].end = end_of_last_root_move;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,82 @@
+#if !defined(SOLVING_PARALLEL_ROOT_MOVES_H)
+#define SOLVING_PARALLEL_ROOT_MOVES_H
+
+#include "stipulation/stipulation.h"
+
+/* This module implements splitting the root moves of direct, self and help
+ * play over worker processes:
+ * - the STParallelRootMoveSplitter slice starts the workers before the root
+ *   moves are generated; each worker generates the root moves itself
+ * - the STParallelRootMoveClaimer slice lets the first worker that arrives at
+ *   a root move claim it; the other workers skip it
+ * - the master finally writes the output of each root move in the order in
+ *   which sequential solving would have written it
+ * In intelligent mode, where root moves aren't played, the
+ * STParallelTargetPositionSplitter slice starts the workers instead, and the
+ * target positions are split according to the square of the black king.
+ * Identical solutions lead to the same final position and therefore always
+ * have the black king on the same square, so each worker's duplicate avoider
+ * suffices to filter the duplicates.
+ * With -partition, the same slices let the current process solve its
+ * partition of the root moves or target positions (see partition.h).
+ */
+
+/* Instrument the current problem for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_instrument_problem(slice_index si);
+
+/* Instrument the solving machinery for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_problem_instrumenter_solve(slice_index si);
+
+/* Instrument the solving machinery for splitting root moves
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_root_moves_solving_instrumenter_solve(slice_index si);
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void parallel_root_move_splitter_solve(slice_index si);
+
+/* Try to solve in solve_nr_remaining half-moves.
+ * @param si slice index
+ * @note assigns solve_result the length of solution found and written, i.e.:
+ *            previous_move_is_illegal the move just played is illegal
+ *            this_move_is_illegal     the move being played is illegal
+ *            immobility_on_next_move  the moves just played led to an
+ *                                     unintended immobility on the next move
+ *            <=n+1 length of shortest solution found (n+1 only if in next
+ *                                     branch)
+ *            n+2 no solution found in this branch
+ *            n+3 no solution found in next branch
+ *            (with n denominating solve_nr_remaining)
+ */
+void parallel_root_move_claimer_solve(slice_index si);
+
+/* Claim the target positions with the black king on the next square in
+ * intelligent mode
+ * @return true iff the current process is to enumerate these target positions
+ * @note if true is returned, parallel_target_positions_enumerated() is to be
+ *       invoked once the target positions have been enumerated
+ */
+boolean parallel_claim_target_positions(void);
+
+/* Report that the target positions claimed by the latest successful
+ * invokation of parallel_claim_target_positions() have been enumerated
+ */
+void parallel_target_positions_enumerated(void);
+
+#endif
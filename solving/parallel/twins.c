@@ -0,0 +1,395 @@
+#include "solving/parallel/twins.h"
+#include "solving/parallel/workers.h"
+#include "solving/parallel/partition.h"
+#include "solving/incomplete.h"
+#include "solving/pipe.h"
+#include "stipulation/pipe.h"
+#include "stipulation/branch.h"
+#include "stipulation/slice_insertion.h"
+#include "options/options.h"
+#include "platform/worker.h"
+#include "platform/tmpfile.h"
+#include "output/plaintext/protocol.h"
+#include "output/plaintext/twinning.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/* What the worker solving a twin reports to the master when it is done
+ */
+typedef struct
+{
+    int volatile done;
+    solving_completeness_type completeness;
+} twin_report_type;
+
+static unsigned int nr_twin_workers_requested = 1;
+
+/* state shared between master and workers while the twins of a problem are
+ * solved; 0 while they aren't */
+static twin_report_type *reports;
+
+/* state of the master; twin i uses slot i%nr_twin_workers_requested */
+static FILE *twin_output[parallel_max_nr_workers];
+static unsigned int nr_twins_started;
+static unsigned int nr_twins_written;
+static unsigned int nr_workers_running;
+
+/* the master's own output (e.g. remarks read with the next twin) goes here;
+ * the worker solving the next twin then continues writing to the same file
+ * 0 while the master's output isn't redirected */
+static FILE *master_output;
+
+/* the protocol file detached while the master's output is redirected */
+static FILE *protocol;
+
+/* are we solving a twin in a worker? */
+static boolean is_twin_worker;
+
+/* Interpret the value of command line option -twinthreads
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_nr_twin_workers(char const *optionValue)
+{
+  boolean result = false;
+  char *end;
+  unsigned long const value = strtoul(optionValue,&end,10);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%s",optionValue);
+  TraceFunctionParamListEnd();
+
+  if (optionValue!=end && *end==0 && value>0)
+  {
+    if (value>parallel_max_nr_workers)
+      nr_twin_workers_requested = parallel_max_nr_workers;
+    else
+      nr_twin_workers_requested = (unsigned int)value;
+
+    result = true;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Retrieve the number of twins to be solved concurrently
+ * @return number of twins; 1 if concurrent solving of twins wasn't requested
+ */
+unsigned int parallel_get_nr_twin_workers(void)
+{
+  return nr_twin_workers_requested;
+}
+
+/* Instrument the current problem for solving its twins concurrently
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_twins_instrument_problem(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const interruption = branch_find_slice(STProblemSolvingIncomplete,
+                                                       si,
+                                                       stip_traversal_context_intro);
+    slice_index const prototypes[] = {
+        alloc_pipe(STParallelTwinsCollector),
+        alloc_pipe(STParallelTwinSpawner)
+    };
+    enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
+    assert(interruption!=no_slice);
+    SLICE_NEXT2(prototypes[0]) = interruption;
+    SLICE_NEXT2(prototypes[1]) = interruption;
+    slice_insertion_insert(si,prototypes,nr_prototypes);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Redirect the master's output to a new temporary file
+ * @return true iff the output could be redirected
+ */
+static boolean redirect_master_output(void)
+{
+  master_output = platform_open_tmpfile();
+
+  if (master_output!=0 && !platform_redirect_output(master_output))
+  {
+    platform_close_tmpfile(master_output);
+    master_output = 0;
+  }
+
+  if (master_output==0)
+  {
+    platform_redirect_output(0);
+    protocol_attach(protocol);
+    return false;
+  }
+  else
+  {
+    protocol_detach();
+    return true;
+  }
+}
+
+/* Has the next twin to be written been solved (or will it never be)?
+ * @return true iff it has
+ */
+static boolean is_next_twin_finished(void)
+{
+  return (nr_twins_written<nr_twins_started
+          && (reports[nr_twins_written%nr_twin_workers_requested].done
+              || nr_workers_running==0));
+}
+
+/* Write the output of the twins that have been solved, in the order of the
+ * twins
+ * @param si identifies the STParallelTwinsCollector or STParallelTwinSpawner
+ *           slice
+ */
+static void write_solved_twins(slice_index si)
+{
+  if (is_next_twin_finished())
+  {
+    platform_redirect_output(0);
+    protocol_attach(protocol);
+
+    do
+    {
+      unsigned int const slot = nr_twins_written%nr_twin_workers_requested;
+
+      if (!reports[slot].done)
+        /* the worker has terminated irregularly */
+        problem_solving_remember_incompleteness(SLICE_NEXT2(si),solving_partial);
+      else if (reports[slot].completeness!=solving_complete)
+        problem_solving_remember_incompleteness(SLICE_NEXT2(si),
+                                                reports[slot].completeness);
+
+      parallel_write_output_file(twin_output[slot]);
+      platform_close_tmpfile(twin_output[slot]);
+      twin_output[slot] = 0;
+      ++nr_twins_written;
+    } while (is_next_twin_finished());
+
+    protocol_fflush(stdout);
+
+    if (master_output!=0)
+    {
+      protocol_detach();
+      platform_redirect_output(master_output);
+    }
+  }
+}
+
+/* Wait until a worker has terminated, then write the output of the twins
+ * that have been solved
+ */
+static void wait_for_twin(slice_index si)
+{
+  if (nr_workers_running>0)
+  {
+    if (platform_wait_for_any_worker())
+      --nr_workers_running;
+    else
+      nr_workers_running = 0;
+  }
+
+  write_solved_twins(si);
+}
+
+/* Wait until all workers have terminated, then write the output of the
+ * twins
+ */
+static void wait_for_all_twins(slice_index si)
+{
+  while (nr_twins_written<nr_twins_started)
+    wait_for_twin(si);
+}
+
+/* Does the LaTeX output of the current problem have to be written by a
+ * single process?
+ * @param si identifies the STParallelTwinsCollector slice
+ */
+static boolean is_latex_active(slice_index si)
+{
+  return branch_find_slice(STOutputLaTeXTwinningWriterBuilder,
+                           si,
+                           stip_traversal_context_intro)!=no_slice;
+}
+
+/* Write the output of the twins in their order after the last twin has been
+ * solved
+ * @param si identifies the STParallelTwinsCollector slice
+ */
+void parallel_twins_collector_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  assert(reports==0);
+
+  /* -threads solves the root moves of each twin in parallel instead */
+  if (parallel_get_nr_workers()<=1
+      && !parallel_is_partitioned()
+      && !is_latex_active(si))
+    reports = platform_allocate_shared_memory(nr_twin_workers_requested
+                                              * sizeof *reports);
+
+  if (reports!=0)
+  {
+    nr_twins_started = 0;
+    nr_twins_written = 0;
+    nr_workers_running = 0;
+
+    protocol_fflush(stdout);
+    protocol = protocol_get();
+    redirect_master_output();
+  }
+
+  pipe_solve_delegate(si);
+
+  if (reports!=0)
+  {
+    wait_for_all_twins(si);
+    platform_wait_for_workers();
+
+    if (master_output!=0)
+    {
+      platform_redirect_output(0);
+      protocol_attach(protocol);
+      parallel_write_output_file(master_output);
+      platform_close_tmpfile(master_output);
+      master_output = 0;
+      protocol_fflush(stdout);
+    }
+
+    platform_free_shared_memory(reports,nr_twin_workers_requested
+                                        * sizeof *reports);
+    reports = 0;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void remove_slice(slice_index si, stip_structure_traversal *st)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  stip_traverse_structure_children(si,st);
+  pipe_remove(si);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Remove the slices that remove themselves once they have been executed.
+ * The worker has executed them for the current twin, but the master hasn't.
+ * @param si identifies the STParallelTwinSpawner slice
+ */
+static void remove_slices_executed_by_worker(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    stip_structure_traversal st;
+    stip_structure_traversal_init(&st,0);
+    stip_structure_traversal_override_by_function(&st,
+                                                  slice_function_output_plaintext_position_writer,
+                                                  &remove_slice);
+    stip_structure_traversal_override_single(&st,
+                                             STZeroPositionInitialiser,
+                                             &remove_slice);
+    stip_traverse_structure(SLICE_NEXT1(si),&st);
+  }
+
+  output_plaintext_remove_twin_intro_writers(SLICE_NEXT1(si));
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+static void solve_as_worker(slice_index si, unsigned int slot)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParam("%u",slot);
+  TraceFunctionParamListEnd();
+
+  /* our standard output and error already go to master_output; the master
+   * will write them to the protocol file (if any) */
+  is_twin_worker = true;
+
+  pipe_solve_delegate(si);
+
+  fflush(stdout);
+  reports[slot].completeness = problem_solving_completeness(SLICE_NEXT2(si));
+  platform_test_and_set_shared_flag(&reports[slot].done);
+
+  platform_end_worker();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Start a worker solving the current twin
+ * @param si identifies the STParallelTwinSpawner slice
+ */
+void parallel_twin_spawner_solve(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  /* the move numbers continue from one twin to the next */
+  if (is_twin_worker || master_output==0 || OptFlag[movenbr])
+    pipe_solve_delegate(si);
+  else
+  {
+    unsigned int const slot = nr_twins_started%nr_twin_workers_requested;
+    platform_worker_start_result start_result;
+
+    while (nr_twins_started-nr_twins_written==nr_twin_workers_requested)
+      wait_for_twin(si);
+
+    reports[slot].done = 0;
+    reports[slot].completeness = solving_complete;
+
+    /* make sure that no output is written twice */
+    fflush(stdout);
+
+    start_result = platform_start_worker(master_output);
+    if (start_result==platform_worker_running)
+      solve_as_worker(si,slot);
+    else if (start_result==platform_worker_started)
+    {
+      twin_output[slot] = master_output;
+      ++nr_twins_started;
+      ++nr_workers_running;
+
+      remove_slices_executed_by_worker(si);
+
+      if (!redirect_master_output())
+        wait_for_all_twins(si);
+    }
+    else
+      /* our output is redirected, so it still is written in order */
+      pipe_solve_delegate(si);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
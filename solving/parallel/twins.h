@@ -0,0 +1,48 @@
+#if !defined(SOLVING_PARALLEL_TWINS_H)
+#define SOLVING_PARALLEL_TWINS_H
+
+#include "stipulation/stipulation.h"
+
+/* This module implements solving the twins of a problem concurrently
+ * (command line option -twinthreads):
+ * - the STParallelTwinSpawner slice starts a worker process for each twin
+ *   after the twin has been read and its stipulation has been set up; the
+ *   master goes on reading the next twin while the worker solves it
+ * - the STParallelTwinsCollector slice writes the output of the workers in
+ *   the order of the twins, and propagates interruptions of the workers
+ *   (e.g. by option maxtime) to the problem
+ * Everything written while solving a twin, including the results of
+ * verifying it and the solving times, comes from the worker that solved it.
+ * While twins are being solved, the standard output and error of the master
+ * are redirected, so that e.g. remarks read with a twin are written before
+ * the twin's solution.
+ */
+
+/* Interpret the value of command line option -twinthreads
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_nr_twin_workers(char const *optionValue);
+
+/* Retrieve the number of twins to be solved concurrently
+ * @return number of twins; 1 if concurrent solving of twins wasn't requested
+ */
+unsigned int parallel_get_nr_twin_workers(void);
+
+/* Instrument the current problem for solving its twins concurrently
+ * @param si identifies the slice where to start instrumenting
+ */
+void parallel_twins_instrument_problem(slice_index si);
+
+/* Write the output of the twins in their order after the last twin has been
+ * solved
+ * @param si identifies the STParallelTwinsCollector slice
+ */
+void parallel_twins_collector_solve(slice_index si);
+
+/* Start a worker solving the current twin
+ * @param si identifies the STParallelTwinSpawner slice
+ */
+void parallel_twin_spawner_solve(slice_index si);
+
+#endif
@@ -0,0 +1,241 @@
+#include "solving/parallel/workers.h"
+#include "platform/worker.h"
+#include "platform/tmpfile.h"
+#include "output/plaintext/protocol.h"
+#include "debugging/trace.h"
+#include "debugging/assert.h"
+
+#include <limits.h>
+#include <stdlib.h>
+
+static unsigned int nr_workers_requested = 1;
+
+static boolean is_worker;
+
+static FILE *worker_output[parallel_max_nr_workers];
+static unsigned int nr_workers_started;
+
+/* Interpret the value of command line option -threads
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_nr_workers(char const *optionValue)
+{
+  boolean result = false;
+  char *end;
+  unsigned long const value = strtoul(optionValue,&end,10);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%s",optionValue);
+  TraceFunctionParamListEnd();
+
+  if (optionValue!=end && *end==0 && value>0)
+  {
+    if (value>parallel_max_nr_workers)
+      nr_workers_requested = parallel_max_nr_workers;
+    else
+      nr_workers_requested = (unsigned int)value;
+
+    result = true;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Retrieve the number of workers requested by the user
+ * @return number of workers; 1 if no parallel solving was requested
+ */
+unsigned int parallel_get_nr_workers(void)
+{
+  return nr_workers_requested;
+}
+
+/* Are we a worker?
+ * @return true iff the current process is a worker
+ */
+boolean parallel_is_worker(void)
+{
+  return is_worker;
+}
+
+/* Start the requested number of workers
+ * @return the index of the worker if we are a worker
+ *         parallel_workers_started if we are the master and at least one
+ *                                  worker has been started
+ *         parallel_workers_not_started otherwise
+ */
+unsigned int parallel_start_workers(void)
+{
+  unsigned int result = parallel_workers_not_started;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  assert(!is_worker);
+  assert(nr_workers_started==0);
+
+  /* make sure that no output is written twice */
+  protocol_fflush(stdout);
+
+  while (nr_workers_started<nr_workers_requested)
+  {
+    FILE * const output = platform_open_tmpfile();
+    if (output==0)
+      break;
+    else
+    {
+      platform_worker_start_result const start = platform_start_worker(output);
+      if (start==platform_worker_running)
+      {
+        is_worker = true;
+        /* the master will write our output to the protocol file (if any) */
+        protocol_detach();
+        result = nr_workers_started;
+        break;
+      }
+      else if (start==platform_worker_started)
+      {
+        worker_output[nr_workers_started] = output;
+        ++nr_workers_started;
+        result = parallel_workers_started;
+      }
+      else
+      {
+        platform_close_tmpfile(output);
+        break;
+      }
+    }
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Retrieve the number of workers started by the latest invokation of
+ * parallel_start_workers() (which may be less than the number requested)
+ * @return number of workers
+ */
+unsigned int parallel_get_nr_started_workers(void)
+{
+  return nr_workers_started;
+}
+
+/* Determine the current position in the output of the current worker
+ * @return position
+ */
+long parallel_worker_output_position(void)
+{
+  assert(is_worker);
+  return platform_worker_output_position();
+}
+
+/* Terminate the current worker
+ * @note doesn't return
+ */
+void parallel_end_worker(void)
+{
+  assert(is_worker);
+  platform_end_worker();
+}
+
+/* Wait for the workers to terminate
+ * @return true iff all workers have terminated regularly
+ */
+boolean parallel_wait_for_workers(void)
+{
+  boolean result;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  result = platform_wait_for_workers();
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+static void write_output(FILE *output, long start, long end)
+{
+  if (start<end && fseek(output,start,SEEK_SET)==0)
+  {
+    char buffer[BUFSIZ+1];
+    long remaining = end-start;
+
+    while (remaining>0)
+    {
+      size_t const wanted = remaining<BUFSIZ ? (size_t)remaining : BUFSIZ;
+      size_t const nr_read = fread(buffer,1,wanted,output);
+      if (nr_read==0)
+        break;
+      else
+      {
+        buffer[nr_read] = '\0';
+        protocol_fprintf(stdout,"%s",buffer);
+        remaining -= (long)nr_read;
+      }
+    }
+  }
+}
+
+/* Write part of the output of a worker that has terminated
+ * @param worker index of the worker
+ * @param start position of the first character to be written
+ * @param end position behind the last character to be written
+ */
+void parallel_write_worker_output(unsigned int worker, long start, long end)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",worker);
+  TraceFunctionParam("%ld",start);
+  TraceFunctionParam("%ld",end);
+  TraceFunctionParamListEnd();
+
+  assert(worker<nr_workers_started);
+
+  write_output(worker_output[worker],start,end);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Write the complete output of a worker that has terminated and that has
+ * been started with platform_start_worker() instead of
+ * parallel_start_workers()
+ * @param output file that the worker's output has been redirected to
+ */
+void parallel_write_output_file(FILE *output)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  if (fseek(output,0,SEEK_END)==0)
+    write_output(output,0,ftell(output));
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Release the resources used for the workers that have terminated
+ */
+void parallel_release_workers(void)
+{
+  unsigned int i;
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParamListEnd();
+
+  for (i = 0; i!=nr_workers_started; ++i)
+    platform_close_tmpfile(worker_output[i]);
+
+  nr_workers_started = 0;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
@@ -0,0 +1,87 @@
+#if !defined(SOLVING_PARALLEL_WORKERS_H)
+#define SOLVING_PARALLEL_WORKERS_H
+
+#include "utilities/boolean.h"
+
+#include <stdio.h>
+
+/* This module manages the worker processes that solve parts of a problem in
+ * parallel (command line option -threads).
+ * The workers write their output to temporary files; the master then writes
+ * the relevant parts of these files in the order in which sequential solving
+ * would have written them.
+ */
+
+enum
+{
+  parallel_max_nr_workers = 128,
+
+  /* special return values of parallel_start_workers() */
+  parallel_workers_not_started = parallel_max_nr_workers,
+  parallel_workers_started
+};
+
+/* Interpret the value of command line option -threads
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean parallel_read_nr_workers(char const *optionValue);
+
+/* Retrieve the number of workers requested by the user
+ * @return number of workers; 1 if no parallel solving was requested
+ */
+unsigned int parallel_get_nr_workers(void);
+
+/* Are we a worker?
+ * @return true iff the current process is a worker
+ */
+boolean parallel_is_worker(void);
+
+/* Start the requested number of workers
+ * @return the index of the worker if we are a worker
+ *         parallel_workers_started if we are the master and at least one
+ *                                  worker has been started
+ *         parallel_workers_not_started otherwise
+ */
+unsigned int parallel_start_workers(void);
+
+/* Retrieve the number of workers started by the latest invokation of
+ * parallel_start_workers() (which may be less than the number requested)
+ * @return number of workers
+ */
+unsigned int parallel_get_nr_started_workers(void);
+
+/* Determine the current position in the output of the current worker
+ * @return position
+ */
+long parallel_worker_output_position(void);
+
+/* Terminate the current worker
+ * @note doesn't return
+ */
+void parallel_end_worker(void);
+
+/* Wait for the workers to terminate
+ * @return true iff all workers have terminated regularly
+ */
+boolean parallel_wait_for_workers(void);
+
+/* Write part of the output of a worker that has terminated
+ * @param worker index of the worker
+ * @param start position of the first character to be written
+ * @param end position behind the last character to be written
+ */
+void parallel_write_worker_output(unsigned int worker, long start, long end);
+
+/* Write the complete output of a worker that has terminated and that has
+ * been started with platform_start_worker() instead of
+ * parallel_start_workers()
+ * @param output file that the worker's output has been redirected to
+ */
+void parallel_write_output_file(FILE *output);
+
+/* Release the resources used for the workers that have terminated
+ */
+void parallel_release_workers(void);
+
+#endif
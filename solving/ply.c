@@ -7,24 +7,111 @@
 #include "debugging/trace.h"
 
 #include "debugging/assert.h"
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 ply nbply = ply_nil;
 
-ply parent_ply[maxply+1];
+ply maxply = default_maxply;
 
-Side trait[maxply+1];
+ply *parent_ply;
+
+Side *trait;
 
 static ply ply_watermark;
-static ply ply_stack[maxply+1];
+static ply *ply_stack;
 static ply ply_stack_pointer;
 
+enum
+{
+  max_nr_tables = 128
+};
+
+static void *tables[max_nr_tables];
+static unsigned int nr_tables;
+
 /* reset the ply module */
 void ply_reset(void)
 {
   SET_CURRMOVE(nbply,nil_coup);
 }
 
+/* Interpret the value of command line option -maxply
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean ply_read_maxply(char const *optionValue)
+{
+  boolean result = false;
+  char *end;
+  unsigned long const value = strtoul(optionValue,&end,10);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%s",optionValue);
+  TraceFunctionParamListEnd();
+
+  /* the move generation stack has to be indexable by numecoup */
+  if (optionValue!=end && *end==0
+      && value>ply_retro_move && value<=UINT_MAX/max_nr_moves_per_ply-1)
+  {
+    maxply = (ply)value;
+    result = true;
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResult("%u",result);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Allocate a table dimensioned by maxply
+ * @param nr_elements number of elements of the table
+ * @param element_size size of an element
+ * @return the table, with all elements set to 0
+ * @note aborts if the table can't be allocated
+ */
+void *ply_allocate_table(size_t nr_elements, size_t element_size)
+{
+  void * const result = calloc(nr_elements,element_size);
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%lu",(unsigned long)nr_elements);
+  TraceFunctionParam("%lu",(unsigned long)element_size);
+  TraceFunctionParamListEnd();
+
+  if (result==0)
+  {
+    fprintf(stderr, "\nOUT OF SPACE: Unable to allocate the tables for %u plies -- aborting.\n", maxply);
+    exit(1);
+  }
+
+  assert(nr_tables<max_nr_tables);
+  tables[nr_tables++] = result;
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+  return result;
+}
+
+/* Deallocate the tables allocated by ply_allocate_table()
+ */
+void ply_deallocate_tables(void)
+{
+  while (nr_tables>0)
+    free(tables[--nr_tables]);
+}
+
+/* Allocate the tables of the ply module
+ */
+void ply_allocate_ply_tables(void)
+{
+  parent_ply = ply_allocate_table(maxply+1,sizeof parent_ply[0]);
+  trait = ply_allocate_table(maxply+1,sizeof trait[0]);
+  ply_stack = ply_allocate_table(maxply+1,sizeof ply_stack[0]);
+}
+
 /* Start a new ply as the child of the current ply, making the child the new
  * current ply
  * @param side the side at the move in the child ply
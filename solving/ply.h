@@ -8,24 +8,34 @@
  */
 
 #include "position/side.h"
+#include "utilities/boolean.h"
+
+#include <stddef.h>
 
 typedef unsigned int ply;
 
 enum
 {
+  /* number of plies available for solving if command line option -maxply
+   * isn't used */
 #if defined(__unix)
-  maxply =   1002
+  default_maxply =   1002
 #else
 #if defined(_WIN32)
-  maxply = 2702
+  default_maxply = 2702
 #elif defined(_OS2)
-  maxply = 302
+  default_maxply = 302
 #else
-  maxply = 702
+  default_maxply = 702
 #endif /* _WIN32 */
 #endif /* __unix */
 };
 
+/* number of plies available for solving; the tables indexed by ply (and the
+ * tables dimensioned by the number of plies, e.g. the move generation stack)
+ * are allocated at startup once it is known */
+extern ply maxply;
+
 enum
 {
   ply_nil,
@@ -39,13 +49,35 @@ enum
 /* the current ply */
 extern ply nbply;
 
-extern ply parent_ply[maxply+1];
+extern ply *parent_ply;
 
-extern Side trait[maxply+1];
+extern Side *trait;
 
 /* reset the ply module */
 void ply_reset(void);
 
+/* Interpret the value of command line option -maxply
+ * @param optionValue value of the option
+ * @return true iff optionValue points to a valid value
+ */
+boolean ply_read_maxply(char const *optionValue);
+
+/* Allocate a table dimensioned by maxply
+ * @param nr_elements number of elements of the table
+ * @param element_size size of an element
+ * @return the table, with all elements set to 0
+ * @note aborts if the table can't be allocated
+ */
+void *ply_allocate_table(size_t nr_elements, size_t element_size);
+
+/* Deallocate the tables allocated by ply_allocate_table()
+ */
+void ply_deallocate_tables(void);
+
+/* Allocate the tables of the ply module
+ */
+void ply_allocate_ply_tables(void);
+
 /* Copy the current ply, making the copy the new current ply */
 void copyply(void);
 
@@ -73,6 +73,7 @@ void ProofRestoreStartPosition(void)
   TraceFunctionParamListEnd();
 
   being_solved = proofgames_start_position;
+  recalculate_derived_board_data();
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
@@ -217,6 +218,7 @@ static void move_effect_journal_undo_snapshot_proofgame_target_position(move_eff
   TraceFunctionParamListEnd();
 
   being_solved = proofgames_target_position;
+  recalculate_derived_board_data();
 
   TraceFunctionExit(__func__);
   TraceFunctionResultEnd();
@@ -334,6 +336,7 @@ void proof_solve(slice_index si)
   move_effect_journal_do_snapshot_proofgame_target_position(move_effect_reason_diagram_setup);
 
   being_solved = proofgames_start_position;
+  recalculate_derived_board_data();
 
   initialise_target_pieces_cache();
 
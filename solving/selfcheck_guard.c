@@ -14,6 +14,7 @@
 #include "solving/check.h"
 #include "solving/pipe.h"
 #include "conditions/conditions.h"
+#include "optimisations/orthodox_legal_moves.h"
 #include "debugging/trace.h"
 #include "debugging/assert.h"
 
@@ -55,7 +56,10 @@ void selfcheck_guard_solve(slice_index si)
   TraceFunctionParam("%u",si);
   TraceFunctionParamListEnd();
 
-  if (is_in_check(advers(SLICE_STARTER(si))))
+  if (trait[nbply]==advers(SLICE_STARTER(si))
+      && orthodox_legal_moves_is_move_known_legal(CURRMOVE_OF_PLY(nbply)))
+    pipe_solve_delegate(si);
+  else if (is_in_check(advers(SLICE_STARTER(si))))
     solve_result = previous_move_is_illegal;
   else
     pipe_solve_delegate(si);
@@ -0,0 +1,228 @@
+#include "solving/statistics.h"
+#include "stipulation/pipe.h"
+#include "stipulation/slice_insertion.h"
+#include "solving/pipe.h"
+#include "solving/move_player.h"
+#include "solving/machinery/twin.h"
+#include "platform/timer.h"
+#include "output/plaintext/message.h"
+#include "debugging/trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+boolean statistics_are_collected;
+
+static boolean is_enabled;
+
+typedef struct
+{
+    unsigned long visits;
+    unsigned long moves_generated;
+    unsigned long hash_probes;
+    unsigned long hash_hits;
+    unsigned long long nsec;
+} slice_type_statistics_type;
+
+static slice_type_statistics_type statistics[nr_slice_types];
+
+enum
+{
+  /* slices nested more deeply are accounted for as if they were part of their
+   * ancestor at this depth */
+  max_depth = 1<<16
+};
+
+static slice_type type_stack[max_depth];
+static unsigned int depth;
+static unsigned long long last_event_time;
+
+/* Enable collecting the statistics
+ */
+void statistics_enable(void)
+{
+  is_enabled = true;
+}
+
+/* Determine whether collecting the statistics has been enabled
+ * @return true iff it has been enabled
+ */
+boolean statistics_is_enabled(void)
+{
+  return is_enabled;
+}
+
+static slice_type_statistics_type *current_statistics(void)
+{
+  return &statistics[type_stack[(depth<max_depth ? depth : max_depth)-1]];
+}
+
+/* Hook to be invoked when a slice is entered
+ * @param si identifies the slice
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_enter_slice(slice_index si)
+{
+  unsigned long long const now = platform_read_fine_clock();
+  slice_type const type = SLICE_TYPE(si);
+
+  if (depth>0)
+    current_statistics()->nsec += now-last_event_time;
+
+  if (depth<max_depth)
+    type_stack[depth] = type;
+  ++depth;
+
+  ++statistics[type].visits;
+
+  last_event_time = now;
+}
+
+/* Hook to be invoked when a slice is left
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_leave_slice(void)
+{
+  unsigned long long const now = platform_read_fine_clock();
+
+  current_statistics()->nsec += now-last_event_time;
+  --depth;
+
+  last_event_time = now;
+}
+
+/* Hook to be invoked when moves have been generated
+ * @param nr_moves number of moves
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_count_moves_generated(unsigned int nr_moves)
+{
+  if (depth>0)
+    current_statistics()->moves_generated += nr_moves;
+}
+
+/* Hook to be invoked when the hash table has been probed
+ * @param is_hit true iff the position was found in the table
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_count_hash_probe(boolean is_hit)
+{
+  if (depth>0)
+  {
+    slice_type_statistics_type * const current = current_statistics();
+    ++current->hash_probes;
+    if (is_hit)
+      ++current->hash_hits;
+  }
+}
+
+static int compare_by_time(void const *a, void const *b)
+{
+  slice_type_statistics_type const * const stat_a = &statistics[*(slice_type const *)a];
+  slice_type_statistics_type const * const stat_b = &statistics[*(slice_type const *)b];
+
+  if (stat_a->nsec>stat_b->nsec)
+    return -1;
+  else if (stat_a->nsec<stat_b->nsec)
+    return 1;
+  else
+    return 0;
+}
+
+static void write_statistics(unsigned long nr_moves_played)
+{
+  slice_type visited[nr_slice_types];
+  unsigned int nr_visited = 0;
+  slice_type_statistics_type total = { 0, 0, 0, 0, 0 };
+  unsigned int type;
+  unsigned int i;
+
+  for (type = 0; type!=nr_slice_types; ++type)
+    if (statistics[type].visits>0)
+    {
+      visited[nr_visited++] = (slice_type)type;
+      total.visits += statistics[type].visits;
+      total.moves_generated += statistics[type].moves_generated;
+      total.hash_probes += statistics[type].hash_probes;
+      total.hash_hits += statistics[type].hash_hits;
+      total.nsec += statistics[type].nsec;
+    }
+
+  qsort(visited,nr_visited,sizeof visited[0],&compare_by_time);
+
+  /* don't append the record to an error message, e.g. about a king capture */
+  output_plaintext_error_start_line();
+
+  fprintf(stderr,
+          "{\"twin\":%lu,\"visits\":%lu,\"moves_played\":%lu,\"moves_generated\":%lu,"
+          "\"hash_probes\":%lu,\"hash_hits\":%lu,\"usec\":%llu,\"slices\":[",
+          twin_id,
+          total.visits,
+          nr_moves_played,
+          total.moves_generated,
+          total.hash_probes,
+          total.hash_hits,
+          total.nsec/1000);
+
+  for (i = 0; i!=nr_visited; ++i)
+  {
+    slice_type_statistics_type const * const stat = &statistics[visited[i]];
+    fprintf(stderr,
+            "%s{\"type\":\"%s\",\"visits\":%lu,\"moves_generated\":%lu,"
+            "\"hash_probes\":%lu,\"hash_hits\":%lu,\"usec\":%llu}",
+            i==0 ? "" : ",",
+            slice_type_names[visited[i]],
+            stat->visits,
+            stat->moves_generated,
+            stat->hash_probes,
+            stat->hash_hits,
+            stat->nsec/1000);
+  }
+
+  fputs("]}\n",stderr);
+  fflush(stderr);
+}
+
+/* Collect the statistics while solving a twin and write them afterwards
+ * @param si identifies the STStatisticsWriter slice
+ */
+void statistics_writer_solve(slice_index si)
+{
+  unsigned long const nr_moves_played_before = move_player_get_nr_moves_played();
+
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  memset(statistics,0,sizeof statistics);
+  depth = 0;
+  statistics_are_collected = true;
+
+  pipe_solve_delegate(si);
+
+  statistics_are_collected = false;
+
+  write_statistics(move_player_get_nr_moves_played()-nr_moves_played_before);
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
+
+/* Instrument the solving machinery of a twin for collecting statistics
+ * @param si identifies the slice where to start instrumenting
+ */
+void statistics_instrument_twin(slice_index si)
+{
+  TraceFunctionEntry(__func__);
+  TraceFunctionParam("%u",si);
+  TraceFunctionParamListEnd();
+
+  {
+    slice_index const prototype = alloc_pipe(STStatisticsWriter);
+    slice_insertion_insert(si,&prototype,1);
+  }
+
+  TraceFunctionExit(__func__);
+  TraceFunctionResultEnd();
+}
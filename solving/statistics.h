@@ -0,0 +1,63 @@
+#if !defined(SOLVING_STATISTICS_H)
+#define SOLVING_STATISTICS_H
+
+#include "stipulation/stipulation.h"
+#include "utilities/boolean.h"
+
+/* Performance statistics per slice type, available in every build:
+ * - number of visits of slices of the type
+ * - number of moves generated by slices of the type
+ * - number of hash table probes and hits by slices of the type
+ * - time spent in slices of the type (excluding the time spent in the slices
+ *   they delegate to)
+ * Collecting is activated with -stats; the statistics are written as a JSON
+ * object per line to standard error at the end of each twin.
+ */
+
+/* Are statistics being collected? Only to be read by the hooks below.
+ */
+extern boolean statistics_are_collected;
+
+/* Enable collecting the statistics
+ */
+void statistics_enable(void);
+
+/* Determine whether collecting the statistics has been enabled
+ * @return true iff it has been enabled
+ */
+boolean statistics_is_enabled(void);
+
+/* Hook to be invoked when a slice is entered
+ * @param si identifies the slice
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_enter_slice(slice_index si);
+
+/* Hook to be invoked when a slice is left
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_leave_slice(void);
+
+/* Hook to be invoked when moves have been generated
+ * @param nr_moves number of moves
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_count_moves_generated(unsigned int nr_moves);
+
+/* Hook to be invoked when the hash table has been probed
+ * @param is_hit true iff the position was found in the table
+ * @note only invoke if statistics_are_collected
+ */
+void statistics_count_hash_probe(boolean is_hit);
+
+/* Instrument the solving machinery of a twin for collecting statistics
+ * @param si identifies the slice where to start instrumenting
+ */
+void statistics_instrument_twin(slice_index si);
+
+/* Collect the statistics while solving a twin and write them afterwards
+ * @param si identifies the STStatisticsWriter slice
+ */
+void statistics_writer_solve(slice_index si);
+
+#endif
@@ -263,6 +263,7 @@ static slice_index make_opponent_moves_counter_fork(Side side)
     slice_index const prototypes[] =
     {
         alloc_opponent_moves_counter_slice(),
+        alloc_opponent_moves_known_legal_counter_slice(),
         alloc_legal_attack_counter_slice()
     };
     enum { nr_prototypes = sizeof prototypes / sizeof prototypes[0] };
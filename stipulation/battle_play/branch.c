@@ -75,6 +75,7 @@ static slice_index const slice_rank_order[] =
   STDeadEnd,
   STLearnUnsolvable,
   STShortSolutionsStart,
+  STParallelRootMoveSplitter,
   STGeneratingMoves,
   STExecutingKingCapture,
   STExclusiveChessExclusivityDetector,
@@ -114,6 +115,8 @@ static slice_index const slice_rank_order[] =
   STPiecesParalysingSuffocationFinder,
   STPiecesParalysingRemoveCaptures,
   STMummerOrchestrator,
+  STOrthodoxRemoveIllegalMoves,
+  STOpponentMovesKnownLegalCounter,
   STDoneRemovingIllegalMoves,
   STEnPassantRemoveNonReachers,
   STCastlingRemoveNonReachers,
@@ -124,6 +127,7 @@ static slice_index const slice_rank_order[] =
   STDoneRemovingFutileMoves,
   STRetractionPrioriser,
   STKillerMovePrioriser,
+  STHistoryPrioriser,
   STDonePriorisingMoves,
   STSeriesCapturePlyRewinder,
   STMove,
@@ -132,6 +136,7 @@ static slice_index const slice_rank_order[] =
   STMaxSolutionsGuard,
   STMaxSolutionsCounter,
   STRestartGuard,
+  STParallelRootMoveClaimer,
   STOutputPlainTextTreeEndOfSolutionWriter,
   STOutputLaTeXTreeEndOfSolutionWriter,
   STThreatCollector,
@@ -197,7 +202,7 @@ static slice_index const slice_rank_order[] =
   STDeadEnd,
   STGeneratingMoves,
   STExecutingKingCapture,
-  STKillerMoveFinalDefenseMove,
+  STKillerMoveStagedDefense,
   STExclusiveChessExclusivityDetector,
   STExclusiveChessNestedExclusivityDetector,
   STMakeTakeResetMoveIdsCastlingAsMakeInMoveGeneration,
@@ -234,11 +239,14 @@ static slice_index const slice_rank_order[] =
   STShieldedKingsRemoveIllegalCaptures,
   STSuperguardsRemoveIllegalCaptures,
   STMummerOrchestrator,
+  STOrthodoxRemoveIllegalMoves,
+  STOpponentMovesKnownLegalCounter,
   STDoneRemovingIllegalMoves,
   STCageCirceFutileCapturesRemover,
   STDoneRemovingFutileMoves,
   STRetractionPrioriser,
   STKillerMovePrioriser,
+  STHistoryPrioriser,
   STOpponentMovesFewMovesPrioriser,
   STDonePriorisingMoves,
   STSeriesCapturePlyRewinder,
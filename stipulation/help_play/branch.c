@@ -31,6 +31,7 @@ static slice_index const slice_rank_order[] =
   STStopOnShortSolutionsFilter,
   STIntelligentMovesLeftInitialiser,
   STRestartGuardIntelligent,
+  STParallelTargetPositionSplitter,
   STIntelligentFilter,
   STMaxTimeGuard,
   STMaxSolutionsGuard,
@@ -63,6 +64,7 @@ static slice_index const slice_rank_order[] =
   STCastlingFilter,
   STPrerequisiteOptimiser,
   STDeadEnd,
+  STParallelRootMoveSplitter,
   STGeneratingMoves,
   STExecutingKingCapture,
   STExclusiveChessExclusivityDetector,
@@ -104,6 +106,7 @@ static slice_index const slice_rank_order[] =
   STShieldedKingsRemoveIllegalCaptures,
   STSuperguardsRemoveIllegalCaptures,
   STMummerOrchestrator,
+  STOrthodoxRemoveIllegalMoves,
   STDoneRemovingIllegalMoves,
   STEnPassantRemoveNonReachers,
   STCastlingRemoveNonReachers,
@@ -122,6 +125,7 @@ static slice_index const slice_rank_order[] =
   STMaxSolutionsGuard,
   STRestartGuardNested,
   STRestartGuard,
+  STParallelRootMoveClaimer,
   STKeepMatingFilter,
   STIntelligentLimitNrSolutionsPerTargetPosLimiter,
   STCheckZigzagLanding,
@@ -94,7 +94,6 @@ static slice_type const fork_slice_types[] =
     STCirceCageNoCageFork,
     STSuperCirceNoRebirthFork,
     STPawnToImitatorPromoter,
-    STKillerMoveFinalDefenseMove,
     STOhneschachStopIfCheckAndNotMate,
     STMoveGeneratorFork,
     STIsSquareObservedFork,
@@ -245,6 +244,7 @@ static slice_type const move_reordering_optimiser_slice_types[] =
 {
     STOpponentMovesFewMovesPrioriser,
     STKillerMovePrioriser,
+    STHistoryPrioriser,
     STRetractionPrioriser
 };
 
@@ -283,7 +283,6 @@ static slice_type const binary_slice_types[] =
     STCirceCageNoCageFork,
     STSuperCirceNoRebirthFork,
     STPawnToImitatorPromoter,
-    STKillerMoveFinalDefenseMove,
     STTransmutingKingIsSquareObserved,
     STVaultingKingIsSquareObserved,
     STMoveForPieceGeneratorTwoPaths,
@@ -652,12 +652,17 @@ static slice_index const slice_rank_order[] =
   /* slices from here on are created once by main() (mostly) */
   STCommandLineOptionsParser,
   STInputPlainTextOpener,
+  STServerChannelOpener,
   STPlatformInitialiser,
+  STRegressionSuiteRunner,
+  STParallelPartitionMerger,
   STOutputLaTeXCloser,
+  STPlyTablesAllocator,
   STHashTableDimensioner,
   STTimerStarter,
   STCheckDirInitialiser,
   STOutputPlainTextWriter,
+  STServerRequestsIterator,
   STInputPlainTextUserLanguageDetector,
   STInputPlainTextProblemsIterator,
   STConditionsResetter,
@@ -671,6 +676,7 @@ static slice_index const slice_rank_order[] =
   STProblemSolvingIncomplete,
   /* slices from here on are created for each problem
    * mostly by STInputPlainTextProblemHandler */
+  STParallelTwinsCollector,
   STInputPlainTextTwinsHandler,
   /* enter twin stage */
   STOutputLaTeXTwinningWriterBuilder,
@@ -682,6 +688,7 @@ static slice_index const slice_rank_order[] =
   STPostKeyPlayStipulationModifier,
   STStipulationStarterDetector,
   STOutputPlainTextOptionNoboard,
+  STParallelTwinSpawner,
   STDuplexSolver,
   STHalfDuplexSolver,
   /* enter phase stage */
@@ -698,6 +705,7 @@ static slice_index const slice_rank_order[] =
   STIntelligentSolutionsPerTargetPosProblemInstrumenter,
   STMaxSolutionsProblemInstrumenter,
   STStopOnShortSolutionsProblemInstrumenter,
+  STParallelRootMovesProblemInstrumenter,
   STOutputLaTeXProblemIntroWriter,
   STOutputLaTeXTwinningWriter,
   STStartOfCurrentTwin,
@@ -738,6 +746,7 @@ static slice_index const slice_rank_order[] =
 #if defined(DOMEASURE)
   STCountersWriter,
 #endif
+  STStatisticsWriter,
   STInputVerification,
   STMoveEffectsJournalReset,
   STSolversBuilder1,
@@ -748,6 +757,7 @@ static slice_index const slice_rank_order[] =
   STHashOpener,
   STMaxSolutionsSolvingInstrumenter,
   STStopOnShortSolutionsSolvingInstrumenter,
+  STParallelRootMovesSolvingInstrumenter,
   STIntelligentSolutionsPerTargetPosSolvingInstrumenter,
   STSlackLengthAdjuster,
   STMaxTimeSetter,
@@ -18,7 +18,14 @@ static unsigned int number_of_tables;
 
 /* current position in a specific table
  */
-static table_position current_position[3*maxply];
+static table_position *current_position;
+
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void tables_allocate_ply_tables(void)
+{
+  current_position = ply_allocate_table(3*maxply,sizeof current_position[0]);
+}
 
 typedef unsigned int relevant_effects_idx_type;
 
@@ -50,4 +50,8 @@ void append_to_table(table t);
  */
 boolean is_current_move_in_table(table t);
 
+/* Allocate the tables of this module that are dimensioned by maxply
+ */
+void tables_allocate_ply_tables(void);
+
 #endif